@@ -0,0 +1,329 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "binary_search.h"
+#include "splus_tree.h"
+#include "learned_index.h"
+
+// Lookup throughput of binary_search, the branchless lower_bound, the
+// Eytzinger layout and the S+-tree on sorted arrays from 10^3 elements up to a maximum, then
+// the batched search strategies at several query/array ratios, then the
+// learned index's memory and latency on differently shaped key sets, then
+// the galloping, cursor and interpolation searches on different query traces.
+
+#define NUM_QUERIES (1 << 22)
+// Largest batch the ratio table builds.
+#define MAX_BATCH 20000000
+
+double now_seconds() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+unsigned long long xorshift_state = 88172645463325252ull;
+
+unsigned long long xorshift64() {
+    xorshift_state ^= xorshift_state << 13;
+    xorshift_state ^= xorshift_state >> 7;
+    xorshift_state ^= xorshift_state << 17;
+    return xorshift_state;
+}
+
+void bench_single(long long max_count) {
+    int* queries = malloc(NUM_QUERIES * sizeof(int));
+
+    printf("random lookups, %d queries, million lookups per second\n", NUM_QUERIES);
+    printf("%-12s%16s%16s%16s%16s%18s%18s\n", "n", "binary_search", "lower_bound", "eytzinger", "s+tree",
+           "eytz build ms", "s+tree build ms");
+    for (long long count = 1000; count <= max_count; count *= 10) {
+        int* array = malloc(count * sizeof(int));
+        if (array == NULL) {
+            printf("could not allocate %lld elements, stopping\n", count);
+            break;
+        }
+        // Even keys, queries over [0, 2n): half hit, half miss.
+        for (long long i = 0; i < count; i++) {
+            array[i] = (int)(2 * i);
+        }
+        for (int q = 0; q < NUM_QUERIES; q++) {
+            queries[q] = (int)(xorshift64() % (2 * count));
+        }
+        double start = now_seconds();
+        Eytzinger* tree = create_eytzinger(array, (int)count);
+        double build = now_seconds() - start;
+        start = now_seconds();
+        SPlusTree* splus = create_splus_tree(array, (int)count);
+        double splus_build = now_seconds() - start;
+        if (tree == NULL || splus == NULL) {
+            destroy_eytzinger(&tree);
+            free(array);
+            break;
+        }
+
+        double rates[4];
+        long long checks[4];
+        for (int variant = 0; variant < 4; variant++) {
+            long long check = 0;
+            start = now_seconds();
+            for (int q = 0; q < NUM_QUERIES; q++) {
+                if (variant == 0) {
+                    check += binary_search(queries[q], array, (int)count) >= 0;
+                }
+                else if (variant == 1) {
+                    int i = lower_bound(queries[q], array, (int)count);
+                    check += (i < count && array[i] == queries[q]);
+                }
+                else if (variant == 2) {
+                    check += eytzinger_search(queries[q], tree) >= 0;
+                }
+                else {
+                    int i = splus_lower_bound(queries[q], splus);
+                    check += (i < count && array[i] == queries[q]);
+                }
+            }
+            double elapsed = now_seconds() - start;
+            rates[variant] = NUM_QUERIES / elapsed / 1e6;
+            checks[variant] = check;
+        }
+        printf("%-12lld%16.2f%16.2f%16.2f%16.2f%18.2f%18.2f%s\n", count, rates[0], rates[1], rates[2], rates[3],
+               build * 1000, splus_build * 1000,
+               (checks[0] == checks[1] && checks[1] == checks[2] && checks[2] == checks[3]) ? "" : "  MISMATCH");
+        destroy_eytzinger(&tree);
+        destroy_splus_tree(&splus);
+        free(array);
+    }
+    free(queries);
+}
+
+int compare_ints(const void* a, const void* b) {
+    int x = *(const int*)a;
+    int y = *(const int*)b;
+    return (x > y) - (x < y);
+}
+
+void loop_binary_search(const int* queries, int m, const int* array, int n, int* out) {
+    // The baseline: one independent search per query.
+    for (int j = 0; j < m; j++) {
+        out[j] = binary_search(queries[j], (int*)array, n);
+    }
+}
+
+void bench_batch(long long max_count) {
+    const char* names[] = {"loop", "interleaved", "avx2", "batch", "merge*", "batch*"};
+    int num_variants = sizeof(names) / sizeof(names[0]);
+    double ratios[] = {0.001, 0.01, 0.1, 1, 10};
+    int num_ratios = sizeof(ratios) / sizeof(ratios[0]);
+    int simd = binary_search_has_simd();
+
+    printf("\nbatched membership queries, million lookups per second (* = sorted queries)\n");
+    printf("%-12s%-10s", "n", "m/n");
+    for (int v = 0; v < num_variants; v++) {
+        printf("%14s", names[v]);
+    }
+    printf("\n");
+    for (long long count = 10000; count <= max_count; count *= 100) {
+        int* array = malloc(count * sizeof(int));
+        if (array == NULL) {
+            printf("could not allocate %lld elements, stopping\n", count);
+            break;
+        }
+        for (long long i = 0; i < count; i++) {
+            array[i] = (int)(2 * i);
+        }
+        for (int r = 0; r < num_ratios; r++) {
+            long long m = (long long)(count * ratios[r]);
+            if (m < 100 || m > MAX_BATCH) {
+                continue;
+            }
+            int* queries = malloc(m * sizeof(int));
+            int* sorted = malloc(m * sizeof(int));
+            int* out = malloc(m * sizeof(int));
+            for (long long q = 0; q < m; q++) {
+                queries[q] = (int)(xorshift64() % (2 * count));
+                sorted[q] = queries[q];
+            }
+            qsort(sorted, m, sizeof(int), compare_ints);
+
+            printf("%-12lld%-10g", count, ratios[r]);
+            long long base_check = -1;
+            for (int v = 0; v < num_variants; v++) {
+                const int* input = (v >= 4) ? sorted : queries;
+                if (v == 2 && !simd) {
+                    printf("%14s", "-");
+                    continue;
+                }
+                double start = now_seconds();
+                switch (v) {
+                    case 0: loop_binary_search(input, (int)m, array, (int)count, out); break;
+                    case 1: binary_search_batch_interleaved(input, (int)m, array, (int)count, out); break;
+#if (defined(__x86_64__) || defined(__i386__)) && !defined(BINARY_SEARCH_NO_SIMD)
+                    case 2: binary_search_batch_avx2(input, (int)m, array, (int)count, out); break;
+#endif
+                    case 4: binary_search_batch_merge(input, (int)m, array, (int)count, out); break;
+                    default: binary_search_batch(input, (int)m, array, (int)count, out); break;
+                }
+                double elapsed = now_seconds() - start;
+                // The hit count is the same whatever the order of the queries.
+                long long check = 0;
+                for (long long q = 0; q < m; q++) {
+                    check += out[q] >= 0;
+                }
+                if (base_check < 0) base_check = check;
+                printf("%14.2f%s", m / elapsed / 1e6, (check == base_check) ? "" : "!");
+            }
+            printf("\n");
+            free(queries);
+            free(sorted);
+            free(out);
+        }
+        free(array);
+    }
+}
+
+void fill_keys(int* keys, long long count, int shape) {
+    // 0: evenly spaced, 1: random gaps, 2: pieces of different density and curvature.
+    long long key = 0;
+    for (long long i = 0; i < count; i++) {
+        if (shape == 0) {
+            key = 2 * i;
+        }
+        else if (shape == 1) {
+            key += xorshift64() % 40;
+        }
+        else {
+            long long piece = i * 8 / count;
+            long long step = (piece % 2 == 0) ? 1 + piece : (i - piece * count / 8) / 4096;
+            key += step + xorshift64() % 3;
+        }
+        keys[i] = (int)(key - (1ll << 30));
+    }
+}
+
+void bench_learned(long long max_count) {
+    const char* shapes[] = {"even", "random gaps", "piecewise"};
+    int epsilons[] = {8, 32, 128, 512};
+    long long count = (max_count < 10000000) ? max_count : 10000000;
+    int* keys = malloc(count * sizeof(int));
+    int* queries = malloc(NUM_QUERIES * sizeof(int));
+    printf("\nlearned index, n = %lld, random lookups of present keys\n", count);
+    printf("%-14s%-10s%12s%14s%14s%14s\n", "keys", "index", "segments", "index bytes", "ns/lookup", "build ms");
+    for (int shape = 0; shape < 3; shape++) {
+        fill_keys(keys, count, shape);
+        for (int q = 0; q < NUM_QUERIES; q++) {
+            queries[q] = keys[xorshift64() % count];
+        }
+        long long check = 0;
+        double start = now_seconds();
+        for (int q = 0; q < NUM_QUERIES; q++) {
+            check += lower_bound(queries[q], keys, (int)count);
+        }
+        double elapsed = now_seconds() - start;
+        printf("%-14s%-10s%12s%14s%14.1f%14s\n", shapes[shape], "lower_bd", "-", "0", elapsed / NUM_QUERIES * 1e9, "-");
+        for (int e = 0; e < 4; e++) {
+            start = now_seconds();
+            LearnedIndex* index = create_learned_index(keys, (int)count, epsilons[e]);
+            double build = now_seconds() - start;
+            if (index == NULL) {
+                break;
+            }
+            long long learned_check = 0;
+            start = now_seconds();
+            for (int q = 0; q < NUM_QUERIES; q++) {
+                learned_check += learned_lower_bound(queries[q], index);
+            }
+            elapsed = now_seconds() - start;
+            char name[16];
+            snprintf(name, sizeof(name), "eps=%d", epsilons[e]);
+            printf("%-14s%-10s%12d%14zu%14.1f%14.2f%s\n", shapes[shape], name, index->num_segments,
+                   learned_index_bytes(index), elapsed / NUM_QUERIES * 1e9, build * 1000,
+                   (learned_check == check) ? "" : "  MISMATCH");
+            destroy_learned_index(&index);
+        }
+    }
+    free(keys);
+    free(queries);
+}
+
+void fill_trace(int* queries, const int* keys, long long count, int trace) {
+    // 0: random walk of +-8 positions, 1: ascending with gaps of up to 32
+    // positions (a merge join), 2: uniformly random. Odd steps ask for the key
+    // plus one, which is usually a miss.
+    long long pos = count / 2;
+    for (int q = 0; q < NUM_QUERIES; q++) {
+        if (trace == 0) {
+            pos += (long long)(xorshift64() % 17) - 8;
+            if (pos < 0) pos = 0;
+            if (pos >= count) pos = count - 1;
+        }
+        else if (trace == 1) {
+            pos = (pos + xorshift64() % 33) % count;
+        }
+        else {
+            pos = xorshift64() % count;
+        }
+        queries[q] = keys[pos] + (q & 1);
+    }
+}
+
+void bench_traces(long long max_count) {
+    const char* shapes[] = {"even", "random gaps", "piecewise"};
+    const char* traces[] = {"near", "ascending", "random"};
+    const char* names[] = {"binary_search", "recursive", "lower_bound", "cursor", "interpolation"};
+    int num_variants = sizeof(names) / sizeof(names[0]);
+    long long count = (max_count < 10000000) ? max_count : 10000000;
+    int* keys = malloc(count * sizeof(int));
+    int* queries = malloc(NUM_QUERIES * sizeof(int));
+    printf("\nquery traces, n = %lld, million lookups per second\n", count);
+    printf("%-14s%-12s", "keys", "trace");
+    for (int v = 0; v < num_variants; v++) {
+        printf("%15s", names[v]);
+    }
+    printf("\n");
+    for (int shape = 0; shape < 3; shape++) {
+        fill_keys(keys, count, shape);
+        for (int trace = 0; trace < 3; trace++) {
+            fill_trace(queries, keys, count, trace);
+            printf("%-14s%-12s", shapes[shape], traces[trace]);
+            long long base_check = -1;
+            for (int v = 0; v < num_variants; v++) {
+                SearchCursor cursor;
+                init_search_cursor(&cursor, keys, (int)count);
+                long long check = 0;
+                double start = now_seconds();
+                for (int q = 0; q < NUM_QUERIES; q++) {
+                    int found;
+                    switch (v) {
+                        case 0: found = binary_search(queries[q], keys, (int)count); break;
+                        case 1: found = recursive_bin_search(queries[q], keys, 0, (int)count - 1); break;
+                        case 2: {
+                            int i = lower_bound(queries[q], keys, (int)count);
+                            found = (i < count && keys[i] == queries[q]) ? i : -1;
+                            break;
+                        }
+                        case 3: found = cursor_search(&cursor, queries[q]); break;
+                        default: found = interpolation_search(queries[q], keys, (int)count); break;
+                    }
+                    check += found >= 0;
+                }
+                double elapsed = now_seconds() - start;
+                if (base_check < 0) base_check = check;
+                printf("%15.2f%s", NUM_QUERIES / elapsed / 1e6, (check == base_check) ? "" : "!");
+            }
+            printf("\n");
+        }
+    }
+    free(keys);
+    free(queries);
+}
+
+int main(int argc, char** argv) {
+    // Usage: ./bench_binary_search [max_count]
+    // 10^9 needs about 16 GB (array, Eytzinger keys and positions, S+-tree).
+    long long max_count = (argc > 1) ? atoll(argv[1]) : 100000000;
+    bench_single(max_count);
+    bench_batch(max_count);
+    bench_learned(max_count);
+    bench_traces(max_count);
+    return 0;
+}
@@ -1,5 +1,11 @@
 #include <stdlib.h>
 #include <stdio.h>
+#include "binary_search.h"
+
+#if (defined(__x86_64__) || defined(__i386__)) && !defined(BINARY_SEARCH_NO_SIMD)
+#include <immintrin.h>
+#define BINARY_SEARCH_HAVE_X86_SIMD 1
+#endif
 
 int binary_search(int val, int* array, int arr_len) {
     if (array == NULL) {
@@ -64,3 +70,358 @@ int recursive_bin_search(int val, int* array, int start, int end) {
     
 }
 
+
+int lower_bound(int val, const int* array, int arr_len) {
+    if (arr_len <= 0) {
+        return 0;
+    }
+    if (array == NULL) {
+        fprintf(stderr, "ERROR - Cannot pass NULL as array");
+        return -1;
+    }
+    // Invariant: the answer is in [base, base + len]. Each step keeps one half
+    // without branching; only the length, not the data, drives the loop.
+    const int* base = array;
+    int len = arr_len;
+    while (len > 1) {
+        int half = len / 2;
+        len -= half;
+        // Both possible next probes, so the load is in flight before we know which.
+        __builtin_prefetch(&base[len / 2 - 1]);
+        __builtin_prefetch(&base[half + len / 2 - 1]);
+        base = (base[half - 1] < val) ? base + half : base;
+    }
+    return (int)(base - array) + (*base < val);
+}
+
+int gallop_lower_bound(int val, const int* array, int arr_len, int hint) {
+    if (arr_len <= 0) {
+        return 0;
+    }
+    if (array == NULL) {
+        fprintf(stderr, "ERROR - Cannot pass NULL as array");
+        return -1;
+    }
+    if (hint < 0) hint = 0;
+    if (hint > arr_len) hint = arr_len;
+    if (hint < arr_len && array[hint] < val) {
+        // Forward. Everything before lo is known to be < val.
+        int lo = hint + 1;
+        int step = 1;
+        while (lo + step - 1 < arr_len && array[lo + step - 1] < val) {
+            lo += step;
+            step *= 2;
+        }
+        int hi = (lo + step - 1 < arr_len) ? lo + step - 1 : arr_len - 1;
+        return lo + lower_bound(val, array + lo, hi - lo + 1);
+    }
+    if (hint > 0 && array[hint - 1] >= val) {
+        // Backward. array[hi] is known to be >= val.
+        int hi = hint - 1;
+        int step = 1;
+        while (hi - step >= 0 && array[hi - step] >= val) {
+            hi -= step;
+            step *= 2;
+        }
+        int lo = (hi - step + 1 > 0) ? hi - step + 1 : 0;
+        return lo + lower_bound(val, array + lo, hi - lo + 1);
+    }
+    // array[hint - 1] < val <= array[hint]: the hint was exact.
+    return hint;
+}
+
+int interpolation_search(int val, const int* array, int arr_len) {
+    if (array == NULL) {
+        fprintf(stderr, "ERROR - Cannot pass NULL as array");
+        return -1;
+    }
+    int lo = 0;
+    int hi = arr_len - 1;
+    while (lo <= hi && array[lo] <= val && val <= array[hi]) {
+        if (array[lo] == array[hi]) {
+            return lo; // val equals the whole range
+        }
+        // 64-bit: key differences can exceed INT_MAX.
+        long long span = (long long)array[hi] - array[lo];
+        int probe = lo + (int)(((long long)val - array[lo]) * (hi - lo) / span);
+        int size = hi - lo + 1;
+        if (array[probe] < val) {
+            lo = probe + 1;
+        }
+        else if (array[probe] > val) {
+            hi = probe - 1;
+        }
+        else {
+            return probe;
+        }
+        // Guard: skewed keys can make interpolation creep by one element per
+        // probe. If it did not halve the range, bisect once as well.
+        if (lo <= hi && hi - lo + 1 > size / 2) {
+            int mid = lo + (hi - lo) / 2;
+            if (array[mid] < val) {
+                lo = mid + 1;
+            }
+            else if (array[mid] > val) {
+                hi = mid - 1;
+            }
+            else {
+                return mid;
+            }
+        }
+    }
+    return -1;
+}
+
+void init_search_cursor(SearchCursor* cursor, const int* array, int arr_len) {
+    cursor->array = array;
+    cursor->len = (arr_len > 0) ? arr_len : 0;
+    cursor->pos = 0;
+}
+
+int cursor_lower_bound(SearchCursor* cursor, int val) {
+    if (cursor == NULL) {
+        fprintf(stderr, "ERROR - Cannot pass NULL as cursor");
+        return -1;
+    }
+    int found = gallop_lower_bound(val, cursor->array, cursor->len, cursor->pos);
+    if (found >= 0) {
+        cursor->pos = found;
+    }
+    return found;
+}
+
+int cursor_search(SearchCursor* cursor, int val) {
+    int found = cursor_lower_bound(cursor, val);
+    if (found < 0 || found == cursor->len || cursor->array[found] != val) {
+        return -1;
+    }
+    return found;
+}
+
+int eytzinger_fill(const int* sorted, Eytzinger* tree, int i, int k) {
+    // In-order walk of the implicit tree hands out the sorted keys in order.
+    if (k <= tree->len) {
+        i = eytzinger_fill(sorted, tree, i, 2 * k);
+        tree->keys[k] = sorted[i];
+        tree->positions[k] = i;
+        i++;
+        i = eytzinger_fill(sorted, tree, i, 2 * k + 1);
+    }
+    return i;
+}
+
+Eytzinger* create_eytzinger(const int* sorted, int len) {
+    if (len < 0 || (sorted == NULL && len > 0)) {
+        fprintf(stderr, "ERROR - Must pass a sorted array and a valid length");
+        return NULL;
+    }
+    Eytzinger* tree = malloc(sizeof(Eytzinger));
+    if (tree == NULL) {
+        fprintf(stderr, "ERROR - Could not malloc %lu bytes.\n", sizeof(Eytzinger));
+        return NULL;
+    }
+    // Cache-line alignment makes keys[16k..16k+15] (the great-great-grandchildren
+    // of k) exactly one line.
+    size_t bytes = ((size_t)(len + 1) * sizeof(int) + 63) / 64 * 64;
+    tree->keys = aligned_alloc(64, bytes);
+    tree->positions = malloc((size_t)(len + 1) * sizeof(int));
+    if (tree->keys == NULL || tree->positions == NULL) {
+        fprintf(stderr, "ERROR - Could not allocate an Eytzinger layout for %d keys.\n", len);
+        free(tree->keys);
+        free(tree->positions);
+        free(tree);
+        return NULL;
+    }
+    tree->len = len;
+    tree->keys[0] = 0;
+    tree->positions[0] = len;
+    eytzinger_fill(sorted, tree, 0, 1);
+    return tree;
+}
+
+void destroy_eytzinger(Eytzinger** tree) {
+    if (tree == NULL || *tree == NULL) {
+        return;
+    }
+    free((*tree)->keys);
+    free((*tree)->positions);
+    free(*tree);
+    *tree = NULL;
+}
+
+unsigned int eytzinger_lower_slot(int val, const Eytzinger* tree) {
+    // Slot of the first key >= val in BFS order, or 0 if every key is < val.
+    const int* keys = tree->keys;
+    unsigned int k = 1;
+    while (k <= (unsigned int)tree->len) {
+        // Four levels ahead: the 16 possible descendants share one cache line.
+        // Prefetching past the end is harmless, the hint cannot fault.
+        __builtin_prefetch(keys + (size_t)k * 16);
+        k = 2 * k + (keys[k] < val);
+    }
+    // k walked off the tree. Each right turn appended a 1 bit, each left turn a
+    // 0; the answer is where we last went left, so drop the trailing 1s and that 0.
+    return k >> __builtin_ffs(~k);
+}
+
+int eytzinger_lower_bound(int val, const Eytzinger* tree) {
+    if (tree == NULL) {
+        fprintf(stderr, "ERROR - Cannot pass NULL as tree");
+        return -1;
+    }
+    return tree->positions[eytzinger_lower_slot(val, tree)]; // positions[0] == len
+}
+
+int eytzinger_search(int val, const Eytzinger* tree) {
+    if (tree == NULL) {
+        fprintf(stderr, "ERROR - Cannot pass NULL as tree");
+        return -1;
+    }
+    unsigned int k = eytzinger_lower_slot(val, tree);
+    if (k == 0 || tree->keys[k] != val) {
+        return -1;
+    }
+    return tree->positions[k];
+}
+
+// === BATCHED SEARCH ===
+// A single search over a large array is a chain of dependent cache misses: the
+// next probe is unknown until the current load returns. Running many searches
+// side by side keeps several independent misses in flight at once.
+
+// Searches advanced in lockstep by the scalar path. Enough to cover memory
+// latency with one prefetch per search, few enough to keep their state in registers.
+#define BATCH_LANES 16
+// Sorted queries are merged with the array when m > BATCH_MERGE_FACTOR * sqrt(n).
+// The merge pays for the n/m elements between queries; a search pays for its
+// probes, which get dearer as the array outgrows the caches. Measured crossovers
+// were m = n at n = 10^4, m = n/10 at 10^6 and m = n/100 at 10^8.
+#define BATCH_MERGE_FACTOR 100
+
+void batch_finish(const int* queries, int m, const int* array, int n, const int* base, int* out) {
+    // base[j] is the lower_bound candidate left by the last halving step.
+    for (int j = 0; j < m; j++) {
+        int idx = base[j] + (array[base[j]] < queries[j]);
+        out[j] = (idx < n && array[idx] == queries[j]) ? idx : -1;
+    }
+}
+
+void binary_search_batch_interleaved(const int* queries, int m, const int* array, int n, int* out) {
+    // Every search over the same n takes the same sequence of halvings, so a
+    // group of lanes shares one loop counter. After each lane steps, its next
+    // probe is known and prefetched; by the time the other lanes have stepped,
+    // the line has arrived.
+    int base[BATCH_LANES];
+    for (int st = 0; st < m; st += BATCH_LANES) {
+        int lanes = (m - st < BATCH_LANES) ? m - st : BATCH_LANES;
+        const int* q = queries + st;
+        for (int j = 0; j < lanes; j++) {
+            base[j] = 0;
+        }
+        int len = n;
+        while (len > 1) {
+            int half = len / 2;
+            len -= half;
+            for (int j = 0; j < lanes; j++) {
+                base[j] += (array[base[j] + half - 1] < q[j]) ? half : 0;
+                __builtin_prefetch(&array[base[j] + len / 2 - 1]);
+            }
+        }
+        batch_finish(q, lanes, array, n, base, out + st);
+    }
+}
+
+#ifdef BINARY_SEARCH_HAVE_X86_SIMD
+
+// Vectors of 8 searches advanced together by the gather path.
+#define BATCH_VECTORS 4
+
+__attribute__((target("avx2")))
+void binary_search_batch_avx2(const int* queries, int m, const int* array, int n, int* out) {
+    // The same lockstep halving with 8 lanes per register: one gather loads all
+    // eight probes. Several independent vectors are interleaved so their
+    // gathers overlap; the tail that does not fill a group goes scalar.
+    int group = 8 * BATCH_VECTORS;
+    int full = m / group * group;
+    int base[8 * BATCH_VECTORS];
+    for (int st = 0; st < full; st += group) {
+        __m256i q[BATCH_VECTORS];
+        __m256i b[BATCH_VECTORS];
+        for (int v = 0; v < BATCH_VECTORS; v++) {
+            q[v] = _mm256_loadu_si256((const __m256i*)(queries + st + 8 * v));
+            b[v] = _mm256_setzero_si256();
+        }
+        int len = n;
+        while (len > 1) {
+            int half = len / 2;
+            len -= half;
+            __m256i step = _mm256_set1_epi32(half);
+            __m256i probe = _mm256_set1_epi32(half - 1);
+            for (int v = 0; v < BATCH_VECTORS; v++) {
+                __m256i keys = _mm256_i32gather_epi32(array, _mm256_add_epi32(b[v], probe), 4);
+                __m256i less = _mm256_cmpgt_epi32(q[v], keys);
+                b[v] = _mm256_add_epi32(b[v], _mm256_and_si256(less, step));
+            }
+        }
+        for (int v = 0; v < BATCH_VECTORS; v++) {
+            _mm256_storeu_si256((__m256i*)(base + 8 * v), b[v]);
+        }
+        batch_finish(queries + st, group, array, n, base, out + st);
+    }
+    binary_search_batch_interleaved(queries + full, m - full, array, n, out + full);
+}
+
+#endif
+
+int binary_search_has_simd() {
+#ifdef BINARY_SEARCH_HAVE_X86_SIMD
+    return __builtin_cpu_supports("avx2");
+#else
+    return 0;
+#endif
+}
+
+void binary_search_batch_merge(const int* queries, int m, const int* array, int n, int* out) {
+    // Queries in ascending order: one forward pass over both arrays, O(n + m),
+    // with purely sequential access that the hardware prefetcher follows.
+    int i = 0;
+    for (int j = 0; j < m; j++) {
+        while (i < n && array[i] < queries[j]) {
+            i++;
+        }
+        out[j] = (i < n && array[i] == queries[j]) ? i : -1;
+    }
+}
+
+int binary_search_batch(const int* queries, int m, const int* array, int n, int* out) {
+    if (m <= 0) {
+        return 0;
+    }
+    if (queries == NULL || out == NULL || (array == NULL && n > 0)) {
+        fprintf(stderr, "ERROR - Cannot pass NULL as queries, array or out");
+        return -1;
+    }
+    if (n <= 0) {
+        for (int j = 0; j < m; j++) {
+            out[j] = -1;
+        }
+        return 0;
+    }
+    // Checking the order is one sequential pass, cheap next to the search.
+    int sorted = 1;
+    for (int j = 1; j < m && sorted; j++) {
+        sorted = queries[j-1] <= queries[j];
+    }
+    if (sorted && (long long)m * m > (long long)BATCH_MERGE_FACTOR * BATCH_MERGE_FACTOR * n) {
+        binary_search_batch_merge(queries, m, array, n, out);
+    }
+#ifdef BINARY_SEARCH_HAVE_X86_SIMD
+    else if (binary_search_has_simd()) {
+        binary_search_batch_avx2(queries, m, array, n, out);
+    }
+#endif
+    else {
+        binary_search_batch_interleaved(queries, m, array, n, out);
+    }
+    return 0;
+}
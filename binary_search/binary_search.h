@@ -4,4 +4,69 @@
 int binary_search(int val, int* array, int arr_len);
 int recursive_bin_search(int val, int* array, int start, int end);
 
-#endif
\ No newline at end of file
+// Index of the first element >= val, or arr_len if there is none.
+// Branchless: the loop always runs ceil(log2(n)) times and picks each half with
+// a conditional move, so there are no mispredictions to pay for.
+int lower_bound(int val, const int* array, int arr_len);
+
+// lower_bound for lookups that land near a known position: searches outward
+// from hint in steps of 1, 2, 4, ... and then binary searches the last step.
+// O(log d) for an answer d positions from the hint. Any hint is valid; it is
+// clamped to [0, arr_len].
+int gallop_lower_bound(int val, const int* array, int arr_len, int hint);
+
+// Same contract as binary_search, for keys spread roughly evenly over their
+// range: probes where val should be by linear interpolation, O(log log n) on
+// uniform keys. A probe that fails to halve the range is followed by a plain
+// bisection, so skewed keys still take at most about 2 log2(n) probes.
+int interpolation_search(int val, const int* array, int arr_len);
+
+// Remembers where the last lookup landed and gallops from there, for query
+// sequences that are monotone or move a little at a time (merge joins, sweeps).
+typedef struct SearchCursor {
+    const int* array;
+    int len;
+    int pos; // Answer to the previous query
+} SearchCursor;
+
+void init_search_cursor(SearchCursor* cursor, const int* array, int arr_len);
+// Index of the first element >= val, or arr_len.
+int cursor_lower_bound(SearchCursor* cursor, int val);
+// Index of an element equal to val, or -1.
+int cursor_search(SearchCursor* cursor, int val);
+
+// Sorted keys stored in BFS (Eytzinger) order: node k has children 2k and 2k+1.
+// The top levels of the tree share a few cache lines, and the 16 descendants
+// four levels below a node are contiguous, so they can be prefetched in one go.
+typedef struct Eytzinger {
+    int* keys;      // keys[1..len] in BFS order, 64-byte aligned; keys[0] unused
+    int* positions; // positions[k] = index of keys[k] in the sorted input
+    int len;
+} Eytzinger;
+
+Eytzinger* create_eytzinger(const int* sorted, int len);
+void destroy_eytzinger(Eytzinger** tree);
+// Same result as lower_bound on the sorted input: an index into it, or len.
+int eytzinger_lower_bound(int val, const Eytzinger* tree);
+// Index in the sorted input of an element equal to val, or -1.
+int eytzinger_search(int val, const Eytzinger* tree);
+
+// Answers m membership queries against one sorted array: out[i] is the index of
+// the first element equal to queries[i], or -1 if there is none.
+// Searches run in interleaved groups (AVX2 gathers when the CPU has them), and
+// sorted queries are merged with the array when there are enough of them.
+// Returns 0, or -1 on invalid arguments. Build with -DBINARY_SEARCH_NO_SIMD to
+// compile the AVX2 path out.
+int binary_search_batch(const int* queries, int m, const int* array, int n, int* out);
+
+// The strategies binary_search_batch picks from, for benchmarks and tests.
+// They expect valid arguments and n > 0; the merge needs ascending queries.
+void binary_search_batch_interleaved(const int* queries, int m, const int* array, int n, int* out);
+void binary_search_batch_merge(const int* queries, int m, const int* array, int n, int* out);
+#if (defined(__x86_64__) || defined(__i386__)) && !defined(BINARY_SEARCH_NO_SIMD)
+// Only call when binary_search_has_simd() is true.
+void binary_search_batch_avx2(const int* queries, int m, const int* array, int n, int* out);
+#endif
+int binary_search_has_simd();
+
+#endif
@@ -0,0 +1,174 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <math.h>
+#include "binary_search.h"
+#include "learned_index.h"
+
+int learned_add_segment(LearnedIndex* index, int* capacity, int key, int start, double slope) {
+    if (index->num_segments == *capacity) {
+        int grown = *capacity * 2;
+        int* keys = realloc(index->seg_keys, grown * sizeof(int));
+        if (keys != NULL) index->seg_keys = keys;
+        int* starts = realloc(index->seg_starts, grown * sizeof(int));
+        if (starts != NULL) index->seg_starts = starts;
+        double* slopes = realloc(index->slopes, grown * sizeof(double));
+        if (slopes != NULL) index->slopes = slopes;
+        if (keys == NULL || starts == NULL || slopes == NULL) {
+            fprintf(stderr, "ERROR - Could not grow the learned index to %d segments.\n", grown);
+            return -1;
+        }
+        *capacity = grown;
+    }
+    index->seg_keys[index->num_segments] = key;
+    index->seg_starts[index->num_segments] = start;
+    index->slopes[index->num_segments] = slope;
+    index->num_segments++;
+    return 0;
+}
+
+int learned_fit(LearnedIndex* index) {
+    // Shrinking cone. A segment starts at the point (x0, y0); every later point
+    // (x, y) allows slopes in [(y - eps - y0) / (x - x0), (y + eps - y0) / (x - x0)].
+    // The intersection of those ranges is the cone. When a point empties it, the
+    // segment is closed with the middle slope and a new one starts at that point.
+    // Only the first of several equal keys is a point, so predictions aim at the
+    // lower bound.
+    const int* array = index->array;
+    int capacity = 16;
+    index->seg_keys = malloc(capacity * sizeof(int));
+    index->seg_starts = malloc(capacity * sizeof(int));
+    index->slopes = malloc(capacity * sizeof(double));
+    if (index->seg_keys == NULL || index->seg_starts == NULL || index->slopes == NULL) {
+        fprintf(stderr, "ERROR - Could not allocate the learned index segments.\n");
+        return -1;
+    }
+    if (index->len == 0) {
+        return 0;
+    }
+    double eps = index->epsilon;
+    int x0 = array[0];
+    int y0 = 0;
+    double slope_lo = 0;
+    double slope_hi = INFINITY;
+    for (int i = 1; i < index->len; i++) {
+        if (array[i] == array[i - 1]) {
+            continue;
+        }
+        double dx = (double)array[i] - x0;
+        double lo = fmax(slope_lo, (i - eps - y0) / dx);
+        double hi = fmin(slope_hi, (i + eps - y0) / dx);
+        if (lo <= hi) {
+            slope_lo = lo;
+            slope_hi = hi;
+            continue;
+        }
+        if (learned_add_segment(index, &capacity, x0, y0, (slope_lo + slope_hi) / 2) != 0) {
+            return -1;
+        }
+        x0 = array[i];
+        y0 = i;
+        slope_lo = 0;
+        slope_hi = INFINITY;
+    }
+    // A segment with a single distinct key never narrowed its cone.
+    double slope = isinf(slope_hi) ? 0 : (slope_lo + slope_hi) / 2;
+    return learned_add_segment(index, &capacity, x0, y0, slope);
+}
+
+LearnedIndex* create_learned_index(const int* sorted, int len, int epsilon) {
+    if (len < 0 || (sorted == NULL && len > 0) || epsilon < 1) {
+        fprintf(stderr, "ERROR - Must pass a sorted array, a valid length and epsilon >= 1");
+        return NULL;
+    }
+    LearnedIndex* index = calloc(1, sizeof(LearnedIndex));
+    if (index == NULL) {
+        fprintf(stderr, "ERROR - Could not malloc %lu bytes.\n", sizeof(LearnedIndex));
+        return NULL;
+    }
+    index->array = sorted;
+    index->len = len;
+    index->epsilon = epsilon;
+    if (learned_fit(index) != 0) {
+        destroy_learned_index(&index);
+        return NULL;
+    }
+    return index;
+}
+
+void destroy_learned_index(LearnedIndex** index) {
+    if (index == NULL || *index == NULL) {
+        return;
+    }
+    free((*index)->seg_keys);
+    free((*index)->seg_starts);
+    free((*index)->slopes);
+    free(*index);
+    *index = NULL;
+}
+
+int learned_lower_bound(int val, const LearnedIndex* index) {
+    if (index == NULL) {
+        fprintf(stderr, "ERROR - Cannot pass NULL as index");
+        return -1;
+    }
+    if (index->len == 0) {
+        return 0;
+    }
+    // The last segment whose first key is <= val.
+    int s = lower_bound(val, index->seg_keys, index->num_segments);
+    if (s == index->num_segments || index->seg_keys[s] != val) {
+        s--;
+    }
+    if (s < 0) {
+        return 0; // val is below every key
+    }
+    // The answer lies between this segment's first key and the next one's.
+    int start = index->seg_starts[s];
+    int end = (s + 1 < index->num_segments) ? index->seg_starts[s + 1] : index->len;
+    double predicted = start + index->slopes[s] * ((double)val - index->seg_keys[s]);
+    // A steep segment (duplicates or a wide epsilon) can predict far past its
+    // end for a val well above its keys; clamp before converting to int.
+    predicted = fmin(fmax(predicted, start), end);
+    // Truncation and keys between two points can each add one position of error.
+    double lo = fmax(predicted - index->epsilon - 1, start);
+    double hi = fmin(predicted + index->epsilon + 2, end);
+    int window_lo = (int)lo;
+    int window_hi = (int)hi;
+    if (window_lo > window_hi) {
+        window_lo = window_hi;
+    }
+    const int* array = index->array;
+    // The window is a few adjacent cache lines. Requesting them all at once
+    // overlaps their misses, instead of paying for one per halving step.
+    for (int i = window_lo; i < window_hi; i += 16) {
+        __builtin_prefetch(&array[i]);
+    }
+    if (window_hi > window_lo) {
+        __builtin_prefetch(&array[window_hi - 1]);
+    }
+    int found = window_lo + lower_bound(val, array + window_lo, window_hi - window_lo);
+    // The guarantee covers the keys themselves. A missing key just past a long
+    // run of duplicates can land outside the window; widen to the segment.
+    if (found == window_hi && window_hi < end) {
+        found = window_hi + lower_bound(val, array + window_hi, end - window_hi);
+    }
+    else if (found == window_lo && window_lo > start && array[window_lo - 1] >= val) {
+        found = start + lower_bound(val, array + start, window_lo - start);
+    }
+    return found;
+}
+
+int learned_search(int val, const LearnedIndex* index) {
+    int found = learned_lower_bound(val, index);
+    if (found < 0 || found == index->len || index->array[found] != val) {
+        return -1;
+    }
+    return found;
+}
+
+size_t learned_index_bytes(const LearnedIndex* index) {
+    if (index == NULL) {
+        return 0;
+    }
+    return sizeof(LearnedIndex) + (size_t)index->num_segments * (2 * sizeof(int) + sizeof(double));
+}
@@ -0,0 +1,36 @@
+#ifndef LEARNED_INDEX_H
+#define LEARNED_INDEX_H
+
+#include <stddef.h>
+
+// Learned index over a sorted int array, in the style of the PGM index. The
+// keys are covered by linear segments, each predicting the position of a key
+// from its value to within epsilon. A lookup finds the segment, evaluates it,
+// and finishes with lower_bound over about 2 * epsilon elements instead of
+// searching the whole array. Smooth data needs few segments: evenly spaced
+// keys need exactly one.
+//
+// The index does not copy the keys; the array must outlive it unchanged.
+
+typedef struct LearnedIndex {
+    const int* array;  // The indexed keys
+    int len;
+    int epsilon;       // Maximum prediction error, in positions
+    int num_segments;
+    int* seg_keys;     // First key covered by each segment, ascending
+    int* seg_starts;   // Position of that key in array
+    double* slopes;    // Positions per unit of key within each segment
+} LearnedIndex;
+
+// Fits the segments in one pass. epsilon must be at least 1.
+LearnedIndex* create_learned_index(const int* sorted, int len, int epsilon);
+void destroy_learned_index(LearnedIndex** index);
+
+// Index of the first key >= val, or len.
+int learned_lower_bound(int val, const LearnedIndex* index);
+// Index of an element equal to val, or -1.
+int learned_search(int val, const LearnedIndex* index);
+// Bytes used by the index itself, not counting the keys.
+size_t learned_index_bytes(const LearnedIndex* index);
+
+#endif
@@ -0,0 +1,155 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <limits.h>
+#include "splus_tree.h"
+
+#if (defined(__x86_64__) || defined(__i386__)) && !defined(BINARY_SEARCH_NO_SIMD)
+#include <immintrin.h>
+#define SPLUS_HAVE_X86_SIMD 1
+#endif
+
+SPlusTree* create_splus_tree(const int* sorted, int len) {
+    if (len < 0 || (sorted == NULL && len > 0)) {
+        fprintf(stderr, "ERROR - Must pass a sorted array and a valid length");
+        return NULL;
+    }
+    SPlusTree* tree = malloc(sizeof(SPlusTree));
+    if (tree == NULL) {
+        fprintf(stderr, "ERROR - Could not malloc %lu bytes.\n", sizeof(SPlusTree));
+        return NULL;
+    }
+    // Node counts per layer, leaves up. An empty input still gets one leaf so
+    // queries need no special case.
+    long long counts[SPLUS_MAX_HEIGHT];
+    long long leaves = (len + SPLUS_NODE_KEYS - 1) / SPLUS_NODE_KEYS;
+    counts[0] = (leaves > 0) ? leaves : 1;
+    int height = 1;
+    while (counts[height - 1] > 1) {
+        counts[height] = (counts[height - 1] + SPLUS_FANOUT - 1) / SPLUS_FANOUT;
+        height++;
+    }
+    // Root first: the small top layers sit together and stay cached.
+    long long total = 0;
+    for (int h = height - 1; h >= 0; h--) {
+        tree->offsets[h] = (int)total;
+        total += counts[h];
+    }
+    tree->keys = aligned_alloc(64, total * SPLUS_NODE_KEYS * sizeof(int));
+    if (tree->keys == NULL) {
+        fprintf(stderr, "ERROR - Could not allocate an S+-tree for %d keys.\n", len);
+        free(tree);
+        return NULL;
+    }
+    tree->height = height;
+    tree->len = len;
+
+    // The leaves are the input, padded with INT_MAX. Padding is never < val,
+    // so it never pulls a search to the right.
+    int* leaf_keys = tree->keys + (long long)tree->offsets[0] * SPLUS_NODE_KEYS;
+    if (len > 0) {
+        memcpy(leaf_keys, sorted, len * sizeof(int));
+    }
+    for (long long i = len; i < counts[0] * SPLUS_NODE_KEYS; i++) {
+        leaf_keys[i] = INT_MAX;
+    }
+    // Key j of an internal node is the smallest key under its child j + 1,
+    // which is the first key of that subtree's leftmost leaf.
+    long long span = 1; // Leaves under one node of layer h - 1
+    for (int h = 1; h < height; h++) {
+        int* layer = tree->keys + (long long)tree->offsets[h] * SPLUS_NODE_KEYS;
+        for (long long k = 0; k < counts[h]; k++) {
+            for (int j = 0; j < SPLUS_NODE_KEYS; j++) {
+                long long leaf = (k * SPLUS_FANOUT + j + 1) * span;
+                layer[k * SPLUS_NODE_KEYS + j] = (leaf < counts[0]) ? leaf_keys[leaf * SPLUS_NODE_KEYS] : INT_MAX;
+            }
+        }
+        span *= SPLUS_FANOUT;
+    }
+    return tree;
+}
+
+void destroy_splus_tree(SPlusTree** tree) {
+    if (tree == NULL || *tree == NULL) {
+        return;
+    }
+    free((*tree)->keys);
+    free(*tree);
+    *tree = NULL;
+}
+
+// Descends one node per layer taking child i, where i is the number of node
+// keys < val. That child's keys start below val and its right sibling's are all
+// >= val, so the answer is in the child or is the first key after it. In the
+// leaf layer, which is the input in order, both cases are the leaf's position
+// plus its count.
+
+int splus_descend_scalar(int val, const SPlusTree* tree) {
+    long long k = 0;
+    for (int h = tree->height - 1; h >= 0; h--) {
+        const int* node = tree->keys + (tree->offsets[h] + k) * SPLUS_NODE_KEYS;
+        int i = 0;
+        for (int j = 0; j < SPLUS_NODE_KEYS; j++) {
+            i += node[j] < val;
+        }
+        k = k * ((h > 0) ? SPLUS_FANOUT : SPLUS_NODE_KEYS) + i;
+    }
+    return (k < tree->len) ? (int)k : tree->len;
+}
+
+#ifdef SPLUS_HAVE_X86_SIMD
+
+__attribute__((target("avx2,popcnt")))
+int splus_descend_avx2(int val, const SPlusTree* tree) {
+    __m256i x = _mm256_set1_epi32(val);
+    long long k = 0;
+    for (int h = tree->height - 1; h >= 0; h--) {
+        const int* node = tree->keys + (tree->offsets[h] + k) * SPLUS_NODE_KEYS;
+        __m256i lo = _mm256_cmpgt_epi32(x, _mm256_load_si256((const __m256i*)node));
+        __m256i hi = _mm256_cmpgt_epi32(x, _mm256_load_si256((const __m256i*)(node + 8)));
+        // Packing to 16 bits leaves 2 mask bits per key that compared true.
+        unsigned int mask = (unsigned int)_mm256_movemask_epi8(_mm256_packs_epi32(lo, hi));
+        int i = __builtin_popcount(mask) / 2;
+        k = k * ((h > 0) ? SPLUS_FANOUT : SPLUS_NODE_KEYS) + i;
+    }
+    return (k < tree->len) ? (int)k : tree->len;
+}
+
+#endif
+
+int splus_lower_bound(int val, const SPlusTree* tree) {
+    if (tree == NULL) {
+        fprintf(stderr, "ERROR - Cannot pass NULL as tree");
+        return -1;
+    }
+#ifdef SPLUS_HAVE_X86_SIMD
+    if (__builtin_cpu_supports("avx2")) {
+        return splus_descend_avx2(val, tree);
+    }
+#endif
+    return splus_descend_scalar(val, tree);
+}
+
+int splus_upper_bound(int val, const SPlusTree* tree) {
+    if (tree == NULL) {
+        fprintf(stderr, "ERROR - Cannot pass NULL as tree");
+        return -1;
+    }
+    // The first key > val is the first key >= val + 1.
+    return (val == INT_MAX) ? tree->len : splus_lower_bound(val + 1, tree);
+}
+
+int splus_equal_range(int val, const SPlusTree* tree, int* first, int* last) {
+    if (tree == NULL || first == NULL || last == NULL) {
+        fprintf(stderr, "ERROR - Cannot pass NULL as tree, first or last");
+        return -1;
+    }
+    *first = splus_lower_bound(val, tree);
+    *last = splus_upper_bound(val, tree);
+    return *last - *first;
+}
+
+int splus_rank(int val, const SPlusTree* tree) {
+    // The leaves are the input in order, so the lower bound index is the count.
+    return splus_lower_bound(val, tree);
+}
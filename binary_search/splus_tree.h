@@ -0,0 +1,37 @@
+#ifndef SPLUS_TREE_H
+#define SPLUS_TREE_H
+
+// Static S+-tree: a read-only B+-tree over sorted ints, built once and queried
+// many times. Every node is 16 keys, one 64-byte cache line, compared with
+// SIMD in a couple of instructions. The layout is implicit: node k of a layer
+// has children k*17 .. k*17+16 in the layer below, so there are no pointers.
+// The bottom layer is the sorted input itself, padded to whole nodes, which
+// makes every answer an index into the input. A lookup touches one line per
+// layer, about log17(n) of them instead of log2(n).
+
+#define SPLUS_NODE_KEYS 16
+#define SPLUS_FANOUT (SPLUS_NODE_KEYS + 1)
+// 17^8 leaves is far beyond INT_MAX keys.
+#define SPLUS_MAX_HEIGHT 10
+
+typedef struct SPlusTree {
+    int* keys;                       // All layers, root first, 64-byte aligned
+    int offsets[SPLUS_MAX_HEIGHT];   // First node of each layer; layer 0 is the leaves
+    int height;                      // Number of layers
+    int len;                         // Number of keys in the input
+} SPlusTree;
+
+SPlusTree* create_splus_tree(const int* sorted, int len);
+void destroy_splus_tree(SPlusTree** tree);
+
+// Index in the sorted input of the first key >= val, or len.
+int splus_lower_bound(int val, const SPlusTree* tree);
+// Index in the sorted input of the first key > val, or len.
+int splus_upper_bound(int val, const SPlusTree* tree);
+// Keys equal to val are at [*first, *last); the range is empty if there are none.
+// Returns the number of them, or -1 on invalid arguments.
+int splus_equal_range(int val, const SPlusTree* tree, int* first, int* last);
+// Number of keys < val.
+int splus_rank(int val, const SPlusTree* tree);
+
+#endif
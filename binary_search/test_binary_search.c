@@ -1,7 +1,15 @@
 #include <stdio.h>
+#include <stdlib.h>
 #include <assert.h>
 #include "binary_search.h"
 
+// Reference: first index with array[i] >= val, by linear scan.
+int linear_lower_bound(int val, const int* array, int len) {
+    int i = 0;
+    while (i < len && array[i] < val) i++;
+    return i;
+}
+
 void test_single_element() {
     printf("Testing single element array...\n");
     int arr[] = {5};
@@ -125,6 +133,192 @@ void test_recursive_larger_array() {
     printf("SUCCESS - Recursive larger array tests passed\n");
 }
 
+void test_lower_bound() {
+    printf("Testing lower_bound...\n");
+    int arr[] = {1, 3, 3, 3, 5, 7};
+
+    assert(lower_bound(0, arr, 6) == 0);
+    assert(lower_bound(1, arr, 6) == 0);
+    assert(lower_bound(3, arr, 6) == 1);  // First of the duplicates
+    assert(lower_bound(4, arr, 6) == 4);
+    assert(lower_bound(7, arr, 6) == 5);
+    assert(lower_bound(8, arr, 6) == 6);  // Past the end
+    assert(lower_bound(5, arr, 0) == 0);
+    assert(lower_bound(5, NULL, 3) == -1);
+
+    // Every size up to 200, with duplicates, against a linear scan.
+    int big[200];
+    for (int len = 1; len <= 200; len++) {
+        for (int i = 0; i < len; i++) big[i] = (i / 3) * 2;
+        for (int val = -1; val <= len; val++) {
+            assert(lower_bound(val, big, len) == linear_lower_bound(val, big, len));
+        }
+    }
+    printf("SUCCESS - lower_bound tests passed\n");
+}
+
+void test_eytzinger() {
+    printf("Testing Eytzinger layout...\n");
+    int big[300];
+    for (int len = 0; len <= 300; len++) {
+        for (int i = 0; i < len; i++) big[i] = (i / 2) * 3 - 50;
+        Eytzinger* tree = create_eytzinger(big, len);
+        assert(tree != NULL && tree->len == len);
+        for (int val = -52; val <= len * 2; val++) {
+            int expected = linear_lower_bound(val, big, len);
+            assert(eytzinger_lower_bound(val, tree) == expected);
+            int found = eytzinger_search(val, tree);
+            if (expected < len && big[expected] == val) {
+                assert(found >= 0 && big[found] == val);
+            }
+            else {
+                assert(found == -1);
+            }
+        }
+        destroy_eytzinger(&tree);
+        assert(tree == NULL);
+    }
+
+    // Extreme keys.
+    int extremes[] = {-2147483647 - 1, 0, 2147483647};
+    Eytzinger* tree = create_eytzinger(extremes, 3);
+    assert(eytzinger_search(-2147483647 - 1, tree) == 0);
+    assert(eytzinger_search(2147483647, tree) == 2);
+    assert(eytzinger_lower_bound(1, tree) == 2);
+    destroy_eytzinger(&tree);
+
+    assert(create_eytzinger(NULL, 5) == NULL);
+    assert(eytzinger_lower_bound(1, NULL) == -1);
+    printf("SUCCESS - Eytzinger tests passed\n");
+}
+
+void test_gallop_lower_bound() {
+    printf("Testing gallop_lower_bound...\n");
+    int big[200];
+    for (int len = 0; len <= 200; len += 3) {
+        for (int i = 0; i < len; i++) big[i] = (i / 3) * 2;
+        for (int val = -1; val <= len; val++) {
+            int expected = linear_lower_bound(val, big, len);
+            // Every hint, including ones outside the array.
+            for (int hint = -2; hint <= len + 2; hint++) {
+                assert(gallop_lower_bound(val, big, len, hint) == expected);
+            }
+        }
+    }
+    assert(gallop_lower_bound(1, NULL, 5, 0) == -1);
+    printf("SUCCESS - gallop_lower_bound tests passed\n");
+}
+
+void test_interpolation_search() {
+    printf("Testing interpolation_search...\n");
+    int arr[] = {1, 3, 5, 7, 9, 11, 13, 15, 17, 19};
+    for (int i = 0; i < 10; i++) {
+        assert(interpolation_search(arr[i], arr, 10) == i);
+        assert(interpolation_search(arr[i] + 1, arr, 10) == -1);
+    }
+    assert(interpolation_search(0, arr, 10) == -1);
+    assert(interpolation_search(5, arr, 0) == -1);
+    assert(interpolation_search(5, NULL, 10) == -1);
+
+    // Skewed keys (squares and a huge outlier) and duplicates.
+    int skewed[1000];
+    for (int i = 0; i < 999; i++) skewed[i] = (i / 2) * (i / 2);
+    skewed[999] = 2147483647;
+    for (int val = -1; val < 250000; val += 7) {
+        int found = interpolation_search(val, skewed, 1000);
+        int expected = linear_lower_bound(val, skewed, 1000);
+        if (skewed[expected] == val) {
+            assert(found >= 0 && skewed[found] == val);
+        }
+        else {
+            assert(found == -1);
+        }
+    }
+    assert(interpolation_search(2147483647, skewed, 1000) == 999);
+    int extremes[] = {-2147483647 - 1, 0, 2147483647};
+    assert(interpolation_search(-2147483647 - 1, extremes, 3) == 0);
+    assert(interpolation_search(0, extremes, 3) == 1);
+    assert(interpolation_search(-1, extremes, 3) == -1);
+    printf("SUCCESS - interpolation_search tests passed\n");
+}
+
+void test_search_cursor() {
+    printf("Testing search cursor...\n");
+    int big[500];
+    for (int i = 0; i < 500; i++) big[i] = (i / 2) * 4;
+    SearchCursor cursor;
+    init_search_cursor(&cursor, big, 500);
+    // Ascending, then a jump back, then random.
+    for (int val = -3; val < 1010; val += 3) {
+        assert(cursor_lower_bound(&cursor, val) == linear_lower_bound(val, big, 500));
+    }
+    assert(cursor_lower_bound(&cursor, 8) == 4);
+    assert(cursor_search(&cursor, 9) == -1);
+    srand(5);
+    for (int q = 0; q < 2000; q++) {
+        int val = rand() % 1010 - 5;
+        int expected = linear_lower_bound(val, big, 500);
+        int found = cursor_search(&cursor, val);
+        assert(found == ((expected < 500 && big[expected] == val) ? expected : -1));
+    }
+    init_search_cursor(&cursor, NULL, 0);
+    assert(cursor_lower_bound(&cursor, 3) == 0 && cursor_search(&cursor, 3) == -1);
+    assert(cursor_lower_bound(NULL, 3) == -1);
+    printf("SUCCESS - search cursor tests passed\n");
+}
+
+// Expected batch answer: first index equal to val, or -1.
+int expected_member(int val, const int* array, int len) {
+    int i = linear_lower_bound(val, array, len);
+    return (i < len && array[i] == val) ? i : -1;
+}
+
+void test_binary_search_batch() {
+    printf("Testing binary_search_batch...\n");
+    int array[1000];
+    int queries[500];
+    int out[500];
+    for (int len = 1; len <= 1000; len = len * 3 + 1) {
+        for (int i = 0; i < len; i++) array[i] = (i / 2) * 3;
+        for (int m = 1; m <= 500; m += 37) {
+            // Unsorted queries, hits and misses, including below and above the array.
+            srand(len * 1000 + m);
+            for (int j = 0; j < m; j++) queries[j] = rand() % (len * 2 + 4) - 2;
+            assert(binary_search_batch(queries, m, array, len, out) == 0);
+            for (int j = 0; j < m; j++) assert(out[j] == expected_member(queries[j], array, len));
+            binary_search_batch_interleaved(queries, m, array, len, out);
+            for (int j = 0; j < m; j++) assert(out[j] == expected_member(queries[j], array, len));
+#if (defined(__x86_64__) || defined(__i386__)) && !defined(BINARY_SEARCH_NO_SIMD)
+            if (binary_search_has_simd()) {
+                binary_search_batch_avx2(queries, m, array, len, out);
+                for (int j = 0; j < m; j++) assert(out[j] == expected_member(queries[j], array, len));
+            }
+#endif
+
+            // Sorted queries, with repeats, through the dispatcher and the merge.
+            for (int j = 0; j < m; j++) queries[j] = (j * len * 2) / m - 1;
+            assert(binary_search_batch(queries, m, array, len, out) == 0);
+            for (int j = 0; j < m; j++) assert(out[j] == expected_member(queries[j], array, len));
+            binary_search_batch_merge(queries, m, array, len, out);
+            for (int j = 0; j < m; j++) assert(out[j] == expected_member(queries[j], array, len));
+        }
+    }
+
+    // Extreme keys.
+    int extremes[] = {-2147483647 - 1, 0, 2147483647};
+    int extreme_queries[] = {2147483647, -2147483647 - 1, 1, 0};
+    assert(binary_search_batch(extreme_queries, 4, extremes, 3, out) == 0);
+    assert(out[0] == 2 && out[1] == 0 && out[2] == -1 && out[3] == 1);
+
+    // Empty array and invalid arguments.
+    assert(binary_search_batch(queries, 3, NULL, 0, out) == 0);
+    assert(out[0] == -1 && out[2] == -1);
+    assert(binary_search_batch(queries, 0, array, 10, NULL) == 0);
+    assert(binary_search_batch(NULL, 3, array, 10, out) == -1);
+    assert(binary_search_batch(queries, 3, array, 10, NULL) == -1);
+    printf("SUCCESS - binary_search_batch tests passed\n");
+}
+
 int main() {
     printf("Running binary search tests...\n\n");
     
@@ -140,6 +334,18 @@ int main() {
     test_recursive_edge_cases();
     test_recursive_larger_array();
     
+    printf("\n=== LOWER BOUND TESTS ===\n");
+    test_lower_bound();
+    test_eytzinger();
+
+    printf("\n=== GALLOPING AND INTERPOLATION TESTS ===\n");
+    test_gallop_lower_bound();
+    test_interpolation_search();
+    test_search_cursor();
+
+    printf("\n=== BATCH TESTS ===\n");
+    test_binary_search_batch();
+    
     printf("\nSUCCESS - All tests passed!\n");
     return 0;
 }
\ No newline at end of file
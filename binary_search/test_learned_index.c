@@ -0,0 +1,154 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <assert.h>
+#include <limits.h>
+#include "binary_search.h"
+#include "learned_index.h"
+
+// Checks every value from min - 2 to max + 2 (or a sample of them on a wide
+// range) against lower_bound on the plain array.
+void check_against_lower_bound(const int* keys, int len, int epsilon) {
+    LearnedIndex* index = create_learned_index(keys, len, epsilon);
+    assert(index != NULL);
+    assert(index->num_segments <= len);
+    long long min = (len > 0) ? keys[0] : 0;
+    long long max = (len > 0) ? keys[len - 1] : 0;
+    long long step = (max - min) / 200000 + 1;
+    for (long long val = min - 2; val <= max + 2; val += step) {
+        if (val < INT_MIN || val > INT_MAX) continue;
+        int expected = lower_bound((int)val, keys, len);
+        assert(learned_lower_bound((int)val, index) == expected);
+        int found = learned_search((int)val, index);
+        if (expected < len && keys[expected] == val) {
+            assert(found == expected);
+        }
+        else {
+            assert(found == -1);
+        }
+    }
+    // Every key itself, including the first of each run of duplicates.
+    for (int i = 0; i < len; i++) {
+        assert(learned_lower_bound(keys[i], index) == lower_bound(keys[i], keys, len));
+    }
+    destroy_learned_index(&index);
+    assert(index == NULL);
+}
+
+void test_linear_keys() {
+    printf("Testing evenly spaced keys...\n");
+    int len = 100000;
+    int* keys = malloc(len * sizeof(int));
+    for (int i = 0; i < len; i++) keys[i] = 7 * i - 1000;
+    // A straight line fits in one segment whatever epsilon is.
+    LearnedIndex* index = create_learned_index(keys, len, 1);
+    assert(index->num_segments == 1);
+    assert(learned_lower_bound(-1000, index) == 0);
+    assert(learned_lower_bound(7 * 500 - 1000, index) == 500);
+    assert(learned_lower_bound(7 * 500 - 999, index) == 501);
+    assert(learned_lower_bound(INT_MAX, index) == len);
+    assert(learned_lower_bound(INT_MIN, index) == 0);
+    destroy_learned_index(&index);
+    check_against_lower_bound(keys, len, 4);
+    free(keys);
+    printf("SUCCESS - Evenly spaced key tests passed\n");
+}
+
+void test_random_keys() {
+    printf("Testing random and piecewise keys...\n");
+    int len = 200000;
+    int* keys = malloc(len * sizeof(int));
+    srand(11);
+    // Sorted random gaps: noisy but roughly linear.
+    keys[0] = 0;
+    for (int i = 1; i < len; i++) keys[i] = keys[i - 1] + rand() % 100;
+    int epsilons[] = {1, 8, 64, 1024};
+    for (int e = 0; e < 4; e++) {
+        check_against_lower_bound(keys, len, epsilons[e]);
+    }
+    // Pieces of very different density, quadratic growth and long duplicate runs.
+    for (int i = 0; i < len; i++) {
+        if (i < len / 4) keys[i] = i;
+        else if (i < len / 2) keys[i] = len + (i - len / 4) * 1000;
+        else if (i < 3 * len / 4) keys[i] = keys[len / 2 - 1] + (i / 5000) * 3;
+        else keys[i] = keys[3 * len / 4 - 1] + (int)((long long)(i - 3 * len / 4) * (i - 3 * len / 4) / 64);
+    }
+    for (int e = 0; e < 4; e++) {
+        check_against_lower_bound(keys, len, epsilons[e]);
+    }
+    free(keys);
+    printf("SUCCESS - Random and piecewise key tests passed\n");
+}
+
+void test_small_and_extreme() {
+    printf("Testing small inputs and extreme keys...\n");
+    int keys[300];
+    for (int len = 0; len <= 300; len += 7) {
+        for (int i = 0; i < len; i++) keys[i] = (i / 4) * 5;
+        check_against_lower_bound(keys, len, 1);
+        check_against_lower_bound(keys, len, 3);
+    }
+    int extremes[] = {INT_MIN, INT_MIN, -5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, INT_MAX, INT_MAX};
+    LearnedIndex* index = create_learned_index(extremes, 17, 1);
+    assert(learned_lower_bound(INT_MIN, index) == 0);
+    assert(learned_lower_bound(INT_MIN + 1, index) == 2);
+    assert(learned_lower_bound(0, index) == 3);
+    assert(learned_lower_bound(1, index) == 14);
+    assert(learned_lower_bound(2, index) == 15);
+    assert(learned_lower_bound(INT_MAX, index) == 15);
+    assert(learned_search(-4, index) == -1);
+    assert(learned_index_bytes(index) > sizeof(LearnedIndex));
+    destroy_learned_index(&index);
+
+    assert(create_learned_index(NULL, 5, 4) == NULL);
+    assert(create_learned_index(extremes, 17, 0) == NULL);
+    assert(learned_lower_bound(1, NULL) == -1);
+    assert(learned_search(1, NULL) == -1);
+    assert(learned_index_bytes(NULL) == 0);
+    printf("SUCCESS - Small input and extreme key tests passed\n");
+}
+
+void test_steep_segments() {
+    printf("Testing steep segments and values above the keys...\n");
+    int len = 1000;
+    int* keys = malloc(len * sizeof(int));
+    int runs[] = {4, 16, 250};
+    int epsilons[] = {1, 16, 64};
+    int above[] = {1000, 1000000, 1000000000, INT_MAX};
+    for (int r = 0; r < 3; r++) {
+        // Heavy duplicates give slopes of 1 and more.
+        for (int i = 0; i < len; i++) keys[i] = i / runs[r];
+        for (int e = 0; e < 3; e++) {
+            check_against_lower_bound(keys, len, epsilons[e]);
+            LearnedIndex* index = create_learned_index(keys, len, epsilons[e]);
+            for (int a = 0; a < 4; a++) {
+                assert(learned_lower_bound(above[a], index) == len);
+                assert(learned_search(above[a], index) == -1);
+            }
+            destroy_learned_index(&index);
+        }
+    }
+    // Every segment but the last: a val between two segments' keys and far
+    // above the earlier one's.
+    for (int i = 0; i < len; i++) keys[i] = (i < len / 2) ? i / 8 : 100000000 + i;
+    for (int e = 0; e < 3; e++) {
+        LearnedIndex* index = create_learned_index(keys, len, epsilons[e]);
+        for (int val = 0; val < 100000100; val += 99991) {
+            assert(learned_lower_bound(val, index) == lower_bound(val, keys, len));
+        }
+        destroy_learned_index(&index);
+    }
+    free(keys);
+    printf("SUCCESS - Steep segment tests passed\n");
+}
+
+int main() {
+    printf("Running learned index tests...\n\n");
+
+    test_linear_keys();
+    test_random_keys();
+    test_small_and_extreme();
+    test_steep_segments();
+
+    printf("\nSUCCESS - All learned index tests passed!\n");
+    return 0;
+}
@@ -0,0 +1,118 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <assert.h>
+#include <limits.h>
+#include "splus_tree.h"
+
+// Reference: first index with array[i] >= val, by linear scan.
+int linear_lower_bound(int val, const int* array, int len) {
+    int i = 0;
+    while (i < len && array[i] < val) i++;
+    return i;
+}
+
+// Reference: first index with array[i] > val, by linear scan.
+int linear_upper_bound(int val, const int* array, int len) {
+    int i = 0;
+    while (i < len && array[i] <= val) i++;
+    return i;
+}
+
+void test_small_trees() {
+    printf("Testing small S+-trees...\n");
+    int arr[] = {1, 3, 3, 3, 5, 7};
+    SPlusTree* tree = create_splus_tree(arr, 6);
+    assert(tree != NULL && tree->height == 1);
+    assert(splus_lower_bound(0, tree) == 0);
+    assert(splus_lower_bound(3, tree) == 1);
+    assert(splus_upper_bound(3, tree) == 4);
+    assert(splus_lower_bound(8, tree) == 6);
+    assert(splus_rank(5, tree) == 4);
+    int first, last;
+    assert(splus_equal_range(3, tree, &first, &last) == 3);
+    assert(first == 1 && last == 4);
+    assert(splus_equal_range(4, tree, &first, &last) == 0);
+    assert(first == 4 && last == 4);
+    destroy_splus_tree(&tree);
+    assert(tree == NULL);
+
+    // Empty input.
+    tree = create_splus_tree(NULL, 0);
+    assert(tree != NULL);
+    assert(splus_lower_bound(5, tree) == 0 && splus_upper_bound(5, tree) == 0);
+    destroy_splus_tree(&tree);
+    printf("SUCCESS - Small S+-tree tests passed\n");
+}
+
+void test_all_sizes() {
+    // Every size up to 700 crosses the one-leaf, two-layer and three-layer
+    // shapes (16 and 272 keys), with partial nodes at each level.
+    printf("Testing S+-trees of every size up to 700...\n");
+    int big[700];
+    for (int len = 0; len <= 700; len++) {
+        for (int i = 0; i < len; i++) big[i] = (i / 3) * 2 - 40;
+        SPlusTree* tree = create_splus_tree(big, len);
+        assert(tree != NULL && tree->len == len);
+        for (int val = -42; val <= len; val++) {
+            int lower = linear_lower_bound(val, big, len);
+            int upper = linear_upper_bound(val, big, len);
+            assert(splus_lower_bound(val, tree) == lower);
+            assert(splus_rank(val, tree) == lower);
+            assert(splus_upper_bound(val, tree) == upper);
+        }
+        destroy_splus_tree(&tree);
+    }
+    printf("SUCCESS - S+-tree size tests passed\n");
+}
+
+void test_large_tree() {
+    printf("Testing a large S+-tree...\n");
+    int len = 1000000;
+    int* keys = malloc(len * sizeof(int));
+    for (int i = 0; i < len; i++) keys[i] = i * 3;
+    SPlusTree* tree = create_splus_tree(keys, len);
+    assert(tree != NULL && tree->height == 5);
+    srand(7);
+    for (int q = 0; q < 100000; q++) {
+        int val = rand() % (len * 3 + 6) - 3;
+        int expected = (val <= 0) ? 0 : (val + 2) / 3;
+        if (expected > len) expected = len;
+        assert(splus_lower_bound(val, tree) == expected);
+    }
+    destroy_splus_tree(&tree);
+    free(keys);
+    printf("SUCCESS - Large S+-tree tests passed\n");
+}
+
+void test_extreme_keys() {
+    printf("Testing extreme keys...\n");
+    // Real INT_MAX keys look the same as padding; they must still be found.
+    int keys[20];
+    for (int i = 0; i < 20; i++) keys[i] = (i < 2) ? INT_MIN : (i < 15) ? i : INT_MAX;
+    SPlusTree* tree = create_splus_tree(keys, 20);
+    assert(splus_lower_bound(INT_MIN, tree) == 0);
+    assert(splus_upper_bound(INT_MIN, tree) == 2);
+    assert(splus_lower_bound(INT_MAX, tree) == 15);
+    assert(splus_upper_bound(INT_MAX, tree) == 20);
+    int first, last;
+    assert(splus_equal_range(INT_MAX, tree, &first, &last) == 5);
+    destroy_splus_tree(&tree);
+
+    assert(create_splus_tree(NULL, 5) == NULL);
+    assert(create_splus_tree(keys, -1) == NULL);
+    assert(splus_lower_bound(1, NULL) == -1);
+    assert(splus_equal_range(1, NULL, &first, &last) == -1);
+    printf("SUCCESS - Extreme key tests passed\n");
+}
+
+int main() {
+    printf("Running S+-tree tests...\n\n");
+
+    test_small_trees();
+    test_all_sizes();
+    test_large_tree();
+    test_extreme_keys();
+
+    printf("\nSUCCESS - All S+-tree tests passed!\n");
+    return 0;
+}
@@ -0,0 +1,646 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include <time.h>
+#include <pthread.h>
+#include "binary_tree.h"
+#include "bplus_tree.h"
+#include "skiplist.h"
+
+// Plain BST against AVL on sequential and random insert orders: insert,
+// lookup and delete cost per operation, and the height each order produces.
+// The plain BST recurses once per level, so on sequential keys it is only run
+// up to PLAIN_SEQUENTIAL_MAX before the list-shaped tree overflows the stack.
+//
+// Then node representations on one large random tree: the original layout
+// (value in its own allocation), inline values, and the pooled Tree.
+//
+// Then the binary trees against the B+-tree as ordered maps: point
+// operations, a full in-order scan, and the B+-tree's bulk load.
+//
+// Then ways to stream a tree's values in order into an array.
+//
+// Then rank, select and range count from subtree sizes against answering
+// them by walking the tree in order.
+//
+// Then loading sorted keys: one insert at a time against the O(n) balanced
+// build, and flattening the tree back to an array.
+//
+// Last, shared sets under 1 to 64 threads: the lock-free skiplist against
+// the pooled AVL tree behind one mutex, on a read-mostly and an update-only
+// mix.
+
+#define PLAIN_SEQUENTIAL_MAX 20000
+
+double now_seconds() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+void shuffle(int* array, int count) {
+    for (int i = count - 1; i > 0; i--) {
+        int j = rand() % (i + 1);
+        int tmp = array[i];
+        array[i] = array[j];
+        array[j] = tmp;
+    }
+}
+
+void bench_tree(const char* name, const char* order, const int* keys, const int* lookups, int count, int balanced) {
+    Node* root = NULL;
+    double start = now_seconds();
+    for (int i = 0; i < count; i++) {
+        root = balanced ? avl_insert(keys[i], root) : bst_insert(keys[i], root);
+    }
+    double insert = now_seconds() - start;
+    int height = get_height(root);
+
+    long long found = 0;
+    start = now_seconds();
+    for (int i = 0; i < count; i++) {
+        found += binary_search(lookups[i], root) != NULL;
+    }
+    double lookup = now_seconds() - start;
+
+    start = now_seconds();
+    for (int i = 0; i < count; i++) {
+        root = balanced ? avl_delete(lookups[i], root) : bst_delete_by_value(lookups[i], root);
+    }
+    double delete = now_seconds() - start;
+
+    printf("%-10s%-8s%-12d%10d%14.1f%14.1f%14.1f%s\n", order, name, count, height, insert / count * 1e9,
+           lookup / count * 1e9, delete / count * 1e9, (found == count && root == NULL) ? "" : "  WRONG");
+    destroy(&root);
+}
+
+// The node layout and BST code as they were before values moved inline:
+// two allocations per node and a pointer chase on every comparison.
+typedef struct LegacyNode {
+    int* val;
+    struct LegacyNode* left;
+    struct LegacyNode* right;
+} LegacyNode;
+
+LegacyNode* legacy_insert(int val, LegacyNode* node) {
+    if (node == NULL) {
+        node = malloc(sizeof(LegacyNode));
+        node->val = malloc(sizeof(int));
+        *(node->val) = val;
+        node->left = NULL;
+        node->right = NULL;
+        return node;
+    }
+    if (val < *(node->val)) {
+        node->left = legacy_insert(val, node->left);
+    }
+    else if (val > *(node->val)) {
+        node->right = legacy_insert(val, node->right);
+    }
+    return node;
+}
+
+LegacyNode* legacy_search(int val, LegacyNode* node) {
+    if (node == NULL || val == *(node->val)) {
+        return node;
+    }
+    return legacy_search(val, (val < *(node->val)) ? node->left : node->right);
+}
+
+void legacy_destroy(LegacyNode* node) {
+    if (node == NULL) {
+        return;
+    }
+    legacy_destroy(node->left);
+    legacy_destroy(node->right);
+    free(node->val);
+    free(node);
+}
+
+void bench_representations(int count) {
+    // Random keys, so the unbalanced variants stay O(log n) deep.
+    int* keys = malloc(count * sizeof(int));
+    int* lookups = malloc(count * sizeof(int));
+    for (int i = 0; i < count; i++) {
+        keys[i] = i;
+        lookups[i] = i;
+    }
+    shuffle(keys, count);
+    shuffle(lookups, count);
+    const char* names[] = {"legacy bst", "inline bst", "inline avl", "pooled avl"};
+    printf("\nnode representations, n = %d random keys\n", count);
+    printf("%-14s%12s%14s%14s%14s%16s\n", "layout", "node bytes", "insert ns", "lookup ns", "destroy ms", "allocator calls");
+    for (int v = 0; v < 4; v++) {
+        LegacyNode* legacy = NULL;
+        Node* root = NULL;
+        Tree* tree = (v == 3) ? create_tree() : NULL;
+        double start = now_seconds();
+        for (int i = 0; i < count; i++) {
+            switch (v) {
+                case 0: legacy = legacy_insert(keys[i], legacy); break;
+                case 1: root = bst_insert(keys[i], root); break;
+                case 2: root = avl_insert(keys[i], root); break;
+                default: tree_insert(tree, keys[i]); break;
+            }
+        }
+        double insert = now_seconds() - start;
+
+        long long found = 0;
+        start = now_seconds();
+        for (int i = 0; i < count; i++) {
+            if (v == 0) {
+                found += legacy_search(lookups[i], legacy) != NULL;
+            }
+            else {
+                found += binary_search(lookups[i], (v == 3) ? tree->root : root) != NULL;
+            }
+        }
+        double lookup = now_seconds() - start;
+
+        // Allocations the build made: legacy nodes take two, inline one, and
+        // the pool one per chunk. Each is matched by a free on destroy.
+        long long calls = (v == 0) ? 2LL * count : (v == 3) ? tree->pool.num_chunks : count;
+        start = now_seconds();
+        if (v == 0) {
+            legacy_destroy(legacy);
+        }
+        else if (v == 3) {
+            destroy_tree(&tree);
+        }
+        else {
+            destroy(&root);
+        }
+        double teardown = now_seconds() - start;
+        // Requested bytes per node; the legacy layout adds a separate int.
+        size_t node_bytes = (v == 0) ? sizeof(LegacyNode) + sizeof(int) : sizeof(Node);
+        printf("%-14s%12zu%14.1f%14.1f%14.1f%16lld%s\n", names[v], node_bytes, insert / count * 1e9,
+               lookup / count * 1e9, teardown * 1000, calls, (found == count) ? "" : "  WRONG");
+    }
+    free(keys);
+    free(lookups);
+}
+
+long long sum_inorder(Node* node) {
+    long long sum = 0;
+    while (node != NULL) {
+        sum += sum_inorder(node->left) + node->value;
+        node = node->right;
+    }
+    return sum;
+}
+
+void bench_ordered_maps(int count) {
+    int* sequential = malloc(count * sizeof(int));
+    int* random = malloc(count * sizeof(int));
+    int* lookups = malloc(count * sizeof(int));
+    for (int i = 0; i < count; i++) {
+        sequential[i] = i;
+        random[i] = i;
+        lookups[i] = i;
+    }
+    shuffle(random, count);
+    shuffle(lookups, count);
+    long long expected_sum = (long long)count * (count - 1) / 2;
+    const char* names[] = {"bst", "avl", "pooled avl", "b+tree", "b+tree"};
+    printf("\nordered maps, n = %d\n", count);
+    printf("%-10s%-12s%8s%14s%14s%14s%14s\n", "order", "map", "levels", "insert ns", "lookup ns", "scan ns/key",
+           "delete ns");
+    // Variant per run, and whether it inserts in random order. The plain BST
+    // only takes random order; variant 4 is the bulk load from sorted keys.
+    int variants[] = {0, 1, 2, 3, 1, 2, 3, 4};
+    int orders[] = {1, 1, 1, 1, 0, 0, 0, 0};
+    for (int run = 0; run < 8; run++) {
+        int v = variants[run];
+        int is_random = orders[run];
+        const int* keys = is_random ? random : sequential;
+        Node* root = NULL;
+        Tree* tree = (v == 2) ? create_tree() : NULL;
+        BPlusTree* map = (v == 3) ? create_bplus_tree() : NULL;
+        double start = now_seconds();
+        if (v == 4) {
+            map = bplus_bulk_load(sequential, NULL, count);
+        }
+        for (int i = 0; i < count && v != 4; i++) {
+            switch (v) {
+                case 0: root = bst_insert(keys[i], root); break;
+                case 1: root = avl_insert(keys[i], root); break;
+                case 2: tree_insert(tree, keys[i]); break;
+                default: bplus_insert(map, keys[i], keys[i]); break;
+            }
+        }
+        double insert = now_seconds() - start;
+        int levels = (v >= 3) ? map->height + 1 : get_height((v == 2) ? tree->root : root);
+
+        long long found = 0;
+        start = now_seconds();
+        for (int i = 0; i < count; i++) {
+            if (v >= 3) {
+                found += bplus_find(map, lookups[i]) != NULL;
+            }
+            else {
+                found += binary_search(lookups[i], (v == 2) ? tree->root : root) != NULL;
+            }
+        }
+        double lookup = now_seconds() - start;
+
+        long long sum = 0;
+        start = now_seconds();
+        if (v >= 3) {
+            BPlusIterator it = bplus_iter_begin(map);
+            int key;
+            while (bplus_iter_next(&it, &key, NULL)) {
+                sum += key;
+            }
+        }
+        else {
+            sum = sum_inorder((v == 2) ? tree->root : root);
+        }
+        double scan = now_seconds() - start;
+
+        start = now_seconds();
+        for (int i = 0; i < count; i++) {
+            switch (v) {
+                case 0: root = bst_delete_by_value(lookups[i], root); break;
+                case 1: root = avl_delete(lookups[i], root); break;
+                case 2: tree_delete(tree, lookups[i]); break;
+                default: bplus_delete(map, lookups[i]); break;
+            }
+        }
+        double delete = now_seconds() - start;
+        int empty = (v >= 3) ? map->size == 0 : (v == 2) ? tree->root == NULL : root == NULL;
+
+        printf("%-10s%-12s%8d%14.1f%14.1f%14.2f%14.1f%s\n", (v == 4) ? "bulk" : is_random ? "random" : "seq",
+               names[v], levels, insert / count * 1e9, lookup / count * 1e9, scan / count * 1e9,
+               delete / count * 1e9, (found == count && sum == expected_sum && empty) ? "" : "  WRONG");
+        destroy(&root);
+        destroy_tree(&tree);
+        destroy_bplus_tree(&map);
+    }
+    free(sequential);
+    free(random);
+    free(lookups);
+}
+
+void collect_recursive(Node* node, int* out, int* count) {
+    if (node == NULL) {
+        return;
+    }
+    collect_recursive(node->left, out, count);
+    out[(*count)++] = node->value;
+    collect_recursive(node->right, out, count);
+}
+
+typedef struct Collector {
+    int* out;
+    int count;
+} Collector;
+
+int collect_visit(Node* node, void* ctx) {
+    Collector* collector = ctx;
+    collector->out[collector->count++] = node->value;
+    return 0;
+}
+
+void bench_traversals(int count) {
+    int* keys = malloc(count * sizeof(int));
+    int* out = malloc(count * sizeof(int));
+    for (int i = 0; i < count; i++) {
+        keys[i] = i;
+    }
+    shuffle(keys, count);
+    Tree* tree = create_tree();
+    for (int i = 0; i < count; i++) {
+        tree_insert(tree, keys[i]);
+    }
+    const char* names[] = {"recursive", "tree_visit", "iterator next", "iterator fill", "morris"};
+    printf("\nin-order into an array, n = %d random keys (pooled avl)\n", count);
+    printf("%-16s%12s\n", "method", "ns/node");
+    for (int m = 0; m < 5; m++) {
+        memset(out, 0xff, count * sizeof(int));
+        int written = 0;
+        double start = now_seconds();
+        if (m == 0) {
+            collect_recursive(tree->root, out, &written);
+        }
+        else if (m == 1) {
+            Collector collector = {out, 0};
+            tree_visit(tree->root, INORDER, collect_visit, &collector);
+            written = collector.count;
+        }
+        else if (m == 2) {
+            TreeIterator it;
+            init_tree_iterator(&it, tree->root, INORDER);
+            Node* node;
+            while ((node = tree_iterator_next(&it)) != NULL) {
+                out[written++] = node->value;
+            }
+            destroy_tree_iterator(&it);
+        }
+        else if (m == 3) {
+            TreeIterator it;
+            init_tree_iterator(&it, tree->root, INORDER);
+            int batch;
+            while ((batch = tree_iterator_fill(&it, out + written, 4096)) > 0) {
+                written += batch;
+            }
+            destroy_tree_iterator(&it);
+        }
+        else {
+            written = inorder_to_array(tree->root, out, count);
+        }
+        double elapsed = now_seconds() - start;
+        int sorted = written == count;
+        for (int i = 0; i < count && sorted; i++) {
+            sorted = out[i] == i;
+        }
+        printf("%-16s%12.2f%s\n", names[m], elapsed / count * 1e9, sorted ? "" : "  WRONG");
+    }
+    destroy_tree(&tree);
+    free(keys);
+    free(out);
+}
+
+// What each query costs without subtree sizes: in-order walks, pruned to the
+// part of the tree that matters.
+int rank_by_walk(int val, Node* root) {
+    TreeIterator it;
+    init_range_iterator(&it, root, INT_MIN, val);
+    int rank = 0;
+    while (tree_iterator_next(&it) != NULL) {
+        rank++;
+    }
+    destroy_tree_iterator(&it);
+    return rank;
+}
+
+Node* select_by_walk(int k, Node* root) {
+    TreeIterator it;
+    init_tree_iterator(&it, root, INORDER);
+    Node* node = tree_iterator_next(&it);
+    for (int i = 0; i < k && node != NULL; i++) {
+        node = tree_iterator_next(&it);
+    }
+    destroy_tree_iterator(&it);
+    return node;
+}
+
+int range_count_by_walk(int lo, int hi, Node* root) {
+    TreeIterator it;
+    init_range_iterator(&it, root, lo, hi);
+    int count = 0;
+    while (tree_iterator_next(&it) != NULL) {
+        count++;
+    }
+    destroy_tree_iterator(&it);
+    return count;
+}
+
+void bench_order_statistics(int count) {
+    // Keys 0, 2, 4, ...: rank and select have known answers.
+    int* keys = malloc(count * sizeof(int));
+    for (int i = 0; i < count; i++) {
+        keys[i] = 2 * i;
+    }
+    shuffle(keys, count);
+    Tree* tree = create_tree();
+    for (int i = 0; i < count; i++) {
+        tree_insert(tree, keys[i]);
+    }
+    // Walks take O(n) each, so they get far fewer queries.
+    int walk_queries = 20;
+    int sized_queries = 1000000;
+    int* a = malloc(sized_queries * sizeof(int));
+    int* b = malloc(sized_queries * sizeof(int));
+    for (int i = 0; i < sized_queries; i++) {
+        a[i] = rand() % count;
+        b[i] = a[i] + rand() % (count - a[i]);
+    }
+    const char* names[] = {"rank", "select", "range count"};
+    printf("\norder statistics, n = %d random keys (pooled avl)\n", count);
+    printf("%-14s%16s%16s%12s\n", "query", "walk ns", "sized ns", "speedup");
+    for (int q = 0; q < 3; q++) {
+        double times[2];
+        int wrong = 0;
+        for (int sized = 0; sized < 2; sized++) {
+            int queries = sized ? sized_queries : walk_queries;
+            double start = now_seconds();
+            for (int i = 0; i < queries; i++) {
+                int result;
+                if (q == 0) {
+                    result = sized ? bst_rank(2 * a[i], tree->root) : rank_by_walk(2 * a[i], tree->root);
+                    wrong |= result != a[i];
+                }
+                else if (q == 1) {
+                    Node* node = sized ? bst_select(a[i], tree->root) : select_by_walk(a[i], tree->root);
+                    wrong |= node == NULL || node->value != 2 * a[i];
+                }
+                else {
+                    result = sized ? bst_range_count(2 * a[i], 2 * b[i], tree->root)
+                                   : range_count_by_walk(2 * a[i], 2 * b[i], tree->root);
+                    wrong |= result != b[i] - a[i];
+                }
+            }
+            times[sized] = (now_seconds() - start) / queries;
+        }
+        printf("%-14s%16.0f%16.1f%12.0f%s\n", names[q], times[0] * 1e9, times[1] * 1e9, times[0] / times[1],
+               wrong ? "  WRONG" : "");
+    }
+    destroy_tree(&tree);
+    free(keys);
+    free(a);
+    free(b);
+}
+
+void bench_bulk_build(int count) {
+    int* sorted = malloc(count * sizeof(int));
+    int* out = malloc(count * sizeof(int));
+    for (int i = 0; i < count; i++) {
+        sorted[i] = 2 * i;
+    }
+    int threads[] = {1, 2, 4};
+    printf("\nbulk load of %d sorted keys\n", count);
+    printf("%-28s%12s%12s\n", "method", "total ms", "ns/key");
+
+    double start = now_seconds();
+    Tree* inserted = create_tree();
+    for (int i = 0; i < count; i++) {
+        tree_insert(inserted, sorted[i]);
+    }
+    double elapsed = now_seconds() - start;
+    printf("%-28s%12.1f%12.2f\n", "tree_insert one by one", elapsed * 1e3, elapsed / count * 1e9);
+    // Untimed: the first large build pays for faulting in memory the later
+    // ones get back from the allocator.
+    Tree* warm = bst_build_from_sorted(sorted, count, 1);
+    destroy_tree(&warm);
+    for (int t = 0; t < 3; t++) {
+        char name[64];
+        snprintf(name, sizeof(name), "bst_build_from_sorted x%d", threads[t]);
+        start = now_seconds();
+        Tree* built = bst_build_from_sorted(sorted, count, threads[t]);
+        elapsed = now_seconds() - start;
+        printf("%-28s%12.1f%12.2f%s\n", name, elapsed * 1e3, elapsed / count * 1e9,
+               (built != NULL && bst_select(count / 3, built->root)->value == sorted[count / 3]) ? "" : "  WRONG");
+        destroy_tree(&built);
+    }
+
+    Tree* built = bst_build_from_sorted(sorted, count, 1);
+    const char* shapes[] = {"built", "inserted"};
+    for (int shape = 0; shape < 2; shape++) {
+        Node* root = (shape == 0) ? built->root : inserted->root;
+        for (int m = 0; m < 4; m++) {
+            char name[64];
+            memset(out, 0, count * sizeof(int));
+            start = now_seconds();
+            if (m == 0) {
+                snprintf(name, sizeof(name), "%s: inorder_to_array", shapes[shape]);
+                inorder_to_array(root, out, count);
+            }
+            else {
+                snprintf(name, sizeof(name), "%s: to_sorted_array x%d", shapes[shape], threads[m - 1]);
+                bst_to_sorted_array(root, out, count, threads[m - 1]);
+            }
+            elapsed = now_seconds() - start;
+            printf("%-28s%12.1f%12.2f%s\n", name, elapsed * 1e3, elapsed / count * 1e9,
+                   memcmp(out, sorted, count * sizeof(int)) == 0 ? "" : "  WRONG");
+        }
+    }
+    destroy_tree(&built);
+    destroy_tree(&inserted);
+    free(sorted);
+    free(out);
+}
+
+#define CONCURRENT_OPS 2000000
+#define CONCURRENT_MAX_THREADS 64
+
+typedef struct ConcurrentArgs {
+    SkipList* list;          // Either the skiplist...
+    Tree* tree;              // ...or the tree behind lock
+    pthread_mutex_t* lock;
+    pthread_barrier_t* start;
+    int id;
+    int ops;
+    int range;
+    int find_percent;        // The rest split evenly between insert and delete
+    long long hits;
+} ConcurrentArgs;
+
+void* concurrent_worker(void* arg) {
+    ConcurrentArgs* a = arg;
+    unsigned int seed = 0x9E3779B9u * (a->id + 1);
+    pthread_barrier_wait(a->start);
+    for (int i = 0; i < a->ops; i++) {
+        int key = rand_r(&seed) % a->range;
+        int roll = rand_r(&seed) % 100;
+        if (a->list != NULL) {
+            if (roll < a->find_percent) {
+                a->hits += skiplist_find(a->list, key);
+            } else if ((roll - a->find_percent) % 2 == 0) {
+                a->hits += skiplist_insert(a->list, key) == 1;
+            } else {
+                a->hits += skiplist_delete(a->list, key);
+            }
+        } else {
+            pthread_mutex_lock(a->lock);
+            if (roll < a->find_percent) {
+                a->hits += tree_find(a->tree, key) != NULL;
+            } else if ((roll - a->find_percent) % 2 == 0) {
+                a->hits += tree_insert(a->tree, key) == 1;
+            } else {
+                a->hits += tree_delete(a->tree, key);
+            }
+            pthread_mutex_unlock(a->lock);
+        }
+    }
+    if (a->list != NULL) {
+        skiplist_release_thread(a->list);
+    }
+    return NULL;
+}
+
+// Mops/s for CONCURRENT_OPS operations split across nthreads.
+double run_concurrent(SkipList* list, Tree* tree, int nthreads, int range, int find_percent) {
+    pthread_t threads[CONCURRENT_MAX_THREADS];
+    ConcurrentArgs args[CONCURRENT_MAX_THREADS];
+    pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+    pthread_barrier_t start;
+    pthread_barrier_init(&start, NULL, nthreads + 1);
+    for (int t = 0; t < nthreads; t++) {
+        args[t] = (ConcurrentArgs){list, tree, &lock, &start, t, CONCURRENT_OPS / nthreads, range, find_percent, 0};
+        pthread_create(&threads[t], NULL, concurrent_worker, &args[t]);
+    }
+    pthread_barrier_wait(&start);
+    double begin = now_seconds();
+    for (int t = 0; t < nthreads; t++) {
+        pthread_join(threads[t], NULL);
+    }
+    double elapsed = now_seconds() - begin;
+    pthread_barrier_destroy(&start);
+    return CONCURRENT_OPS / nthreads * nthreads / elapsed / 1e6;
+}
+
+void bench_concurrent(int count) {
+    int range = 2 * count;
+    const char* mixes[] = {"90% find", "50/50 insert/delete"};
+    int find_percents[] = {90, 0};
+    printf("\nshared set of %d keys from [0, %d), %d ops per run, Mops/s\n", count, range, CONCURRENT_OPS);
+    printf("%-22s%-10s%14s%14s\n", "mix", "threads", "skiplist", "mutex + avl");
+    for (int m = 0; m < 2; m++) {
+        for (int nthreads = 1; nthreads <= CONCURRENT_MAX_THREADS; nthreads *= 2) {
+            SkipList* list = create_skiplist();
+            Tree* tree = create_tree();
+            srand(7);
+            for (int i = 0; i < count; i++) {
+                int key = rand() % range;
+                skiplist_insert(list, key);
+                tree_insert(tree, key);
+            }
+            double lock_free = run_concurrent(list, NULL, nthreads, range, find_percents[m]);
+            double locked = run_concurrent(NULL, tree, nthreads, range, find_percents[m]);
+            printf("%-22s%-10d%14.2f%14.2f\n", mixes[m], nthreads, lock_free, locked);
+            destroy_skiplist(&list);
+            destroy_tree(&tree);
+        }
+    }
+}
+
+int main(int argc, char** argv) {
+    // Usage: ./bench_binary_tree [max_count] [representation_count] [map_count] [order_count] [bulk_count] [concurrent_count]
+    int max_count = (argc > 1) ? atoi(argv[1]) : 1000000;
+    int representation_count = (argc > 2) ? atoi(argv[2]) : 10000000;
+    int map_count = (argc > 3) ? atoi(argv[3]) : 1000000;
+    int order_count = (argc > 4) ? atoi(argv[4]) : 10000000;
+    int bulk_count = (argc > 5) ? atoi(argv[5]) : 20000000;
+    int concurrent_count = (argc > 6) ? atoi(argv[6]) : 1000000;
+    printf("%-10s%-8s%-12s%10s%14s%14s%14s\n", "order", "tree", "n", "height", "insert ns", "lookup ns", "delete ns");
+    srand(1);
+    for (int count = 1000; count <= max_count; count *= 10) {
+        int* sequential = malloc(count * sizeof(int));
+        int* random = malloc(count * sizeof(int));
+        int* lookups = malloc(count * sizeof(int));
+        for (int i = 0; i < count; i++) {
+            sequential[i] = i;
+            random[i] = i;
+            lookups[i] = i;
+        }
+        shuffle(random, count);
+        shuffle(lookups, count);
+        if (count <= PLAIN_SEQUENTIAL_MAX) {
+            bench_tree("bst", "seq", sequential, lookups, count, 0);
+        }
+        bench_tree("avl", "seq", sequential, lookups, count, 1);
+        bench_tree("bst", "random", random, lookups, count, 0);
+        bench_tree("avl", "random", random, lookups, count, 1);
+        free(sequential);
+        free(random);
+        free(lookups);
+    }
+    bench_representations(representation_count);
+    bench_ordered_maps(map_count);
+    bench_traversals(map_count);
+    bench_order_statistics(order_count);
+    bench_bulk_build(bulk_count);
+    bench_concurrent(concurrent_count);
+    return 0;
+}
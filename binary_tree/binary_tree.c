@@ -1,11 +1,16 @@
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include "binary_tree.h"
 
-typedef struct Node {
-    int* val;
-    struct Node* left;
-    struct Node* right;
-} Node;
+void init_node(Node* node, int val) {
+    node->value = val;
+    node->left = NULL;
+    node->right = NULL;
+    node->height = 1;
+    node->size = 1;
+}
 
 Node* create_node(int val) {
     Node* node = malloc(sizeof(Node));
@@ -13,18 +18,18 @@ Node* create_node(int val) {
         fprintf(stderr, "Failed to allocate %lu bytes of memory\n", sizeof(Node));
         return NULL;
     }
-    node->val = malloc(sizeof(int));
-    if (node->val == NULL){
-        free(node);
-        fprintf(stderr, "Failed to allocate %lu bytes of memory\n", sizeof(int));
-        return NULL;
-    }
-    *(node->val) = val;
-    node->left = NULL;
-    node->right = NULL;
+    init_node(node, val);
     return node;
 }
 
+void free_node(Node* node, NodePool* pool) {
+    if (pool != NULL) {
+        pool_free_node(pool, node);
+        return;
+    }
+    free(node);
+}
+
 void destroy(Node** root) {
     if (root == NULL) {
         fprintf(stderr, "Cannot dereference NULL pointer, exiting.\n");
@@ -34,11 +39,10 @@ void destroy(Node** root) {
         return;
     }
     // Apply recursion (DFS) to clear the tree postorder.
-    free((*root)->val);
     destroy(&(*root)->left);
     destroy(&(*root)->right);
 
-    free(*root);
+    free_node(*root, NULL);
     *root = NULL;
 }
 
@@ -46,7 +50,7 @@ int* get_at_path(Node* node, char* path) {
     // Check the current dereferenced value
     if (*path == '\0'){
         // For the case where the string is empty.
-        return node->val;
+        return &node->value;
     }
     else if (*path == 'L') {
         if (node->left != NULL) {
@@ -76,19 +80,7 @@ int* get_at_path(Node* node, char* path) {
 void set_at_path(int val, Node* node, char* path) {
     // Check the current dereferenced value
     if (*path == '\0'){
-        // First, free the existing memory.
-        if (node->val != NULL) {
-            *(node->val) = val;
-            return;
-        }
-        else {
-            node->val = malloc(sizeof(int));
-            if (node->val == NULL){
-                fprintf(stderr, "Failed to allocate %lu bytes of memory\n", sizeof(int));
-                return;
-            }
-            *(node->val) = val;
-        }
+        node->value = val;
     }
     else if (*path == 'L') {
         if (node->left != NULL) {
@@ -115,33 +107,252 @@ void set_at_path(int val, Node* node, char* path) {
 
 }
 
+int print_node(Node* node, void* ctx) {
+    (void)ctx;
+    printf("Node val: %d\n", node->value);
+    return 0;
+}
+
 void preorder_traversal(Node* node) {
-    if (node == NULL) {
-        return;
-    }
-    printf("Node val: %d\n", *(node->val));
-    preorder_traversal(node->left);
-    preorder_traversal(node->right);
+    tree_visit(node, PREORDER, print_node, NULL);
 }
 
 void inorder_traversal(Node* node) {
-    // Visit left subtree, then node, then right subtree
-    if (node == NULL) {
-        return;
-    }
-    inorder_traversal(node->left);
-    printf("Node val: %d\n", *(node->val));
-    inorder_traversal(node->right);
+    tree_visit(node, INORDER, print_node, NULL);
 }
 
 void postorder_traversal(Node* node) {
-    // Visit left subtree, then right subtree, then node,
-    if (node == NULL) {
+    tree_visit(node, POSTORDER, print_node, NULL);
+}
+
+int tree_iterator_grow(TreeIterator* it) {
+    // Only list-shaped trees get here; balanced ones fit inline.
+    size_t bytes = 2 * (size_t)it->capacity * sizeof(Node*);
+    Node** stack = realloc(it->heap_stack, bytes);
+    if (stack == NULL) {
+        fprintf(stderr, "Failed to allocate %lu bytes of memory\n", bytes);
+        return -1;
+    }
+    if (it->heap_stack == NULL) {
+        memcpy(stack, it->inline_stack, it->depth * sizeof(Node*));
+    }
+    it->heap_stack = stack;
+    it->capacity *= 2;
+    return 0;
+}
+
+int tree_iterator_push(TreeIterator* it, Node* node) {
+    if (it->depth == it->capacity && tree_iterator_grow(it) != 0) {
+        return -1;
+    }
+    Node** stack = (it->heap_stack != NULL) ? it->heap_stack : it->inline_stack;
+    stack[it->depth++] = node;
+    return 0;
+}
+
+// Pushes the path from node down to the first node of the order under it:
+// node itself for preorder, its leftmost descendant for inorder, and for
+// postorder the first leaf reached going left whenever possible.
+int tree_iterator_descend(TreeIterator* it, Node* node) {
+    while (node != NULL) {
+        if (tree_iterator_push(it, node) != 0) {
+            return -1;
+        }
+        if (it->order == PREORDER) {
+            break;
+        }
+        node = (it->order == INORDER || node->left != NULL) ? node->left : node->right;
+    }
+    return 0;
+}
+
+int init_tree_iterator(TreeIterator* it, Node* root, TraversalOrder order) {
+    if (it == NULL || (order != PREORDER && order != INORDER && order != POSTORDER)) {
+        fprintf(stderr, "Cannot pass NULL as iterator or an unknown order\n");
+        return -1;
+    }
+    it->heap_stack = NULL;
+    it->depth = 0;
+    it->capacity = TREE_ITER_INLINE_DEPTH;
+    it->order = order;
+    it->bounded = 0;
+    it->upper = 0;
+    return tree_iterator_descend(it, root);
+}
+
+int init_range_iterator(TreeIterator* it, Node* root, int lo, int hi) {
+    if (init_tree_iterator(it, NULL, INORDER) != 0) {
+        return -1;
+    }
+    it->bounded = 1;
+    it->upper = hi;
+    // Seek lo: push each node >= lo on the search path. They are exactly the
+    // ancestors still to come in order, smallest (the lower bound) on top.
+    Node* node = root;
+    while (node != NULL) {
+        if (node->value >= lo) {
+            if (tree_iterator_push(it, node) != 0) {
+                return -1;
+            }
+            node = node->left;
+        }
+        else {
+            node = node->right;
+        }
+    }
+    return 0;
+}
+
+Node* tree_iterator_next(TreeIterator* it) {
+    if (it == NULL || it->depth == 0) {
+        return NULL;
+    }
+    Node** stack = (it->heap_stack != NULL) ? it->heap_stack : it->inline_stack;
+    Node* node = stack[--it->depth];
+    if (it->bounded && node->value >= it->upper) {
+        it->depth = 0; // Past the end of the range
+        return NULL;
+    }
+    int status = 0;
+    if (it->order == PREORDER) {
+        // Right goes in below left, so the whole left subtree comes out first.
+        status = tree_iterator_descend(it, node->right);
+        if (status == 0) {
+            status = tree_iterator_descend(it, node->left);
+        }
+    }
+    else if (it->order == INORDER) {
+        // The left spine of the right subtree, inline: this is the hot path.
+        int depth = it->depth;
+        for (Node* child = node->right; child != NULL; child = child->left) {
+            if (depth == it->capacity) {
+                it->depth = depth;
+                if (tree_iterator_grow(it) != 0) {
+                    it->depth = 0;
+                    return NULL;
+                }
+                stack = it->heap_stack;
+            }
+            stack[depth++] = child;
+        }
+        it->depth = depth;
+    }
+    else if (it->depth > 0) {
+        // After a left child comes its parent's right subtree, if any; after
+        // a right child (or a left child with no sibling), the parent itself.
+        Node* parent = stack[it->depth - 1];
+        if (parent->left == node && parent->right != NULL) {
+            status = tree_iterator_descend(it, parent->right);
+        }
+    }
+    if (status != 0) {
+        it->depth = 0; // Out of memory: end the iteration rather than skip nodes
+        return NULL;
+    }
+    return node;
+}
+
+int tree_iterator_fill(TreeIterator* it, int* out, int max) {
+    if (out == NULL && max > 0) {
+        fprintf(stderr, "Cannot pass NULL as output buffer\n");
+        return 0;
+    }
+    int count = 0;
+    if (it != NULL && it->order == INORDER) {
+        // The common case, with the stack kept in locals: pop a node, emit
+        // it, push the left spine of its right subtree.
+        Node** stack = (it->heap_stack != NULL) ? it->heap_stack : it->inline_stack;
+        int depth = it->depth;
+        while (count < max && depth > 0) {
+            Node* node = stack[--depth];
+            if (it->bounded && node->value >= it->upper) {
+                depth = 0;
+                break;
+            }
+            out[count++] = node->value;
+            for (Node* child = node->right; child != NULL; child = child->left) {
+                if (depth == it->capacity) {
+                    it->depth = depth;
+                    if (tree_iterator_grow(it) != 0) {
+                        it->depth = 0;
+                        return count;
+                    }
+                    stack = it->heap_stack;
+                }
+                stack[depth++] = child;
+            }
+        }
+        it->depth = depth;
+        return count;
+    }
+    Node* node;
+    while (count < max && (node = tree_iterator_next(it)) != NULL) {
+        out[count++] = node->value;
+    }
+    return count;
+}
+
+void destroy_tree_iterator(TreeIterator* it) {
+    if (it == NULL) {
         return;
     }
-    postorder_traversal(node->left);
-    postorder_traversal(node->right);
-    printf("Node val: %d\n", *(node->val));
+    free(it->heap_stack);
+    it->heap_stack = NULL;
+    it->depth = 0;
+    it->capacity = TREE_ITER_INLINE_DEPTH;
+}
+
+int tree_visit(Node* root, TraversalOrder order, NodeVisitor visit, void* ctx) {
+    if (visit == NULL) {
+        fprintf(stderr, "Cannot pass NULL as visitor\n");
+        return -1;
+    }
+    TreeIterator it;
+    if (init_tree_iterator(&it, root, order) != 0) {
+        destroy_tree_iterator(&it);
+        return -1;
+    }
+    int stopped = 0;
+    Node* node;
+    while (!stopped && (node = tree_iterator_next(&it)) != NULL) {
+        stopped = visit(node, ctx) != 0;
+    }
+    destroy_tree_iterator(&it);
+    return stopped;
+}
+
+int inorder_to_array(Node* root, int* out, int max) {
+    if (out == NULL && max > 0) {
+        fprintf(stderr, "Cannot pass NULL as output buffer\n");
+        return -1;
+    }
+    // Morris traversal. Before descending into a left subtree, point the
+    // right pointer of its last in-order node (the predecessor) back at the
+    // current node. Reaching a node through that thread means its left
+    // subtree is done: remove the thread, emit the node, and go right. Every
+    // edge is walked at most three times and every thread is removed.
+    int count = 0;
+    Node* node = root;
+    while (node != NULL) {
+        if (node->left != NULL) {
+            Node* pred = node->left;
+            while (pred->right != NULL && pred->right != node) {
+                pred = pred->right;
+            }
+            if (pred->right == NULL) {
+                pred->right = node;
+                node = node->left;
+                continue;
+            }
+            pred->right = NULL;
+        }
+        if (count < max) {
+            out[count] = node->value;
+        }
+        count++;
+        node = node->right;
+    }
+    return count;
 }
 
 Node* search(int val, Node* node) {
@@ -152,7 +363,7 @@ Node* search(int val, Node* node) {
     if (node == NULL) {
         return NULL;  // Failure base case
     }
-    if (*(node->val) == val) {
+    if (node->value == val) {
         return node;  // Success base case
     }
     
@@ -221,13 +432,13 @@ Node* bst_insert(int val, Node* node) {
         Node* new_node = create_node(val);
         return new_node;
     }
-    if (val < *(node->val)) {
+    if (val < node->value) {
         // Slide to the left
         Node* new_node = bst_insert(val, node->left);
         node->left = new_node;
         
     }
-    else if (val > *(node->val)) {
+    else if (val > node->value) {
         // Slide to the right
         Node* new_node = bst_insert(val, node->right);
         node->right = new_node;
@@ -238,6 +449,7 @@ Node* bst_insert(int val, Node* node) {
         fprintf(stderr, "ERROR - BST insertion does not allow for duplicate values.\n");
         return NULL;
     }
+    node->size = 1 + bst_size(node->left) + bst_size(node->right);
     return node;
 }
 
@@ -246,13 +458,13 @@ Node* binary_search(int val, Node* node) {
     if (node == NULL) {
         return NULL;
     }
-    if (val == *(node->val)) {
+    if (val == node->value) {
         return node;
     }
     // For traversal, apply binary search.
     // Can return straight because unlike regular tree, if a value is not on the
     // left side, it most definitely won't be on the right side (since it's BST).
-    else if (val < *(node->val)) {
+    else if (val < node->value) {
         return binary_search(val, node->left);
     }
     else {
@@ -287,11 +499,11 @@ Node* bst_delete_by_value(int val, Node* node) {
         // Value not found
         return NULL;
     }
-    if (val < *(node->val)) {
+    if (val < node->value) {
         // left traversal
         node->left = bst_delete_by_value(val, node->left);
     }
-    else if (val > *(node->val)) {
+    else if (val > node->value) {
         // right
         node->right = bst_delete_by_value(val, node->right);
     }
@@ -299,22 +511,19 @@ Node* bst_delete_by_value(int val, Node* node) {
         // Found value to delete
         if (node->left == NULL && node->right == NULL) {
             // Leaf node - no children
-            free(node->val);
-            free(node);
+            free_node(node, NULL);
             return NULL;
         }
         if (node->left == NULL) {
             // Has right child only
             Node* child = node->right;
-            free(node->val);
-            free(node);
+            free_node(node, NULL);
             return child;
         }
         if (node->right == NULL) {
             // Has left child only
             Node* child = node->left;
-            free(node->val);
-            free(node);
+            free_node(node, NULL);
             return child;
         }
 
@@ -323,14 +532,446 @@ Node* bst_delete_by_value(int val, Node* node) {
         while(pred->right != NULL) {
             pred = pred->right;
         }
-        // Now that we have the predecessor, free old val and copy the new one.
-        free(node->val);
-        node->val = malloc(sizeof(int)); // make a new ptr since it's dynamic.
-        *(node->val) = *(pred->val); // assign its value
+        // Now that we have the predecessor, copy its value in place.
+        node->value = pred->value;
 
         // Now, delete the predecessor.
         // We target node->left so it won't affect the current node and delete that one.
-        node->left = bst_delete_by_value(*(pred->val), node->left);
+        node->left = bst_delete_by_value(pred->value, node->left);
+    }
+    node->size = 1 + bst_size(node->left) + bst_size(node->right);
+    return node;
+}
+
+// === ORDER STATISTICS ===
+
+int bst_size(Node* node) {
+    return (node == NULL) ? 0 : node->size;
+}
+
+int bst_rank(int val, Node* root) {
+    // Going right past a node skips it and its whole left subtree, all < val.
+    int rank = 0;
+    Node* node = root;
+    while (node != NULL) {
+        if (node->value < val) {
+            rank += bst_size(node->left) + 1;
+            node = node->right;
+        }
+        else {
+            node = node->left;
+        }
+    }
+    return rank;
+}
+
+Node* bst_select(int k, Node* root) {
+    Node* node = root;
+    while (node != NULL) {
+        int left = bst_size(node->left);
+        if (k < left) {
+            node = node->left;
+        }
+        else if (k == left) {
+            return node;
+        }
+        else {
+            k -= left + 1;
+            node = node->right;
+        }
+    }
+    return NULL; // k < 0 or k >= size
+}
+
+int bst_range_count(int lo, int hi, Node* root) {
+    if (hi <= lo) {
+        return 0;
+    }
+    return bst_rank(hi, root) - bst_rank(lo, root);
+}
+
+int avl_height(Node* node) {
+    return (node == NULL) ? 0 : node->height;
+}
+
+void avl_update(Node* node) {
+    // Height and size are both functions of the children, so every change
+    // (an insert or delete below, or a rotation) recomputes them bottom-up.
+    node->height = 1 + max(avl_height(node->left), avl_height(node->right));
+    node->size = 1 + bst_size(node->left) + bst_size(node->right);
+}
+
+Node* avl_rotate_right(Node* node) {
+    /*
+     *       node          pivot
+     *       /   \         /   \
+     *    pivot   C  ->   A    node
+     *    /   \               /   \
+     *   A     B             B     C
+     */
+    Node* pivot = node->left;
+    node->left = pivot->right;
+    pivot->right = node;
+    avl_update(node);
+    avl_update(pivot);
+    return pivot;
+}
+
+Node* avl_rotate_left(Node* node) {
+    // Mirror image of avl_rotate_right.
+    Node* pivot = node->right;
+    node->right = pivot->left;
+    pivot->left = node;
+    avl_update(node);
+    avl_update(pivot);
+    return pivot;
+}
+
+Node* avl_rebalance(Node* node) {
+    // Called on every node along the path of a change, bottom up. Both subtrees
+    // are valid AVL trees and their heights differ by at most 2.
+    avl_update(node);
+    int balance = avl_height(node->left) - avl_height(node->right);
+    if (balance > 1) {
+        // Left-heavy. If the left child leans right, the single rotation would
+        // just move the imbalance across; straighten it first (left-right case).
+        if (avl_height(node->left->left) < avl_height(node->left->right)) {
+            node->left = avl_rotate_left(node->left);
+        }
+        return avl_rotate_right(node);
+    }
+    if (balance < -1) {
+        if (avl_height(node->right->right) < avl_height(node->right->left)) {
+            node->right = avl_rotate_right(node->right);
+        }
+        return avl_rotate_left(node);
+    }
+    return node;
+}
+
+Node* avl_insert_into(int val, Node* node, NodePool* pool, int* status) {
+    // Recursion depth is the tree height, which AVL keeps at O(log n).
+    // status: 1 inserted, 0 already present, -1 allocation failed.
+    if (node == NULL) {
+        Node* created = (pool != NULL) ? pool_alloc_node(pool, val) : create_node(val);
+        *status = (created != NULL) ? 1 : -1;
+        return created;
+    }
+    if (val < node->value) {
+        Node* child = avl_insert_into(val, node->left, pool, status);
+        if (child == NULL) {
+            return node; // Allocation failed; tree unchanged
+        }
+        node->left = child;
+    }
+    else if (val > node->value) {
+        Node* child = avl_insert_into(val, node->right, pool, status);
+        if (child == NULL) {
+            return node;
+        }
+        node->right = child;
+    }
+    else {
+        *status = 0;
         return node;
     }
-}
\ No newline at end of file
+    return avl_rebalance(node);
+}
+
+Node* avl_insert(int val, Node* node) {
+    int status = 0;
+    node = avl_insert_into(val, node, NULL, &status);
+    if (status == 0) {
+        fprintf(stderr, "ERROR - AVL insertion does not allow for duplicate values.\n");
+    }
+    return node;
+}
+
+Node* avl_delete_from(int val, Node* node, NodePool* pool, int* removed) {
+    if (node == NULL) {
+        return NULL; // Value not found
+    }
+    if (val < node->value) {
+        node->left = avl_delete_from(val, node->left, pool, removed);
+    }
+    else if (val > node->value) {
+        node->right = avl_delete_from(val, node->right, pool, removed);
+    }
+    else {
+        *removed = 1;
+        if (node->left == NULL || node->right == NULL) {
+            // At most one child, which is already a balanced subtree.
+            Node* child = (node->left != NULL) ? node->left : node->right;
+            free_node(node, pool);
+            return child;
+        }
+        // Two children: take the predecessor's value, then delete the
+        // predecessor from the left subtree (rebalancing that path).
+        Node* pred = node->left;
+        while (pred->right != NULL) {
+            pred = pred->right;
+        }
+        node->value = pred->value;
+        node->left = avl_delete_from(pred->value, node->left, pool, removed);
+    }
+    return avl_rebalance(node);
+}
+
+Node* avl_delete(int val, Node* node) {
+    int removed = 0;
+    return avl_delete_from(val, node, NULL, &removed);
+}
+
+// === NODE POOL ===
+
+Node* pool_alloc_node(NodePool* pool, int val) {
+    Node* node = pool->free_list;
+    if (node != NULL) {
+        pool->free_list = node->left;
+    }
+    else {
+        NodeChunk* chunk = pool->chunks;
+        if (chunk == NULL || chunk->used == chunk->capacity) {
+            // Chunks double up to a cap, so a tree of n nodes makes O(log n)
+            // small allocations followed by one per POOL_MAX_CHUNK nodes.
+            int capacity = (chunk == NULL) ? POOL_MIN_CHUNK : chunk->capacity * 2;
+            if (capacity > POOL_MAX_CHUNK) {
+                capacity = POOL_MAX_CHUNK;
+            }
+            size_t bytes = sizeof(NodeChunk) + (size_t)capacity * sizeof(Node);
+            chunk = malloc(bytes);
+            if (chunk == NULL) {
+                fprintf(stderr, "Failed to allocate %lu bytes of memory\n", bytes);
+                return NULL;
+            }
+            chunk->next = pool->chunks;
+            chunk->capacity = capacity;
+            chunk->used = 0;
+            pool->chunks = chunk;
+            pool->num_chunks++;
+        }
+        node = &chunk->nodes[chunk->used++];
+    }
+    init_node(node, val);
+    return node;
+}
+
+void pool_free_node(NodePool* pool, Node* node) {
+    // Freed nodes are chained through left and reused before new chunk space.
+    node->left = pool->free_list;
+    pool->free_list = node;
+}
+
+void destroy_pool(NodePool* pool) {
+    NodeChunk* chunk = pool->chunks;
+    while (chunk != NULL) {
+        NodeChunk* next = chunk->next;
+        free(chunk);
+        chunk = next;
+    }
+    pool->chunks = NULL;
+    pool->free_list = NULL;
+    pool->num_chunks = 0;
+}
+
+// === TREE HANDLE ===
+
+Tree* create_tree() {
+    Tree* tree = calloc(1, sizeof(Tree));
+    if (tree == NULL) {
+        fprintf(stderr, "Failed to allocate %lu bytes of memory\n", sizeof(Tree));
+        return NULL;
+    }
+    return tree;
+}
+
+void destroy_tree(Tree** tree) {
+    if (tree == NULL || *tree == NULL) {
+        return;
+    }
+    // The nodes all live in the pool: free its chunks, no tree walk.
+    destroy_pool(&(*tree)->pool);
+    free(*tree);
+    *tree = NULL;
+}
+
+int tree_insert(Tree* tree, int val) {
+    if (tree == NULL) {
+        fprintf(stderr, "Cannot pass NULL as tree\n");
+        return -1;
+    }
+    int status = 0;
+    tree->root = avl_insert_into(val, tree->root, &tree->pool, &status);
+    if (status == 1) {
+        tree->size++;
+    }
+    return status;
+}
+
+int tree_delete(Tree* tree, int val) {
+    if (tree == NULL) {
+        fprintf(stderr, "Cannot pass NULL as tree\n");
+        return 0;
+    }
+    int removed = 0;
+    tree->root = avl_delete_from(val, tree->root, &tree->pool, &removed);
+    tree->size -= removed;
+    return removed;
+}
+
+Node* tree_find(Tree* tree, int val) {
+    if (tree == NULL) {
+        return NULL;
+    }
+    Node* node = tree->root;
+    while (node != NULL && node->value != val) {
+        node = (val < node->value) ? node->left : node->right;
+    }
+    return node;
+}
+
+// === BULK CONSTRUCTION ===
+
+typedef struct BuildTask {
+    Node* nodes;       // Node i is built for sorted[i]
+    const int* sorted;
+    int lo;            // Build the subtree of [lo, hi)
+    int hi;
+    int nthreads;      // Threads available for it
+    Node* root;        // Result
+} BuildTask;
+
+Node* build_balanced(Node* nodes, const int* sorted, int lo, int hi) {
+    // Depth is log2(n), so plain recursion is fine here.
+    if (lo >= hi) {
+        return NULL;
+    }
+    int mid = lo + (hi - lo) / 2;
+    Node* node = &nodes[mid];
+    init_node(node, sorted[mid]);
+    node->left = build_balanced(nodes, sorted, lo, mid);
+    node->right = build_balanced(nodes, sorted, mid + 1, hi);
+    avl_update(node);
+    return node;
+}
+
+void* build_task(void* arg) {
+    BuildTask* task = arg;
+    if (task->nthreads < 2 || task->hi - task->lo < BULK_MIN_PARALLEL) {
+        task->root = build_balanced(task->nodes, task->sorted, task->lo, task->hi);
+        return NULL;
+    }
+    // Hand the left half to a new thread with half the threads, and build
+    // the root and right half here. The halves write disjoint nodes.
+    int mid = task->lo + (task->hi - task->lo) / 2;
+    BuildTask left = {task->nodes, task->sorted, task->lo, mid, task->nthreads / 2, NULL};
+    BuildTask right = {task->nodes, task->sorted, mid + 1, task->hi, task->nthreads - task->nthreads / 2, NULL};
+    pthread_t thread;
+    int spawned = pthread_create(&thread, NULL, build_task, &left) == 0;
+    if (!spawned) {
+        build_task(&left);
+    }
+    build_task(&right);
+    if (spawned) {
+        pthread_join(thread, NULL);
+    }
+    Node* node = &task->nodes[mid];
+    init_node(node, task->sorted[mid]);
+    node->left = left.root;
+    node->right = right.root;
+    avl_update(node);
+    task->root = node;
+    return NULL;
+}
+
+Tree* bst_build_from_sorted(const int* sorted, int n, int nthreads) {
+    if (n < 0 || (sorted == NULL && n > 0) || nthreads < 1) {
+        fprintf(stderr, "ERROR - Must pass sorted values, a valid length and nthreads >= 1\n");
+        return NULL;
+    }
+    for (int i = 1; i < n; i++) {
+        if (sorted[i - 1] >= sorted[i]) {
+            fprintf(stderr, "ERROR - Values must be strictly ascending (index %d)\n", i);
+            return NULL;
+        }
+    }
+    Tree* tree = create_tree();
+    if (tree == NULL || n == 0) {
+        return tree;
+    }
+    // One chunk holds every node, fully used. Later inserts find it full and
+    // start a new chunk as usual; destroy_tree frees it like any other.
+    size_t bytes = sizeof(NodeChunk) + (size_t)n * sizeof(Node);
+    NodeChunk* chunk = malloc(bytes);
+    if (chunk == NULL) {
+        fprintf(stderr, "Failed to allocate %lu bytes of memory\n", bytes);
+        destroy_tree(&tree);
+        return NULL;
+    }
+    chunk->next = NULL;
+    chunk->capacity = n;
+    chunk->used = n;
+    tree->pool.chunks = chunk;
+    tree->pool.num_chunks = 1;
+
+    BuildTask task = {chunk->nodes, sorted, 0, n, nthreads, NULL};
+    build_task(&task);
+    tree->root = task.root;
+    tree->size = n;
+    return tree;
+}
+
+typedef struct FlattenTask {
+    Node* root;
+    int* out;          // Receives bst_size(root) values
+    int nthreads;
+} FlattenTask;
+
+void* flatten_task(void* arg) {
+    FlattenTask* task = arg;
+    Node* node = task->root;
+    if (node == NULL) {
+        return NULL;
+    }
+    if (task->nthreads < 2 || node->size < BULK_MIN_PARALLEL) {
+        TreeIterator it;
+        init_tree_iterator(&it, node, INORDER);
+        tree_iterator_fill(&it, task->out, node->size);
+        destroy_tree_iterator(&it);
+        return NULL;
+    }
+    // The left subtree's size is where this node's value goes.
+    int left_size = bst_size(node->left);
+    FlattenTask left = {node->left, task->out, task->nthreads / 2};
+    FlattenTask right = {node->right, task->out + left_size + 1, task->nthreads - task->nthreads / 2};
+    pthread_t thread;
+    int spawned = pthread_create(&thread, NULL, flatten_task, &left) == 0;
+    if (!spawned) {
+        flatten_task(&left);
+    }
+    task->out[left_size] = node->value;
+    flatten_task(&right);
+    if (spawned) {
+        pthread_join(thread, NULL);
+    }
+    return NULL;
+}
+
+int bst_to_sorted_array(Node* root, int* out, int max, int nthreads) {
+    if ((out == NULL && max > 0) || nthreads < 1) {
+        fprintf(stderr, "ERROR - Must pass an output buffer and nthreads >= 1\n");
+        return -1;
+    }
+    int size = bst_size(root);
+    if (max < size) {
+        // A short buffer: only the first max values, from one iterator.
+        TreeIterator it;
+        init_tree_iterator(&it, root, INORDER);
+        tree_iterator_fill(&it, out, max);
+        destroy_tree_iterator(&it);
+        return size;
+    }
+    FlattenTask task = {root, out, nthreads};
+    flatten_task(&task);
+    return size;
+}
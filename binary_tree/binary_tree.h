@@ -9,14 +9,52 @@
 
 /**
  * Node structure for binary tree
- * Uses int* for values to allow NULL returns without ambiguity
+ * The value is stored inline, so a node is one 32-byte allocation.
+ * get_at_path still returns an int* (NULL for a bad path) pointing at it.
  */
 typedef struct Node {
-    int* val;           // Pointer to value (allows NULL checking)
     struct Node* left;  // Left child
     struct Node* right; // Right child
+    int height;         // Subtree height, maintained by the AVL operations (leaf = 1)
+    int value;          // The value itself
+    int size;           // Nodes in this subtree, maintained by the BST and AVL
+                        // insert and delete functions (leaf = 1)
 } Node;
 
+/**
+ * Block of nodes handed out by a NodePool
+ */
+typedef struct NodeChunk {
+    struct NodeChunk* next; // Previously allocated chunk
+    int capacity;           // Nodes in this chunk
+    int used;               // Nodes handed out from it so far
+    Node nodes[];
+} NodeChunk;
+
+/**
+ * Arena of nodes for one tree: nodes are carved from chunks and recycled
+ * through a freelist, and the whole tree is freed by dropping the chunks.
+ * Zero-initialize to start empty.
+ */
+typedef struct NodePool {
+    NodeChunk* chunks;  // Newest chunk first
+    Node* free_list;    // Freed nodes, chained through left
+    int num_chunks;     // Chunks allocated so far (one malloc each)
+} NodePool;
+
+// First and largest chunk sizes, in nodes.
+#define POOL_MIN_CHUNK 64
+#define POOL_MAX_CHUNK 65536
+
+/**
+ * Balanced (AVL) tree whose nodes come from its own NodePool
+ */
+typedef struct Tree {
+    Node* root; // Ordinary AVL tree of Nodes; read-only functions accept it
+    NodePool pool;
+    int size;   // Number of values stored
+} Tree;
+
 // === MEMORY MANAGEMENT ===
 
 /**
@@ -51,6 +89,39 @@ int* get_at_path(Node* node, char* path);
 void set_at_path(int val, Node* node, char* path);
 
 // === TREE TRAVERSAL ===
+// The traversals are iterative: an explicit stack replaces the call stack,
+// so list-shaped trees of any depth are safe.
+
+/**
+ * Order in which a traversal visits nodes
+ */
+typedef enum TraversalOrder {
+    PREORDER,  // Node, then left, then right
+    INORDER,   // Left, then node, then right (sorted order for BSTs)
+    POSTORDER  // Left, then right, then node
+} TraversalOrder;
+
+/**
+ * Visitor callback: return nonzero to stop the traversal early
+ */
+typedef int (*NodeVisitor)(Node* node, void* ctx);
+
+// Stack slots held in the iterator itself; deeper trees move to the heap.
+// Balanced trees of any int-indexable size fit.
+#define TREE_ITER_INLINE_DEPTH 64
+
+/**
+ * Pull iterator over a tree. The tree must not change while it is in use.
+ */
+typedef struct TreeIterator {
+    Node* inline_stack[TREE_ITER_INLINE_DEPTH]; // Nodes still to be resumed
+    Node** heap_stack;   // Replaces inline_stack once it overflows, else NULL
+    int depth;           // Entries in use
+    int capacity;        // Entries available
+    TraversalOrder order;
+    int bounded;         // Range iterator: stop at the first value >= upper
+    int upper;
+} TreeIterator;
 
 /**
  * Preorder traversal: Visit node, then left, then right
@@ -72,6 +143,56 @@ void inorder_traversal(Node* node);
  */
 void postorder_traversal(Node* node);
 
+/**
+ * Calls visit on every node in the given order
+ * @param root: Starting node
+ * @param visit: Callback; a nonzero return stops the traversal
+ * @param ctx: Passed through to visit
+ * @return: 1 if visit stopped the traversal, 0 if it completed, -1 on error
+ */
+int tree_visit(Node* root, TraversalOrder order, NodeVisitor visit, void* ctx);
+
+/**
+ * Starts an iterator at the first node of the given order
+ * @return: 0 on success, -1 on invalid arguments
+ */
+int init_tree_iterator(TreeIterator* it, Node* root, TraversalOrder order);
+
+/**
+ * Starts an inorder iterator over the values in [lo, hi)
+ * The iterator seeks to lo in O(height) and stops before hi, so a range of
+ * m values costs O(height + m). Use with tree_iterator_next / _fill.
+ * @return: 0 on success, -1 on invalid arguments
+ */
+int init_range_iterator(TreeIterator* it, Node* root, int lo, int hi);
+
+/**
+ * Next node in the iterator's order
+ * @return: Node pointer, or NULL at the end (or if the stack cannot grow)
+ */
+Node* tree_iterator_next(TreeIterator* it);
+
+/**
+ * Copies up to max of the next values into out, advancing the iterator
+ * @return: Number of values written; fewer than max only at the end
+ */
+int tree_iterator_fill(TreeIterator* it, int* out, int max);
+
+/**
+ * Frees any heap stack the iterator grew (safe to call more than once)
+ */
+void destroy_tree_iterator(TreeIterator* it);
+
+/**
+ * Writes the in-order values of the tree into out, up to max of them
+ * Uses Morris traversal: no stack at all, but right pointers are threaded
+ * temporarily, so no one else may read the tree during the call. The tree
+ * is fully restored before it returns.
+ * @return: Number of nodes in the tree (values past max are not written),
+ *          or -1 if out is NULL and max > 0
+ */
+int inorder_to_array(Node* root, int* out, int max);
+
 // === TREE OPERATIONS ===
 
 /**
@@ -137,6 +258,155 @@ Node* bst_find_min(Node* root);
  */
 Node* bst_find_max(Node* root);
 
+// === ORDER STATISTICS ===
+// Every node stores the size of its subtree, so rank and select walk a single
+// root-to-leaf path: O(log n) on AVL trees and pooled Trees, O(height) on a
+// plain BST. Sizes are kept by bst_insert, bst_delete_by_value and the AVL
+// functions; trees linked by hand must set them too.
+
+/**
+ * Number of nodes in a subtree, O(1)
+ */
+int bst_size(Node* node);
+
+/**
+ * Number of values less than val (the index val has or would have in sorted order)
+ */
+int bst_rank(int val, Node* root);
+
+/**
+ * k-th smallest node, counting from 0
+ * @return: Pointer to node, or NULL if k is outside [0, size)
+ */
+Node* bst_select(int k, Node* root);
+
+/**
+ * Number of values in [lo, hi)
+ */
+int bst_range_count(int lo, int hi, Node* root);
+
+// === AVL (SELF-BALANCING BST) OPERATIONS ===
+// An AVL tree is a BST in which the heights of every node's two subtrees
+// differ by at most one, so its height stays below 1.44 log2(n + 2). Inserts
+// and deletes restore that with at most O(log n) rotations. The result is an
+// ordinary BST of Nodes, so binary_search, bst_find_min/max, the traversals and
+// destroy all work on it unchanged. Build a tree with either the AVL or the
+// plain bst_ functions, not a mix: the plain ones do not update heights.
+
+/**
+ * Inserts a value into an AVL tree, rebalancing on the way back up
+ * Duplicates are rejected with an error and leave the tree unchanged
+ * @param val: Value to insert
+ * @param node: Root of AVL tree (NULL for empty)
+ * @return: Root of AVL tree after insertion (may differ from node)
+ */
+Node* avl_insert(int val, Node* node);
+
+/**
+ * Deletes a value from an AVL tree, rebalancing on the way back up
+ * @param val: Value to delete (a missing value leaves the tree unchanged)
+ * @param node: Root of AVL tree
+ * @return: Root of AVL tree after deletion (NULL if it became empty)
+ */
+Node* avl_delete(int val, Node* node);
+
+/**
+ * Height of an AVL subtree from the stored field, O(1)
+ * @param node: Root of subtree
+ * @return: Height (0 for NULL)
+ */
+int avl_height(Node* node);
+
+// === NODE POOL AND TREE HANDLE ===
+// Pooled nodes must not be passed to destroy, bst_delete_by_value or
+// avl_delete, which free() them; use the tree_ functions and destroy_tree.
+
+/**
+ * Takes a node from the pool (freelist first) and initializes it
+ * @param pool: Pool to allocate from
+ * @param val: Value to store
+ * @return: Pointer to node, or NULL if a new chunk cannot be allocated
+ */
+Node* pool_alloc_node(NodePool* pool, int val);
+
+/**
+ * Returns a node to the pool's freelist
+ * @param pool: Pool the node came from
+ * @param node: Node to recycle
+ */
+void pool_free_node(NodePool* pool, Node* node);
+
+/**
+ * Frees every chunk of the pool, and with them every node it handed out
+ * @param pool: Pool to empty (left zeroed and reusable)
+ */
+void destroy_pool(NodePool* pool);
+
+/**
+ * Creates an empty pooled AVL tree
+ * @return: Pointer to tree, or NULL if allocation fails
+ */
+Tree* create_tree();
+
+/**
+ * Frees the tree and all its nodes by dropping the pool, without walking it
+ * @param tree: Pointer to tree pointer (set to NULL)
+ */
+void destroy_tree(Tree** tree);
+
+/**
+ * Inserts a value, keeping the tree balanced
+ * @param tree: Tree to insert into
+ * @param val: Value to insert
+ * @return: 1 if inserted, 0 if already present, -1 on allocation failure
+ */
+int tree_insert(Tree* tree, int val);
+
+/**
+ * Deletes a value, keeping the tree balanced; the node goes to the freelist
+ * @param tree: Tree to delete from
+ * @param val: Value to delete
+ * @return: 1 if removed, 0 if not present
+ */
+int tree_delete(Tree* tree, int val);
+
+/**
+ * Iterative lookup
+ * @param tree: Tree to search
+ * @param val: Value to find
+ * @return: Pointer to node containing value, or NULL if not found
+ */
+Node* tree_find(Tree* tree, int val);
+
+// === BULK CONSTRUCTION ===
+// Link with -pthread.
+
+// Subtrees smaller than this are built or flattened by the thread that
+// reaches them rather than handed to a new one.
+#define BULK_MIN_PARALLEL 65536
+
+/**
+ * Builds a perfectly balanced Tree from strictly ascending values in O(n)
+ * All n nodes come from one contiguous pool chunk, node i holding sorted[i],
+ * and the top of the tree is split across threads. Heights and sizes are
+ * set, so the result takes tree_insert / tree_delete and order statistics.
+ * @param sorted: Ascending values, no duplicates
+ * @param n: Number of values
+ * @param nthreads: Threads to use (1 builds on the calling thread)
+ * @return: Pointer to tree, or NULL on invalid input or allocation failure
+ */
+Tree* bst_build_from_sorted(const int* sorted, int n, int nthreads);
+
+/**
+ * Writes the tree's values in ascending order, up to max of them
+ * Uses the subtree sizes to give each thread its own part of out. The tree
+ * is only read, so other readers may share it.
+ * @param nthreads: Threads to use (1 flattens on the calling thread)
+ * @return: Number of nodes in the tree (values past max are not written),
+ *          or -1 on invalid arguments
+ */
+int bst_to_sorted_array(Node* root, int* out, int max, int nthreads);
+
 // === UTILITY FUNCTIONS ===
 
 /**
@@ -0,0 +1,606 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "bplus_tree.h"
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(BPLUS_KEY_IS_INT) && !defined(BPLUS_NO_SIMD)
+#include <immintrin.h>
+#define BPLUS_HAVE_X86_SIMD 1
+#endif
+
+// Fewest keys a node other than the root may hold. Two nodes at the limit,
+// one of them a key short, still fit in one node when merged.
+#define BPLUS_LEAF_MIN ((int)BPLUS_LEAF_KEYS / 2)
+#define BPLUS_INTERNAL_MIN (((int)BPLUS_INTERNAL_KEYS - 1) / 2)
+
+// Internal levels a tree of INT_MAX keys can need at minimum fanout, with room.
+#define BPLUS_MAX_HEIGHT 40
+
+// === NODE SEARCH ===
+
+// Number of keys < key among the first count: the position of key in a leaf.
+// Nodes are short enough that comparing every key without branches beats a
+// binary search's mispredictions.
+
+int bplus_rank_scalar(const BPlusKey* keys, int count, BPlusKey key) {
+    int rank = 0;
+    for (int i = 0; i < count; i++) {
+        rank += BPLUS_KEY_LESS(keys[i], key);
+    }
+    return rank;
+}
+
+#ifdef BPLUS_HAVE_X86_SIMD
+
+__attribute__((target("avx2,popcnt")))
+int bplus_rank_avx2(const int* keys, int count, int key) {
+    __m256i x = _mm256_set1_epi32(key);
+    int rank = 0;
+    int i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m256i less = _mm256_cmpgt_epi32(x, _mm256_loadu_si256((const __m256i*)(keys + i)));
+        rank += __builtin_popcount(_mm256_movemask_ps(_mm256_castsi256_ps(less)));
+    }
+    for (; i < count; i++) {
+        rank += keys[i] < key;
+    }
+    return rank;
+}
+
+#endif
+
+int bplus_rank(const BPlusTree* tree, const BPlusKey* keys, int count, BPlusKey key) {
+#ifdef BPLUS_HAVE_X86_SIMD
+    if (tree->use_simd) {
+        return bplus_rank_avx2(keys, count, key);
+    }
+#else
+    (void)tree;
+#endif
+    return bplus_rank_scalar(keys, count, key);
+}
+
+// Child of an internal node that holds key. Separators are unique, so the
+// count of separators <= key is the rank plus one if the next one is equal.
+int bplus_child_index(const BPlusTree* tree, const BPlusInternal* inner, BPlusKey key) {
+    int i = bplus_rank(tree, inner->keys, inner->count, key);
+    return i + (i < inner->count && !BPLUS_KEY_LESS(key, inner->keys[i]));
+}
+
+BPlusLeaf* bplus_find_leaf(BPlusTree* tree, BPlusKey key) {
+    void* node = tree->root;
+    for (int level = tree->height; level > 0; level--) {
+        BPlusInternal* inner = node;
+        node = inner->children[bplus_child_index(tree, inner, key)];
+    }
+    return node;
+}
+
+// === MEMORY MANAGEMENT ===
+
+void* bplus_alloc_node(size_t bytes) {
+    // aligned_alloc wants a multiple of the alignment.
+    size_t rounded = (bytes + 63) / 64 * 64;
+    void* node = aligned_alloc(64, rounded);
+    if (node == NULL) {
+        fprintf(stderr, "Failed to allocate %lu bytes of memory\n", rounded);
+    }
+    return node;
+}
+
+BPlusTree* create_bplus_tree() {
+    BPlusTree* tree = malloc(sizeof(BPlusTree));
+    BPlusLeaf* root = bplus_alloc_node(sizeof(BPlusLeaf));
+    if (tree == NULL || root == NULL) {
+        fprintf(stderr, "Failed to allocate %lu bytes of memory\n", sizeof(BPlusTree));
+        free(tree);
+        free(root);
+        return NULL;
+    }
+    root->count = 0;
+    root->next = NULL;
+    tree->root = root;
+    tree->height = 0;
+    tree->size = 0;
+    tree->use_simd = 0;
+#ifdef BPLUS_HAVE_X86_SIMD
+    tree->use_simd = __builtin_cpu_supports("avx2") != 0;
+#endif
+    return tree;
+}
+
+BPlusTree* bplus_bulk_load(const BPlusKey* keys, const BPlusValue* values, int count) {
+    if (count < 0 || (keys == NULL && count > 0)) {
+        fprintf(stderr, "ERROR - Must pass ascending keys and a valid count\n");
+        return NULL;
+    }
+    for (int i = 1; i < count; i++) {
+        if (!BPLUS_KEY_LESS(keys[i - 1], keys[i])) {
+            fprintf(stderr, "ERROR - Bulk load keys must be strictly ascending (index %d)\n", i);
+            return NULL;
+        }
+    }
+    BPlusTree* tree = create_bplus_tree();
+    if (tree == NULL || count == 0) {
+        return tree;
+    }
+    // Node counts are known up front, so every node is allocated before any
+    // is filled and a failure has nothing half-linked to unwind.
+    int leaves = (count + (int)BPLUS_LEAF_KEYS - 1) / (int)BPLUS_LEAF_KEYS;
+    long long total = leaves;
+    for (long long n = leaves; n > 1; ) {
+        n = (n + BPLUS_INTERNAL_KEYS) / (BPLUS_INTERNAL_KEYS + 1);
+        total += n;
+    }
+    void** nodes = malloc(total * sizeof(void*));
+    BPlusKey* mins = malloc(leaves * sizeof(BPlusKey)); // Smallest key under each node of a level
+    long long allocated = 0;
+    if (nodes != NULL && mins != NULL) {
+        // The empty root leaf doubles as the first leaf.
+        nodes[allocated++] = tree->root;
+        while (allocated < total) {
+            nodes[allocated] = bplus_alloc_node((allocated < leaves) ? sizeof(BPlusLeaf) : sizeof(BPlusInternal));
+            if (nodes[allocated] == NULL) {
+                break;
+            }
+            allocated++;
+        }
+    }
+    if (allocated < total) {
+        fprintf(stderr, "ERROR - Could not allocate a B+-tree for %d keys\n", count);
+        for (long long i = 1; i < allocated; i++) {
+            free(nodes[i]);
+        }
+        free(nodes);
+        free(mins);
+        destroy_bplus_tree(&tree);
+        return NULL;
+    }
+
+    // Spread keys evenly, so every leaf is at least half full.
+    for (int j = 0; j < leaves; j++) {
+        BPlusLeaf* leaf = nodes[j];
+        int start = (int)((long long)j * count / leaves);
+        int end = (int)((long long)(j + 1) * count / leaves);
+        leaf->count = end - start;
+        memcpy(leaf->keys, keys + start, leaf->count * sizeof(BPlusKey));
+        if (values != NULL) {
+            memcpy(leaf->values, values + start, leaf->count * sizeof(BPlusValue));
+        }
+        else {
+            memset(leaf->values, 0, leaf->count * sizeof(BPlusValue));
+        }
+        leaf->next = (j + 1 < leaves) ? nodes[j + 1] : NULL;
+        mins[j] = keys[start];
+    }
+    // Each internal level groups the one below evenly in the same way. The
+    // separator before child c is the smallest key under it. A parent's
+    // index never exceeds its first child's, so mins is reused in place.
+    long long offset = 0;
+    int n = leaves;
+    int height = 0;
+    while (n > 1) {
+        int parents = (n + (int)BPLUS_INTERNAL_KEYS) / ((int)BPLUS_INTERNAL_KEYS + 1);
+        for (int p = 0; p < parents; p++) {
+            BPlusInternal* inner = nodes[offset + n + p];
+            int first = (int)((long long)p * n / parents);
+            int last = (int)((long long)(p + 1) * n / parents);
+            inner->count = last - first - 1;
+            for (int c = first; c < last; c++) {
+                inner->children[c - first] = nodes[offset + c];
+                if (c > first) {
+                    inner->keys[c - first - 1] = mins[c];
+                }
+            }
+            mins[p] = mins[first];
+        }
+        offset += n;
+        n = parents;
+        height++;
+    }
+    tree->root = nodes[offset];
+    tree->height = height;
+    tree->size = count;
+    free(nodes);
+    free(mins);
+    return tree;
+}
+
+void bplus_free_subtree(void* node, int level) {
+    if (level > 0) {
+        BPlusInternal* inner = node;
+        for (int i = 0; i <= inner->count; i++) {
+            bplus_free_subtree(inner->children[i], level - 1);
+        }
+    }
+    free(node);
+}
+
+void destroy_bplus_tree(BPlusTree** tree) {
+    if (tree == NULL || *tree == NULL) {
+        return;
+    }
+    bplus_free_subtree((*tree)->root, (*tree)->height);
+    free(*tree);
+    *tree = NULL;
+}
+
+// === INSERTION ===
+
+void bplus_leaf_insert_at(BPlusLeaf* leaf, int i, BPlusKey key, BPlusValue value) {
+    memmove(&leaf->keys[i + 1], &leaf->keys[i], (leaf->count - i) * sizeof(BPlusKey));
+    memmove(&leaf->values[i + 1], &leaf->values[i], (leaf->count - i) * sizeof(BPlusValue));
+    leaf->keys[i] = key;
+    leaf->values[i] = value;
+    leaf->count++;
+}
+
+// Nodes one insert's splits will use: a leaf, then an internal node per
+// splitting ancestor bottom-up, then the new root if the root splits.
+typedef struct BPlusSpares {
+    void* nodes[BPLUS_MAX_HEIGHT + 2];
+    int count;
+    int used;
+} BPlusSpares;
+
+// Allocates the spares for a leaf split under full_above full ancestors, all
+// before anything changes, so a failure leaves the tree as it was.
+int bplus_reserve(BPlusTree* tree, BPlusSpares* spares, int full_above) {
+    int internals = full_above + (full_above == tree->height);
+    spares->count = 0;
+    spares->used = 0;
+    for (int i = 0; i <= internals; i++) {
+        void* node = bplus_alloc_node((i == 0) ? sizeof(BPlusLeaf) : sizeof(BPlusInternal));
+        if (node == NULL) {
+            while (spares->count > 0) {
+                free(spares->nodes[--spares->count]);
+            }
+            return -1;
+        }
+        spares->nodes[spares->count++] = node;
+    }
+    return 0;
+}
+
+// Inserts into the subtree at node, level internal levels above the leaves,
+// under full_above consecutive full ancestors. If node splits, *split_node
+// receives its new right sibling and *split_key the separator the parent must
+// add before it; otherwise *split_node is NULL.
+int bplus_insert_into(BPlusTree* tree, void* node, int level, int full_above, BPlusSpares* spares,
+                      BPlusKey key, BPlusValue value, BPlusKey* split_key, void** split_node) {
+    *split_node = NULL;
+    if (level == 0) {
+        BPlusLeaf* leaf = node;
+        int i = bplus_rank(tree, leaf->keys, leaf->count, key);
+        if (i < leaf->count && !BPLUS_KEY_LESS(key, leaf->keys[i])) {
+            leaf->values[i] = value;
+            return 0;
+        }
+        if (leaf->count < (int)BPLUS_LEAF_KEYS) {
+            bplus_leaf_insert_at(leaf, i, key, value);
+            return 1;
+        }
+        if (bplus_reserve(tree, spares, full_above) != 0) {
+            return -1;
+        }
+        // Full: move the upper half to a new right sibling, then insert into
+        // whichever half the key belongs to. Both end up at least half full.
+        BPlusLeaf* right = spares->nodes[spares->used++];
+        int half = (int)BPLUS_LEAF_KEYS / 2;
+        right->count = leaf->count - half;
+        memcpy(right->keys, &leaf->keys[half], right->count * sizeof(BPlusKey));
+        memcpy(right->values, &leaf->values[half], right->count * sizeof(BPlusValue));
+        leaf->count = half;
+        right->next = leaf->next;
+        leaf->next = right;
+        if (i <= half) {
+            bplus_leaf_insert_at(leaf, i, key, value);
+        }
+        else {
+            bplus_leaf_insert_at(right, i - half, key, value);
+        }
+        *split_key = right->keys[0];
+        *split_node = right;
+        return 1;
+    }
+
+    BPlusInternal* inner = node;
+    int i = bplus_child_index(tree, inner, key);
+    int full = (inner->count == (int)BPLUS_INTERNAL_KEYS) ? full_above + 1 : 0;
+    BPlusKey child_key;
+    void* child_node;
+    int status = bplus_insert_into(tree, inner->children[i], level - 1, full, spares, key, value,
+                                   &child_key, &child_node);
+    if (child_node == NULL) {
+        return status;
+    }
+    // The child split: child_key and child_node go in after child i.
+    if (inner->count < (int)BPLUS_INTERNAL_KEYS) {
+        memmove(&inner->keys[i + 1], &inner->keys[i], (inner->count - i) * sizeof(BPlusKey));
+        memmove(&inner->children[i + 2], &inner->children[i + 1], (inner->count - i) * sizeof(void*));
+        inner->keys[i] = child_key;
+        inner->children[i + 1] = child_node;
+        inner->count++;
+        return status;
+    }
+    // Full: lay out the keys and children with the new entry, keep the lower
+    // half, pass the middle key up and move the rest to the new sibling.
+    BPlusInternal* right = spares->nodes[spares->used++];
+    BPlusKey keys[BPLUS_INTERNAL_KEYS + 1];
+    void* children[BPLUS_INTERNAL_KEYS + 2];
+    int total = inner->count + 1;
+    memcpy(keys, inner->keys, i * sizeof(BPlusKey));
+    keys[i] = child_key;
+    memcpy(&keys[i + 1], &inner->keys[i], (inner->count - i) * sizeof(BPlusKey));
+    memcpy(children, inner->children, (i + 1) * sizeof(void*));
+    children[i + 1] = child_node;
+    memcpy(&children[i + 2], &inner->children[i + 1], (inner->count - i) * sizeof(void*));
+
+    int mid = total / 2;
+    inner->count = mid;
+    memcpy(inner->keys, keys, mid * sizeof(BPlusKey));
+    memcpy(inner->children, children, (mid + 1) * sizeof(void*));
+    right->count = total - mid - 1;
+    memcpy(right->keys, &keys[mid + 1], right->count * sizeof(BPlusKey));
+    memcpy(right->children, &children[mid + 1], (right->count + 1) * sizeof(void*));
+    *split_key = keys[mid];
+    *split_node = right;
+    return status;
+}
+
+int bplus_insert(BPlusTree* tree, BPlusKey key, BPlusValue value) {
+    if (tree == NULL) {
+        fprintf(stderr, "Cannot pass NULL as tree\n");
+        return -1;
+    }
+    BPlusSpares spares;
+    BPlusKey split_key;
+    void* split_node;
+    int status = bplus_insert_into(tree, tree->root, tree->height, 0, &spares, key, value, &split_key, &split_node);
+    if (split_node != NULL) {
+        // The root split: grow a level.
+        BPlusInternal* root = spares.nodes[spares.used++];
+        root->count = 1;
+        root->keys[0] = split_key;
+        root->children[0] = tree->root;
+        root->children[1] = split_node;
+        tree->root = root;
+        tree->height++;
+    }
+    if (status == 1) {
+        tree->size++;
+    }
+    return status;
+}
+
+// === DELETION ===
+
+// Drops separator s and the child to its right from an internal node.
+void bplus_remove_separator(BPlusInternal* inner, int s) {
+    memmove(&inner->keys[s], &inner->keys[s + 1], (inner->count - s - 1) * sizeof(BPlusKey));
+    memmove(&inner->children[s + 1], &inner->children[s + 2], (inner->count - s - 1) * sizeof(void*));
+    inner->count--;
+}
+
+// Child i of parent, a leaf, fell below half full: borrow a key from a
+// sibling that can spare one, or else merge with a sibling.
+void bplus_fix_leaf(BPlusInternal* parent, int i) {
+    BPlusLeaf* child = parent->children[i];
+    BPlusLeaf* left = (i > 0) ? parent->children[i - 1] : NULL;
+    BPlusLeaf* right = (i < parent->count) ? parent->children[i + 1] : NULL;
+    if (left != NULL && left->count > BPLUS_LEAF_MIN) {
+        left->count--;
+        bplus_leaf_insert_at(child, 0, left->keys[left->count], left->values[left->count]);
+        parent->keys[i - 1] = child->keys[0];
+        return;
+    }
+    if (right != NULL && right->count > BPLUS_LEAF_MIN) {
+        child->keys[child->count] = right->keys[0];
+        child->values[child->count] = right->values[0];
+        child->count++;
+        right->count--;
+        memmove(right->keys, &right->keys[1], right->count * sizeof(BPlusKey));
+        memmove(right->values, &right->values[1], right->count * sizeof(BPlusValue));
+        parent->keys[i] = right->keys[0];
+        return;
+    }
+    // Neither sibling can spare a key, so the pair fits in one leaf.
+    if (left == NULL) {
+        left = child;
+        child = right;
+        i++;
+    }
+    memcpy(&left->keys[left->count], child->keys, child->count * sizeof(BPlusKey));
+    memcpy(&left->values[left->count], child->values, child->count * sizeof(BPlusValue));
+    left->count += child->count;
+    left->next = child->next;
+    free(child);
+    bplus_remove_separator(parent, i - 1);
+}
+
+// As bplus_fix_leaf for an internal child. Keys rotate through the parent:
+// the separator comes down and the sibling's end key replaces it.
+void bplus_fix_internal(BPlusInternal* parent, int i) {
+    BPlusInternal* child = parent->children[i];
+    BPlusInternal* left = (i > 0) ? parent->children[i - 1] : NULL;
+    BPlusInternal* right = (i < parent->count) ? parent->children[i + 1] : NULL;
+    if (left != NULL && left->count > BPLUS_INTERNAL_MIN) {
+        memmove(&child->keys[1], child->keys, child->count * sizeof(BPlusKey));
+        memmove(&child->children[1], child->children, (child->count + 1) * sizeof(void*));
+        child->keys[0] = parent->keys[i - 1];
+        child->children[0] = left->children[left->count];
+        child->count++;
+        parent->keys[i - 1] = left->keys[left->count - 1];
+        left->count--;
+        return;
+    }
+    if (right != NULL && right->count > BPLUS_INTERNAL_MIN) {
+        child->keys[child->count] = parent->keys[i];
+        child->children[child->count + 1] = right->children[0];
+        child->count++;
+        parent->keys[i] = right->keys[0];
+        right->count--;
+        memmove(right->keys, &right->keys[1], right->count * sizeof(BPlusKey));
+        memmove(right->children, &right->children[1], (right->count + 1) * sizeof(void*));
+        return;
+    }
+    if (left == NULL) {
+        left = child;
+        child = right;
+        i++;
+    }
+    left->keys[left->count] = parent->keys[i - 1];
+    memcpy(&left->keys[left->count + 1], child->keys, child->count * sizeof(BPlusKey));
+    memcpy(&left->children[left->count + 1], child->children, (child->count + 1) * sizeof(void*));
+    left->count += child->count + 1;
+    free(child);
+    bplus_remove_separator(parent, i - 1);
+}
+
+// Removes key from the subtree at node. Separators equal to a removed key may
+// stay behind; they still divide the children correctly.
+int bplus_delete_from(BPlusTree* tree, void* node, int level, BPlusKey key) {
+    if (level == 0) {
+        BPlusLeaf* leaf = node;
+        int i = bplus_rank(tree, leaf->keys, leaf->count, key);
+        if (i == leaf->count || BPLUS_KEY_LESS(key, leaf->keys[i])) {
+            return 0;
+        }
+        leaf->count--;
+        memmove(&leaf->keys[i], &leaf->keys[i + 1], (leaf->count - i) * sizeof(BPlusKey));
+        memmove(&leaf->values[i], &leaf->values[i + 1], (leaf->count - i) * sizeof(BPlusValue));
+        return 1;
+    }
+    BPlusInternal* inner = node;
+    int i = bplus_child_index(tree, inner, key);
+    if (!bplus_delete_from(tree, inner->children[i], level - 1, key)) {
+        return 0;
+    }
+    if (level == 1) {
+        if (((BPlusLeaf*)inner->children[i])->count < BPLUS_LEAF_MIN) {
+            bplus_fix_leaf(inner, i);
+        }
+    }
+    else if (((BPlusInternal*)inner->children[i])->count < BPLUS_INTERNAL_MIN) {
+        bplus_fix_internal(inner, i);
+    }
+    return 1;
+}
+
+int bplus_delete(BPlusTree* tree, BPlusKey key) {
+    if (tree == NULL) {
+        fprintf(stderr, "Cannot pass NULL as tree\n");
+        return 0;
+    }
+    if (!bplus_delete_from(tree, tree->root, tree->height, key)) {
+        return 0;
+    }
+    tree->size--;
+    // A root left with a single child is dropped: shrink a level.
+    if (tree->height > 0 && ((BPlusInternal*)tree->root)->count == 0) {
+        BPlusInternal* root = tree->root;
+        tree->root = root->children[0];
+        tree->height--;
+        free(root);
+    }
+    return 1;
+}
+
+// === LOOKUP ===
+
+BPlusValue* bplus_find(BPlusTree* tree, BPlusKey key) {
+    if (tree == NULL) {
+        fprintf(stderr, "Cannot pass NULL as tree\n");
+        return NULL;
+    }
+    BPlusLeaf* leaf = bplus_find_leaf(tree, key);
+    int i = bplus_rank(tree, leaf->keys, leaf->count, key);
+    if (i == leaf->count || BPLUS_KEY_LESS(key, leaf->keys[i])) {
+        return NULL;
+    }
+    return &leaf->values[i];
+}
+
+int bplus_min(BPlusTree* tree, BPlusKey* key) {
+    if (tree == NULL || key == NULL) {
+        fprintf(stderr, "Cannot pass NULL as tree or key\n");
+        return 0;
+    }
+    void* node = tree->root;
+    for (int level = tree->height; level > 0; level--) {
+        node = ((BPlusInternal*)node)->children[0];
+    }
+    BPlusLeaf* leaf = node;
+    if (leaf->count == 0) {
+        return 0;
+    }
+    *key = leaf->keys[0];
+    return 1;
+}
+
+int bplus_max(BPlusTree* tree, BPlusKey* key) {
+    if (tree == NULL || key == NULL) {
+        fprintf(stderr, "Cannot pass NULL as tree or key\n");
+        return 0;
+    }
+    void* node = tree->root;
+    for (int level = tree->height; level > 0; level--) {
+        BPlusInternal* inner = node;
+        node = inner->children[inner->count];
+    }
+    BPlusLeaf* leaf = node;
+    if (leaf->count == 0) {
+        return 0;
+    }
+    *key = leaf->keys[leaf->count - 1];
+    return 1;
+}
+
+// === ITERATION ===
+
+BPlusIterator bplus_iter_begin(BPlusTree* tree) {
+    BPlusIterator it = {NULL, 0};
+    if (tree == NULL) {
+        fprintf(stderr, "Cannot pass NULL as tree\n");
+        return it;
+    }
+    void* node = tree->root;
+    for (int level = tree->height; level > 0; level--) {
+        node = ((BPlusInternal*)node)->children[0];
+    }
+    it.leaf = node;
+    return it;
+}
+
+BPlusIterator bplus_iter_from(BPlusTree* tree, BPlusKey key) {
+    BPlusIterator it = {NULL, 0};
+    if (tree == NULL) {
+        fprintf(stderr, "Cannot pass NULL as tree\n");
+        return it;
+    }
+    it.leaf = bplus_find_leaf(tree, key);
+    it.index = bplus_rank(tree, it.leaf->keys, it.leaf->count, key);
+    return it;
+}
+
+int bplus_iter_next(BPlusIterator* it, BPlusKey* key, BPlusValue* value) {
+    if (it == NULL) {
+        return 0;
+    }
+    // Past the end of this leaf (or in the empty root): step along the chain.
+    while (it->leaf != NULL && it->index >= it->leaf->count) {
+        it->leaf = it->leaf->next;
+        it->index = 0;
+    }
+    if (it->leaf == NULL) {
+        return 0;
+    }
+    if (key != NULL) {
+        *key = it->leaf->keys[it->index];
+    }
+    if (value != NULL) {
+        *value = it->leaf->values[it->index];
+    }
+    it->index++;
+    return 1;
+}
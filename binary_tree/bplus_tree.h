@@ -0,0 +1,159 @@
+#ifndef BPLUS_TREE_H
+#define BPLUS_TREE_H
+
+/**
+ * B+-Tree Ordered Map
+ * An in-memory B+-tree: every key/value pair lives in a leaf, leaves are
+ * linked in key order for range scans, and internal nodes hold only
+ * separators. Nodes are BPLUS_NODE_BYTES (a multiple of 64) and cache-line
+ * aligned, so a lookup touches a handful of lines per level and about
+ * log_20(n) levels, where a binary tree chases one pointer per key compared.
+ *
+ * Key and value types are chosen at compile time:
+ *   -DBPLUS_KEY_TYPE=long -DBPLUS_VALUE_TYPE=double
+ * Keys are compared with BPLUS_KEY_LESS(a, b), which defaults to a < b and can
+ * be defined for struct keys or another order. The default int keys with the
+ * default comparator are searched with AVX2 when the CPU has it; build with
+ * -DBPLUS_NO_SIMD for the scalar search only.
+ */
+
+#include <stddef.h>
+
+// The AVX2 search assumes plain int keys in ascending order, so it is only
+// used when neither the key type nor the comparator is overridden.
+#if !defined(BPLUS_KEY_TYPE) && !defined(BPLUS_KEY_LESS)
+#define BPLUS_KEY_IS_INT 1
+#endif
+
+#ifndef BPLUS_KEY_TYPE
+#define BPLUS_KEY_TYPE int
+#endif
+
+#ifndef BPLUS_VALUE_TYPE
+#define BPLUS_VALUE_TYPE int
+#endif
+
+#ifndef BPLUS_KEY_LESS
+#define BPLUS_KEY_LESS(a, b) ((a) < (b))
+#endif
+
+#ifndef BPLUS_NODE_BYTES
+#define BPLUS_NODE_BYTES 256
+#endif
+
+typedef BPLUS_KEY_TYPE BPlusKey;
+typedef BPLUS_VALUE_TYPE BPlusValue;
+
+// Capacities that fill BPLUS_NODE_BYTES after each node's bookkeeping.
+#define BPLUS_LEAF_KEYS ((BPLUS_NODE_BYTES - 2 * sizeof(void*)) / (sizeof(BPlusKey) + sizeof(BPlusValue)))
+#define BPLUS_INTERNAL_KEYS ((BPLUS_NODE_BYTES - 2 * sizeof(void*)) / (sizeof(BPlusKey) + sizeof(void*)))
+
+/**
+ * Leaf node: sorted keys, their values, and the next leaf in key order
+ */
+typedef struct BPlusLeaf {
+    BPlusKey keys[BPLUS_LEAF_KEYS];
+    BPlusValue values[BPLUS_LEAF_KEYS];
+    int count;              // Keys in use
+    struct BPlusLeaf* next; // Leaf with the next larger keys, or NULL
+} BPlusLeaf;
+
+/**
+ * Internal node: children[i] holds keys < keys[i] <= children[i + 1]
+ */
+typedef struct BPlusInternal {
+    BPlusKey keys[BPLUS_INTERNAL_KEYS];
+    int count;              // Separator keys in use (children = count + 1)
+    void* children[BPLUS_INTERNAL_KEYS + 1];
+} BPlusInternal;
+
+/**
+ * Tree handle
+ */
+typedef struct BPlusTree {
+    void* root;   // A BPlusLeaf when height is 0, otherwise a BPlusInternal
+    int height;   // Internal levels above the leaves
+    int size;     // Number of keys stored
+    int use_simd; // Search nodes with AVX2 (int keys on a CPU that has it)
+} BPlusTree;
+
+/**
+ * Position in the leaf chain, for in-order and range iteration
+ */
+typedef struct BPlusIterator {
+    BPlusLeaf* leaf; // NULL once past the last key
+    int index;
+} BPlusIterator;
+
+// === MEMORY MANAGEMENT ===
+
+/**
+ * Creates an empty tree
+ * @return: Pointer to tree, or NULL if allocation fails
+ */
+BPlusTree* create_bplus_tree();
+
+/**
+ * Builds a tree bottom-up from strictly ascending keys in O(n)
+ * Leaves and internal nodes are filled evenly and as full as possible.
+ * @param keys: Ascending keys, no duplicates
+ * @param values: Their values, or NULL to store zeros
+ * @param count: Number of keys
+ * @return: Pointer to tree, or NULL on allocation failure or unsorted keys
+ */
+BPlusTree* bplus_bulk_load(const BPlusKey* keys, const BPlusValue* values, int count);
+
+/**
+ * Frees the tree and all its nodes
+ * @param tree: Pointer to tree pointer (set to NULL)
+ */
+void destroy_bplus_tree(BPlusTree** tree);
+
+// === MAP OPERATIONS ===
+
+/**
+ * Inserts a key, or updates its value if already present
+ * @return: 1 if inserted, 0 if updated, -1 on allocation failure
+ */
+int bplus_insert(BPlusTree* tree, BPlusKey key, BPlusValue value);
+
+/**
+ * Removes a key, merging or rebalancing nodes that fall below half full
+ * @return: 1 if removed, 0 if not present
+ */
+int bplus_delete(BPlusTree* tree, BPlusKey key);
+
+/**
+ * Looks up a key
+ * @return: Pointer to its value (valid until the next insert or delete), or NULL
+ */
+BPlusValue* bplus_find(BPlusTree* tree, BPlusKey key);
+
+/**
+ * Smallest / largest key
+ * @param key: Receives the key
+ * @return: 1 if found, 0 if the tree is empty
+ */
+int bplus_min(BPlusTree* tree, BPlusKey* key);
+int bplus_max(BPlusTree* tree, BPlusKey* key);
+
+// === ITERATION ===
+
+/**
+ * Iterator at the smallest key
+ */
+BPlusIterator bplus_iter_begin(BPlusTree* tree);
+
+/**
+ * Iterator at the first key >= key, for range scans
+ */
+BPlusIterator bplus_iter_from(BPlusTree* tree, BPlusKey key);
+
+/**
+ * Reads the current pair and advances along the leaf chain
+ * @param key, value: Receive the pair (either may be NULL)
+ * @return: 1 if a pair was read, 0 at the end
+ */
+int bplus_iter_next(BPlusIterator* it, BPlusKey* key, BPlusValue* value);
+
+#endif
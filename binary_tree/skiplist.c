@@ -0,0 +1,486 @@
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "skiplist.h"
+
+// Retirements between attempts to advance the global epoch.
+#define SKIPLIST_ADVANCE_EVERY 64
+
+#define SKIP_MARK ((uintptr_t)1)
+#define SKIP_PTR(raw) ((SkipNode*)((raw) & ~SKIP_MARK))
+#define SKIP_MARKED(raw) ((raw) & SKIP_MARK)
+
+static atomic_ulong skiplist_next_id = 1;
+
+// A thread is identified by the address of one of its thread-locals, which
+// is unique among running threads. The slot it holds in the list it used
+// last is cached.
+static _Thread_local char skiplist_thread_anchor;
+static _Thread_local unsigned long skiplist_cached_id;
+static _Thread_local EpochSlot* skiplist_cached_slot;
+static _Thread_local uint64_t skiplist_rng_state;
+
+// === MEMORY MANAGEMENT ===
+
+SkipNode* skiplist_alloc_node(int val, int levels) {
+    SkipNode* node = malloc(sizeof(SkipNode) + levels * sizeof(_Atomic uintptr_t));
+    if (node == NULL) {
+        return NULL;
+    }
+    node->value = val;
+    node->levels = levels;
+    atomic_init(&node->refs, 2);
+    node->retired_next = NULL;
+    for (int i = 0; i < levels; i++) {
+        atomic_init(&node->next[i], 0);
+    }
+    return node;
+}
+
+SkipList* create_skiplist() {
+    SkipList* list = aligned_alloc(64, (sizeof(SkipList) + 63) / 64 * 64);
+    if (list == NULL) {
+        fprintf(stderr, "Memory allocation failed for skiplist\n");
+        return NULL;
+    }
+    list->head = skiplist_alloc_node(0, SKIPLIST_MAX_LEVEL);
+    if (list->head == NULL) {
+        fprintf(stderr, "Memory allocation failed for skiplist\n");
+        free(list);
+        return NULL;
+    }
+    atomic_init(&list->epoch, 1);
+    atomic_init(&list->size, 0);
+    atomic_init(&list->num_slots, 0);
+    list->id = atomic_fetch_add(&skiplist_next_id, 1);
+    for (int i = 0; i < SKIPLIST_MAX_THREADS; i++) {
+        EpochSlot* slot = &list->slots[i];
+        atomic_init(&slot->owner, 0);
+        atomic_init(&slot->state, 0);
+        slot->last_epoch = 0;
+        slot->retired[0] = slot->retired[1] = slot->retired[2] = NULL;
+        slot->retired_count = 0;
+    }
+    return list;
+}
+
+void skiplist_free_chain(SkipNode* node) {
+    while (node != NULL) {
+        SkipNode* next = node->retired_next;
+        free(node);
+        node = next;
+    }
+}
+
+void destroy_skiplist(SkipList** list) {
+    if (list == NULL || *list == NULL) {
+        return;
+    }
+    // Quiescent: every node still linked at level 0 is live, every other
+    // node has been retired into some slot.
+    SkipNode* node = SKIP_PTR(atomic_load(&(*list)->head->next[0]));
+    while (node != NULL) {
+        SkipNode* next = SKIP_PTR(atomic_load(&node->next[0]));
+        free(node);
+        node = next;
+    }
+    for (int i = 0; i < SKIPLIST_MAX_THREADS; i++) {
+        for (int j = 0; j < 3; j++) {
+            skiplist_free_chain((*list)->slots[i].retired[j]);
+        }
+    }
+    free((*list)->head);
+    free(*list);
+    *list = NULL;
+}
+
+// === EPOCH-BASED RECLAMATION ===
+
+EpochSlot* skiplist_thread_slot(SkipList* list) {
+    if (skiplist_cached_id == list->id) {
+        return skiplist_cached_slot;
+    }
+    uintptr_t self = (uintptr_t)&skiplist_thread_anchor;
+    EpochSlot* found = NULL;
+    int claimed = atomic_load(&list->num_slots);
+    for (int i = 0; i < claimed && found == NULL; i++) {
+        if (atomic_load(&list->slots[i].owner) == self) {
+            found = &list->slots[i];
+        }
+    }
+    for (int i = 0; i < SKIPLIST_MAX_THREADS && found == NULL; i++) {
+        uintptr_t expected = 0;
+        if (atomic_compare_exchange_strong(&list->slots[i].owner, &expected, self)) {
+            found = &list->slots[i];
+            int seen = atomic_load(&list->num_slots);
+            while (seen < i + 1 && !atomic_compare_exchange_weak(&list->num_slots, &seen, i + 1)) {
+            }
+        }
+    }
+    if (found == NULL) {
+        fprintf(stderr, "Skiplist supports at most %d threads\n", SKIPLIST_MAX_THREADS);
+        return NULL;
+    }
+    skiplist_cached_id = list->id;
+    skiplist_cached_slot = found;
+    return found;
+}
+
+void skiplist_release_thread(SkipList* list) {
+    if (list == NULL) {
+        return;
+    }
+    uintptr_t self = (uintptr_t)&skiplist_thread_anchor;
+    int claimed = atomic_load(&list->num_slots);
+    for (int i = 0; i < claimed; i++) {
+        if (atomic_load(&list->slots[i].owner) == self) {
+            atomic_store(&list->slots[i].owner, 0);
+        }
+    }
+    if (skiplist_cached_id == list->id) {
+        skiplist_cached_id = 0;
+        skiplist_cached_slot = NULL;
+    }
+}
+
+// Announces the current epoch before the thread reads any node, and frees
+// its nodes retired two or more epochs ago, which nobody can reach any more.
+EpochSlot* skiplist_enter(SkipList* list) {
+    EpochSlot* slot = skiplist_thread_slot(list);
+    if (slot == NULL) {
+        return NULL;
+    }
+    // Retry until the announcement is visible before the epoch can move on,
+    // so no advance past epoch + 1 can miss it.
+    unsigned long epoch = atomic_load(&list->epoch);
+    for (;;) {
+        atomic_store(&slot->state, (epoch << 1) | 1);
+        unsigned long now = atomic_load(&list->epoch);
+        if (now == epoch) {
+            break;
+        }
+        epoch = now;
+    }
+    if (epoch != slot->last_epoch) {
+        // Holds nodes retired in epochs congruent to epoch - 2, all <= epoch - 2.
+        SkipNode** stale = &slot->retired[(epoch + 1) % 3];
+        skiplist_free_chain(*stale);
+        *stale = NULL;
+        slot->last_epoch = epoch;
+    }
+    return slot;
+}
+
+void skiplist_exit(EpochSlot* slot) {
+    atomic_store(&slot->state, 0);
+}
+
+// Moves the global epoch on if every thread inside an operation has seen it.
+void skiplist_try_advance(SkipList* list) {
+    unsigned long epoch = atomic_load(&list->epoch);
+    int claimed = atomic_load(&list->num_slots);
+    for (int i = 0; i < claimed; i++) {
+        unsigned long state = atomic_load(&list->slots[i].state);
+        if ((state & 1) && (state >> 1) != epoch) {
+            return;
+        }
+    }
+    atomic_compare_exchange_strong(&list->epoch, &epoch, epoch + 1);
+}
+
+// Files an unlinked node under the global epoch, which may be ahead of the
+// one this thread announced. A thread that can still reach the node entered
+// no later than that epoch, so the epoch cannot pass it by two until that
+// thread is done.
+void skiplist_retire(SkipList* list, EpochSlot* slot, SkipNode* node) {
+    SkipNode** bag = &slot->retired[atomic_load(&list->epoch) % 3];
+    node->retired_next = *bag;
+    *bag = node;
+    if (++slot->retired_count >= SKIPLIST_ADVANCE_EVERY) {
+        slot->retired_count = 0;
+        skiplist_try_advance(list);
+    }
+}
+
+// Drops the inserter's or the deleter's hold on a node. Both must be done
+// with it, and it unlinked from every level, before it can be retired.
+void skiplist_release_node(SkipList* list, EpochSlot* slot, SkipNode* node) {
+    if (atomic_fetch_sub(&node->refs, 1) == 1) {
+        skiplist_retire(list, slot, node);
+    }
+}
+
+// === SEARCH ===
+
+int skiplist_random_level() {
+    if (skiplist_rng_state == 0) {
+        skiplist_rng_state = (uint64_t)(uintptr_t)&skiplist_thread_anchor * 0x9E3779B97F4A7C15ULL | 1;
+    }
+    // xorshift64*
+    skiplist_rng_state ^= skiplist_rng_state >> 12;
+    skiplist_rng_state ^= skiplist_rng_state << 25;
+    skiplist_rng_state ^= skiplist_rng_state >> 27;
+    uint32_t bits = (uint32_t)((skiplist_rng_state * 0x2545F4914F6CDD1DULL) >> 32);
+    return 1 + __builtin_ctz(bits | (1u << (SKIPLIST_MAX_LEVEL - 1)));
+}
+
+// Fills preds/succs with the nodes either side of val on every level,
+// unlinking marked nodes on the way. succs[level] is the first unmarked node
+// >= val, or NULL.
+// @return: 1 if succs[0] holds val
+int skiplist_search(SkipList* list, int val, SkipNode** preds, SkipNode** succs) {
+retry:;
+    SkipNode* pred = list->head;
+    for (int level = SKIPLIST_MAX_LEVEL - 1; level >= 0; level--) {
+        SkipNode* curr = SKIP_PTR(atomic_load(&pred->next[level]));
+        while (curr != NULL) {
+            uintptr_t succ = atomic_load(&curr->next[level]);
+            while (SKIP_MARKED(succ)) {
+                uintptr_t expected = (uintptr_t)curr;
+                if (!atomic_compare_exchange_strong(&pred->next[level], &expected, succ & ~SKIP_MARK)) {
+                    goto retry;
+                }
+                curr = SKIP_PTR(succ);
+                if (curr == NULL) {
+                    break;
+                }
+                succ = atomic_load(&curr->next[level]);
+            }
+            if (curr == NULL || curr->value >= val) {
+                break;
+            }
+            pred = curr;
+            curr = SKIP_PTR(succ);
+        }
+        preds[level] = pred;
+        succs[level] = curr;
+    }
+    return succs[0] != NULL && succs[0]->value == val;
+}
+
+// Read-only descent: the last node < val on level 0, stepping over marked
+// nodes without unlinking them.
+SkipNode* skiplist_lower(SkipList* list, int val) {
+    SkipNode* pred = list->head;
+    for (int level = SKIPLIST_MAX_LEVEL - 1; level >= 0; level--) {
+        SkipNode* curr = SKIP_PTR(atomic_load(&pred->next[level]));
+        while (curr != NULL) {
+            uintptr_t succ = atomic_load(&curr->next[level]);
+            if (!SKIP_MARKED(succ)) {
+                if (curr->value >= val) {
+                    break;
+                }
+                pred = curr;
+            }
+            curr = SKIP_PTR(succ);
+        }
+    }
+    return pred;
+}
+
+// === SET OPERATIONS ===
+
+int skiplist_insert(SkipList* list, int val) {
+    if (list == NULL) {
+        return -1;
+    }
+    EpochSlot* slot = skiplist_enter(list);
+    if (slot == NULL) {
+        return -1;
+    }
+    SkipNode* preds[SKIPLIST_MAX_LEVEL];
+    SkipNode* succs[SKIPLIST_MAX_LEVEL];
+    SkipNode* node = NULL;
+    int levels = skiplist_random_level();
+    for (;;) {
+        if (skiplist_search(list, val, preds, succs)) {
+            free(node); // Never published
+            skiplist_exit(slot);
+            return 0;
+        }
+        if (node == NULL) {
+            node = skiplist_alloc_node(val, levels);
+            if (node == NULL) {
+                fprintf(stderr, "Memory allocation failed for skiplist node\n");
+                skiplist_exit(slot);
+                return -1;
+            }
+        }
+        for (int i = 0; i < levels; i++) {
+            atomic_store(&node->next[i], (uintptr_t)succs[i]);
+        }
+        // Linking level 0 puts val in the set.
+        uintptr_t expected = (uintptr_t)succs[0];
+        if (atomic_compare_exchange_strong(&preds[0]->next[0], &expected, (uintptr_t)node)) {
+            break;
+        }
+    }
+    atomic_fetch_add(&list->size, 1);
+
+    // Link the express levels. A delete may mark the node meanwhile; then
+    // stop, since marked next pointers can no longer be redirected.
+    for (int i = 1; i < levels; i++) {
+        for (;;) {
+            uintptr_t next = atomic_load(&node->next[i]);
+            if (SKIP_MARKED(next)) {
+                goto linked;
+            }
+            if (SKIP_PTR(next) != succs[i] &&
+                !atomic_compare_exchange_strong(&node->next[i], &next, (uintptr_t)succs[i])) {
+                goto linked;
+            }
+            uintptr_t expected = (uintptr_t)succs[i];
+            if (atomic_compare_exchange_strong(&preds[i]->next[i], &expected, (uintptr_t)node)) {
+                break;
+            }
+            if (!skiplist_search(list, val, preds, succs) || succs[0] != node) {
+                goto linked;
+            }
+        }
+    }
+linked:
+    // A delete that finished unlinking before our last link missed it.
+    if (SKIP_MARKED(atomic_load(&node->next[0]))) {
+        skiplist_search(list, val, preds, succs);
+    }
+    skiplist_release_node(list, slot, node);
+    skiplist_exit(slot);
+    return 1;
+}
+
+int skiplist_delete(SkipList* list, int val) {
+    if (list == NULL) {
+        return 0;
+    }
+    EpochSlot* slot = skiplist_enter(list);
+    if (slot == NULL) {
+        return 0;
+    }
+    SkipNode* preds[SKIPLIST_MAX_LEVEL];
+    SkipNode* succs[SKIPLIST_MAX_LEVEL];
+    if (!skiplist_search(list, val, preds, succs)) {
+        skiplist_exit(slot);
+        return 0;
+    }
+    SkipNode* node = succs[0];
+    for (int i = node->levels - 1; i >= 1; i--) {
+        uintptr_t next = atomic_load(&node->next[i]);
+        while (!SKIP_MARKED(next) &&
+               !atomic_compare_exchange_weak(&node->next[i], &next, next | SKIP_MARK)) {
+        }
+    }
+    // Marking level 0 takes val out of the set; only one delete can win it.
+    uintptr_t next = atomic_load(&node->next[0]);
+    for (;;) {
+        if (SKIP_MARKED(next)) {
+            skiplist_exit(slot);
+            return 0;
+        }
+        if (atomic_compare_exchange_weak(&node->next[0], &next, next | SKIP_MARK)) {
+            break;
+        }
+    }
+    atomic_fetch_sub(&list->size, 1);
+    skiplist_search(list, val, preds, succs); // Unlinks it from every level
+    skiplist_release_node(list, slot, node);
+    skiplist_exit(slot);
+    return 1;
+}
+
+int skiplist_find(SkipList* list, int val) {
+    if (list == NULL) {
+        return 0;
+    }
+    EpochSlot* slot = skiplist_enter(list);
+    if (slot == NULL) {
+        return 0;
+    }
+    SkipNode* pred = skiplist_lower(list, val);
+    int found = 0;
+    // Nodes < val may have been linked after pred since the descent.
+    SkipNode* curr = SKIP_PTR(atomic_load(&pred->next[0]));
+    while (curr != NULL) {
+        uintptr_t succ = atomic_load(&curr->next[0]);
+        if (!SKIP_MARKED(succ) && curr->value >= val) {
+            found = curr->value == val;
+            break;
+        }
+        curr = SKIP_PTR(succ);
+    }
+    skiplist_exit(slot);
+    return found;
+}
+
+int skiplist_min(SkipList* list, int* val) {
+    if (list == NULL || val == NULL) {
+        return 0;
+    }
+    EpochSlot* slot = skiplist_enter(list);
+    if (slot == NULL) {
+        return 0;
+    }
+    int found = 0;
+    SkipNode* curr = SKIP_PTR(atomic_load(&list->head->next[0]));
+    while (curr != NULL) {
+        uintptr_t succ = atomic_load(&curr->next[0]);
+        if (!SKIP_MARKED(succ)) {
+            *val = curr->value;
+            found = 1;
+            break;
+        }
+        curr = SKIP_PTR(succ);
+    }
+    skiplist_exit(slot);
+    return found;
+}
+
+int skiplist_max(SkipList* list, int* val) {
+    if (list == NULL || val == NULL) {
+        return 0;
+    }
+    EpochSlot* slot = skiplist_enter(list);
+    if (slot == NULL) {
+        return 0;
+    }
+    // Descend to the last node below INT_MAX, then walk the rest of level 0.
+    SkipNode* last = skiplist_lower(list, INT_MAX);
+    SkipNode* curr = SKIP_PTR(atomic_load(&last->next[0]));
+    while (curr != NULL) {
+        uintptr_t succ = atomic_load(&curr->next[0]);
+        if (!SKIP_MARKED(succ)) {
+            last = curr;
+        }
+        curr = SKIP_PTR(succ);
+    }
+    int found = last != list->head;
+    if (found) {
+        *val = last->value;
+    }
+    skiplist_exit(slot);
+    return found;
+}
+
+int skiplist_range(SkipList* list, int lo, int hi, int* out, int max) {
+    if (list == NULL || out == NULL || lo >= hi) {
+        return 0;
+    }
+    EpochSlot* slot = skiplist_enter(list);
+    if (slot == NULL) {
+        return 0;
+    }
+    int count = 0;
+    SkipNode* curr = SKIP_PTR(atomic_load(&skiplist_lower(list, lo)->next[0]));
+    while (curr != NULL && count < max && curr->value < hi) {
+        uintptr_t succ = atomic_load(&curr->next[0]);
+        if (!SKIP_MARKED(succ) && curr->value >= lo) {
+            out[count++] = curr->value;
+        }
+        curr = SKIP_PTR(succ);
+    }
+    skiplist_exit(slot);
+    return count;
+}
+
+int skiplist_size(SkipList* list) {
+    return list != NULL ? atomic_load(&list->size) : 0;
+}
@@ -0,0 +1,138 @@
+#ifndef SKIPLIST_H
+#define SKIPLIST_H
+
+/**
+ * Lock-Free Skiplist
+ * A concurrent ordered set of ints that any number of threads may share
+ * without locks. It mirrors the BST operations: insert, delete, find,
+ * min/max and range scans.
+ *
+ * Each node sits in the bottom list and, with probability 1/2 per level, in
+ * the express lists above it, so searches skip ahead in O(log n) expected
+ * steps. Links are changed only by compare-and-swap. A delete first marks
+ * the low bit of the node's next pointers, top level down, and the mark on
+ * level 0 is the moment the key leaves the set. Any thread that walks past
+ * a marked node then unlinks it (Harris / Fraser / Herlihy-Shavit).
+ *
+ * Unlinked nodes are freed by epoch-based reclamation. Every operation
+ * announces the global epoch it started in, and the epoch only advances once
+ * every running operation has announced it. A node unlinked in epoch e is
+ * freed once the epoch reaches e + 2, when every operation that could have
+ * been walking through it has finished.
+ *
+ * Guarantees: insert, delete and find are linearizable. Range scans, min and
+ * max walk the bottom list and are weakly consistent, like the skiplists in
+ * java.util.concurrent: keys come back in order, every key returned was
+ * present at some moment during the call, and every key present for the
+ * whole call is seen.
+ *
+ * Threads are registered on their first call, up to SKIPLIST_MAX_THREADS
+ * per list at once. A thread that exits should call skiplist_release_thread
+ * first so its slot can be reused. Link with -pthread.
+ */
+
+#include <stdatomic.h>
+#include <stdint.h>
+
+#define SKIPLIST_MAX_LEVEL 32
+#define SKIPLIST_MAX_THREADS 256
+
+/**
+ * Node: value plus one next pointer per level it appears on
+ * The low bit of a next pointer marks the node as deleted at that level.
+ */
+typedef struct SkipNode {
+    int value;
+    int levels;                      // Lists this node is linked into (1 = bottom only)
+    atomic_int refs;                 // Inserter and deleter; the last to finish retires it
+    struct SkipNode* retired_next;   // Chain in its reclaiming thread's retired list
+    _Atomic uintptr_t next[];        // SkipNode* | deleted bit
+} SkipNode;
+
+/**
+ * Per-thread reclamation state, one cache line each
+ */
+typedef struct EpochSlot {
+    _Alignas(64) _Atomic uintptr_t owner; // Thread using this slot, 0 = free
+    _Atomic unsigned long state;          // (epoch << 1) | 1 while in an operation, else 0
+    unsigned long last_epoch;             // Epoch of the owner's last operation
+    SkipNode* retired[3];                 // Unlinked nodes waiting, by epoch mod 3
+    int retired_count;                    // Retirements since the last epoch advance attempt
+} EpochSlot;
+
+/**
+ * Skiplist handle
+ */
+typedef struct SkipList {
+    SkipNode* head;               // Sentinel linked into every level
+    _Atomic unsigned long epoch;  // Global reclamation epoch
+    atomic_int size;              // Number of keys (exact when no operation is running)
+    atomic_int num_slots;         // Slots ever claimed (scan bound)
+    unsigned long id;             // Distinguishes lists for per-thread caching
+    EpochSlot slots[SKIPLIST_MAX_THREADS];
+} SkipList;
+
+// === MEMORY MANAGEMENT ===
+
+/**
+ * Creates an empty skiplist
+ * @return: Pointer to skiplist, or NULL if allocation fails
+ */
+SkipList* create_skiplist();
+
+/**
+ * Frees the skiplist, its nodes and every retired node
+ * No other thread may be using it.
+ * @param list: Pointer to skiplist pointer (set to NULL)
+ */
+void destroy_skiplist(SkipList** list);
+
+/**
+ * Gives up the calling thread's slot in list, for a thread about to exit
+ * Nodes it retired stay in the slot and are freed by its next owner or by
+ * destroy_skiplist.
+ */
+void skiplist_release_thread(SkipList* list);
+
+// === SET OPERATIONS (thread-safe) ===
+
+/**
+ * Inserts a value
+ * @return: 1 if inserted, 0 if already present, -1 on allocation failure or
+ *          more than SKIPLIST_MAX_THREADS threads
+ */
+int skiplist_insert(SkipList* list, int val);
+
+/**
+ * Deletes a value
+ * @return: 1 if removed by this call, 0 if not present
+ */
+int skiplist_delete(SkipList* list, int val);
+
+/**
+ * Checks for a value
+ * @return: 1 if present, 0 if not
+ */
+int skiplist_find(SkipList* list, int val);
+
+/**
+ * Smallest / largest value (weakly consistent under concurrent updates)
+ * @param val: Receives the value
+ * @return: 1 if found, 0 if the set is empty
+ */
+int skiplist_min(SkipList* list, int* val);
+int skiplist_max(SkipList* list, int* val);
+
+/**
+ * Writes the values in [lo, hi) in ascending order, up to max of them
+ * Weakly consistent under concurrent updates (see above).
+ * @return: Number of values written
+ */
+int skiplist_range(SkipList* list, int lo, int hi, int* out, int max);
+
+/**
+ * Number of values (exact when no operation is running)
+ */
+int skiplist_size(SkipList* list);
+
+#endif
@@ -2,6 +2,7 @@
 #include <stdlib.h>
 #include <assert.h>
 #include <string.h>
+#include <limits.h>
 #include "binary_tree.h"
 
 // Test counter
@@ -50,8 +51,7 @@ void test_create_node() {
     
     Node* node = create_node(42);
     TEST_ASSERT_NOT_NULL(node, "create_node returns non-NULL");
-    TEST_ASSERT_NOT_NULL(node->val, "node->val is allocated");
-    TEST_ASSERT_EQUAL(42, *(node->val), "node value is correct");
+    TEST_ASSERT_EQUAL(42, node->value, "node value is correct");
     TEST_ASSERT_NULL(node->left, "left child is NULL");
     TEST_ASSERT_NULL(node->right, "right child is NULL");
     
@@ -155,6 +155,178 @@ void test_traversals() {
     destroy(&tree);
 }
 
+// Recursive reference traversal: appends values in the given order.
+void collect_recursive(Node* node, TraversalOrder order, int* out, int* count) {
+    if (node == NULL) {
+        return;
+    }
+    if (order == PREORDER) out[(*count)++] = node->value;
+    collect_recursive(node->left, order, out, count);
+    if (order == INORDER) out[(*count)++] = node->value;
+    collect_recursive(node->right, order, out, count);
+    if (order == POSTORDER) out[(*count)++] = node->value;
+}
+
+// Iterator output in one order, compared against the recursive version.
+int iterator_matches(Node* root, TraversalOrder order, int count) {
+    int* expected = malloc((count + 1) * sizeof(int));
+    int* actual = malloc((count + 1) * sizeof(int));
+    int expected_count = 0;
+    collect_recursive(root, order, expected, &expected_count);
+    TreeIterator it;
+    init_tree_iterator(&it, root, order);
+    int actual_count = 0;
+    Node* node;
+    while ((node = tree_iterator_next(&it)) != NULL && actual_count <= count) {
+        actual[actual_count++] = node->value;
+    }
+    destroy_tree_iterator(&it);
+    int same = actual_count == expected_count && memcmp(actual, expected, count * sizeof(int)) == 0;
+    free(expected);
+    free(actual);
+    return same;
+}
+
+typedef struct VisitState {
+    int* out;
+    int count;
+    int stop_after;
+} VisitState;
+
+int record_visit(Node* node, void* ctx) {
+    VisitState* state = ctx;
+    state->out[state->count++] = node->value;
+    return state->count == state->stop_after;
+}
+
+void test_traversal_iterators() {
+    printf("\n=== Testing traversal iterators and visitors ===\n");
+    Node* tree = create_test_tree();
+    int expected[3][4] = {{1, 2, 4, 3}, {4, 2, 1, 3}, {4, 2, 3, 1}};
+    TraversalOrder orders[3] = {PREORDER, INORDER, POSTORDER};
+    int ok = 1;
+    for (int o = 0; o < 3; o++) {
+        int values[4];
+        TreeIterator it;
+        init_tree_iterator(&it, tree, orders[o]);
+        ok &= tree_iterator_fill(&it, values, 4) == 4 && memcmp(values, expected[o], sizeof(values)) == 0;
+        ok &= tree_iterator_next(&it) == NULL;
+        destroy_tree_iterator(&it);
+    }
+    TEST_ASSERT(ok, "Iterators visit the test tree in pre-, in- and postorder");
+
+    VisitState state = {malloc(4 * sizeof(int)), 0, 2};
+    TEST_ASSERT_EQUAL(1, tree_visit(tree, INORDER, record_visit, &state), "Visitor can stop early");
+    TEST_ASSERT(state.count == 2 && state.out[0] == 4 && state.out[1] == 2, "Early exit after two nodes");
+    state.count = 0;
+    state.stop_after = -1;
+    TEST_ASSERT_EQUAL(0, tree_visit(tree, POSTORDER, record_visit, &state), "Visitor runs to completion");
+    TEST_ASSERT(state.count == 4 && memcmp(state.out, expected[2], 4 * sizeof(int)) == 0, "Visitor sees postorder");
+    free(state.out);
+    TEST_ASSERT_EQUAL(-1, tree_visit(tree, INORDER, NULL, NULL), "NULL visitor rejected");
+    TEST_ASSERT_EQUAL(0, tree_visit(NULL, INORDER, record_visit, &state), "Empty tree visits nothing");
+    destroy(&tree);
+
+    // A random AVL tree against the recursive reference, all orders.
+    int count = 20000;
+    Node* root = NULL;
+    srand(17);
+    for (int i = 0; i < count; i++) {
+        int val = rand();
+        if (binary_search(val, root) == NULL) root = avl_insert(val, root);
+    }
+    count = count_nodes(root);
+    TEST_ASSERT(iterator_matches(root, PREORDER, count), "Preorder iterator matches recursion");
+    TEST_ASSERT(iterator_matches(root, INORDER, count), "Inorder iterator matches recursion");
+    TEST_ASSERT(iterator_matches(root, POSTORDER, count), "Postorder iterator matches recursion");
+
+    // Bulk fill in uneven batches.
+    int* all = malloc(count * sizeof(int));
+    TreeIterator it;
+    init_tree_iterator(&it, root, INORDER);
+    int filled = 0;
+    int batch;
+    while ((batch = tree_iterator_fill(&it, all + filled, (count - filled < 777) ? count - filled : 777)) > 0) {
+        filled += batch;
+    }
+    destroy_tree_iterator(&it);
+    ok = filled == count;
+    for (int i = 1; i < filled; i++) ok &= all[i - 1] < all[i];
+    TEST_ASSERT(ok, "Batched fill streams the sorted values");
+
+    // Morris traversal leaves the tree exactly as it found it.
+    int* morris = malloc(count * sizeof(int));
+    TEST_ASSERT_EQUAL(count, inorder_to_array(root, morris, count), "inorder_to_array returns node count");
+    TEST_ASSERT(memcmp(morris, all, count * sizeof(int)) == 0, "inorder_to_array writes sorted values");
+    TEST_ASSERT_EQUAL(count, inorder_to_array(root, morris, 10), "Short buffer still returns node count");
+    // Distinct values in pre- and inorder pin down the shape.
+    TEST_ASSERT(iterator_matches(root, PREORDER, count) && iterator_matches(root, INORDER, count),
+                "Tree unchanged after Morris traversal");
+    TEST_ASSERT_EQUAL(0, inorder_to_array(NULL, morris, 10), "Empty tree has no values");
+    TEST_ASSERT_EQUAL(-1, inorder_to_array(root, NULL, 10), "NULL buffer rejected");
+    free(all);
+    free(morris);
+    destroy(&root);
+}
+
+void test_deep_traversals() {
+    printf("\n=== Testing traversals of list-shaped trees ===\n");
+    // Chains deep enough to overflow a recursive traversal, built by linking
+    // nodes directly, with 0 the deepest.
+    int depth = 200000;
+    Node** nodes = malloc(depth * sizeof(Node*));
+    for (int i = 0; i < depth; i++) nodes[i] = create_node(i);
+    // Shape 0 is a left chain; in shape 1 each node's only child alternates
+    // sides. Either way preorder runs top-down and postorder bottom-up.
+    for (int shape = 0; shape < 2; shape++) {
+        for (int i = 1; i < depth; i++) {
+            int left = (shape == 0) || (i % 2);
+            nodes[i]->left = left ? nodes[i - 1] : NULL;
+            nodes[i]->right = left ? NULL : nodes[i - 1];
+        }
+        Node* chain = nodes[depth - 1];
+        int ok = 1;
+        TraversalOrder orders[3] = {PREORDER, INORDER, POSTORDER};
+        for (int o = 0; o < 3; o++) {
+            if (shape == 1 && orders[o] == INORDER) {
+                continue; // Inorder of a zigzag is not a simple sequence
+            }
+            TreeIterator it;
+            init_tree_iterator(&it, chain, orders[o]);
+            int seen = 0;
+            Node* node;
+            while ((node = tree_iterator_next(&it)) != NULL) {
+                ok &= node->value == ((orders[o] == PREORDER) ? depth - 1 - seen : seen);
+                seen++;
+            }
+            destroy_tree_iterator(&it);
+            ok &= seen == depth;
+        }
+        TEST_ASSERT(ok, (shape == 0) ? "Iterators walk a 200000-deep left chain"
+                                     : "Iterators walk a 200000-deep zigzag");
+    }
+    int* values = malloc(depth * sizeof(int));
+    for (int i = 1; i < depth; i++) {
+        nodes[i]->left = nodes[i - 1];
+        nodes[i]->right = NULL;
+    }
+    TreeIterator it;
+    init_tree_iterator(&it, nodes[depth - 1], INORDER);
+    int ok = tree_iterator_fill(&it, values, depth) == depth;
+    destroy_tree_iterator(&it);
+    for (int i = 0; i < depth; i++) ok &= values[i] == i;
+    TEST_ASSERT(ok, "Batched fill walks the deep chain");
+    memset(values, 0, depth * sizeof(int));
+    ok = inorder_to_array(nodes[depth - 1], values, depth) == depth;
+    for (int i = 0; i < depth; i++) ok &= values[i] == i;
+    TEST_ASSERT(ok, "Morris traversal walks the deep chain");
+    free(values);
+    for (int i = 0; i < depth; i++) {
+        free(nodes[i]);
+    }
+    free(nodes);
+}
+
 // === TREE OPERATIONS TESTS ===
 
 void test_search() {
@@ -165,15 +337,15 @@ void test_search() {
     // Test finding existing values
     Node* found = search(1, tree);
     TEST_ASSERT_NOT_NULL(found, "search finds root");
-    TEST_ASSERT_EQUAL(1, *(found->val), "found correct root value");
+    TEST_ASSERT_EQUAL(1, found->value, "found correct root value");
     
     found = search(2, tree);
     TEST_ASSERT_NOT_NULL(found, "search finds left child");
-    TEST_ASSERT_EQUAL(2, *(found->val), "found correct left value");
+    TEST_ASSERT_EQUAL(2, found->value, "found correct left value");
     
     found = search(4, tree);
     TEST_ASSERT_NOT_NULL(found, "search finds deep node");
-    TEST_ASSERT_EQUAL(4, *(found->val), "found correct deep value");
+    TEST_ASSERT_EQUAL(4, found->value, "found correct deep value");
     
     // Test searching for non-existent value
     found = search(999, tree);
@@ -266,17 +438,17 @@ void test_bst_insert() {
     // Test inserting into empty tree
     root = bst_insert(10, root);
     TEST_ASSERT_NOT_NULL(root, "Insert into empty tree creates root");
-    TEST_ASSERT_EQUAL(10, *(root->val), "Root value correct");
+    TEST_ASSERT_EQUAL(10, root->value, "Root value correct");
     
     // Test inserting smaller values (should go left)
     root = bst_insert(5, root);
     TEST_ASSERT_NOT_NULL(root->left, "Smaller value goes left");
-    TEST_ASSERT_EQUAL(5, *(root->left->val), "Left child value correct");
+    TEST_ASSERT_EQUAL(5, root->left->value, "Left child value correct");
     
     // Test inserting larger values (should go right)
     root = bst_insert(15, root);
     TEST_ASSERT_NOT_NULL(root->right, "Larger value goes right");
-    TEST_ASSERT_EQUAL(15, *(root->right->val), "Right child value correct");
+    TEST_ASSERT_EQUAL(15, root->right->value, "Right child value correct");
     
     // Test BST property with inorder traversal
     printf("Inorder traversal (should be sorted): ");
@@ -293,15 +465,15 @@ void test_binary_search() {
     // Test finding existing values
     Node* found = binary_search(5, bst);
     TEST_ASSERT_NOT_NULL(found, "Find root value");
-    TEST_ASSERT_EQUAL(5, *(found->val), "Found correct root value");
+    TEST_ASSERT_EQUAL(5, found->value, "Found correct root value");
     
     found = binary_search(1, bst);
     TEST_ASSERT_NOT_NULL(found, "Find leftmost value");
-    TEST_ASSERT_EQUAL(1, *(found->val), "Found correct leftmost value");
+    TEST_ASSERT_EQUAL(1, found->value, "Found correct leftmost value");
     
     found = binary_search(9, bst);
     TEST_ASSERT_NOT_NULL(found, "Find rightmost value");
-    TEST_ASSERT_EQUAL(9, *(found->val), "Found correct rightmost value");
+    TEST_ASSERT_EQUAL(9, found->value, "Found correct rightmost value");
     
     // Test searching for non-existent values
     found = binary_search(100, bst);
@@ -321,12 +493,12 @@ void test_bst_find_min_max() {
     // Test find minimum
     Node* min_node = bst_find_min(bst);
     TEST_ASSERT_NOT_NULL(min_node, "Find minimum in BST");
-    TEST_ASSERT_EQUAL(1, *(min_node->val), "Minimum value is correct");
+    TEST_ASSERT_EQUAL(1, min_node->value, "Minimum value is correct");
     
     // Test find maximum
     Node* max_node = bst_find_max(bst);
     TEST_ASSERT_NOT_NULL(max_node, "Find maximum in BST");
-    TEST_ASSERT_EQUAL(9, *(max_node->val), "Maximum value is correct");
+    TEST_ASSERT_EQUAL(9, max_node->value, "Maximum value is correct");
     
     // Test with empty tree
     Node* empty = NULL;
@@ -429,6 +601,382 @@ void test_bst_comprehensive() {
     destroy(&bst);
 }
 
+// === AVL TESTS ===
+
+// Checks order within (lo, hi), stored heights and balance factors.
+// Returns the subtree height, or -1 if anything is wrong.
+int check_avl(Node* node, long long lo, long long hi) {
+    if (node == NULL) {
+        return 0;
+    }
+    if (node->value <= lo || node->value >= hi) {
+        return -1;
+    }
+    int left = check_avl(node->left, lo, node->value);
+    int right = check_avl(node->right, node->value, hi);
+    if (left < 0 || right < 0 || left - right > 1 || right - left > 1) {
+        return -1;
+    }
+    int height = 1 + max(left, right);
+    return (node->height == height) ? height : -1;
+}
+
+int is_avl(Node* root) {
+    return check_avl(root, -2147483649LL, 2147483648LL) >= 0;
+}
+
+void test_avl_rotations() {
+    printf("\n=== Testing AVL Rotations ===\n");
+
+    // Each insertion order triggers one of the four rebalancing cases;
+    // all end with 2 at the root.
+    int orders[4][3] = {{3, 2, 1}, {1, 2, 3}, {3, 1, 2}, {1, 3, 2}};
+    const char* names[4] = {"left-left", "right-right", "left-right", "right-left"};
+    for (int c = 0; c < 4; c++) {
+        Node* root = NULL;
+        for (int i = 0; i < 3; i++) {
+            root = avl_insert(orders[c][i], root);
+        }
+        char message[64];
+        snprintf(message, sizeof(message), "%s case rebalances to root 2", names[c]);
+        TEST_ASSERT(root->value == 2 && root->left->value == 1 && root->right->value == 3, message);
+        TEST_ASSERT_EQUAL(2, avl_height(root), "Rebalanced tree has height 2");
+        destroy(&root);
+    }
+
+    // Duplicates are rejected and leave the tree as it was.
+    Node* root = avl_insert(5, NULL);
+    root = avl_insert(5, root);
+    TEST_ASSERT(root != NULL && count_nodes(root) == 1, "Duplicate insert leaves tree unchanged");
+    destroy(&root);
+}
+
+void test_avl_sequential() {
+    printf("\n=== Testing AVL Sequential Inserts ===\n");
+
+    // Ascending keys turn a plain BST into a list; AVL stays logarithmic.
+    Node* root = NULL;
+    int count = 100000;
+    for (int i = 0; i < count; i++) {
+        root = avl_insert(i, root);
+    }
+    TEST_ASSERT(is_avl(root), "Ascending inserts keep AVL invariants");
+    TEST_ASSERT_EQUAL(count, count_nodes(root), "All ascending keys inserted");
+    TEST_ASSERT_EQUAL(17, get_height(root), "100000 ascending keys give a perfect-ish height of 17");
+    TEST_ASSERT_EQUAL(get_height(root), avl_height(root), "Stored height matches computed height");
+    TEST_ASSERT(binary_search(0, root) != NULL && binary_search(count - 1, root) != NULL, "binary_search works on AVL tree");
+    TEST_ASSERT_EQUAL(0, bst_find_min(root)->value, "bst_find_min works on AVL tree");
+    TEST_ASSERT_EQUAL(count - 1, bst_find_max(root)->value, "bst_find_max works on AVL tree");
+
+    // Descending deletes from the front.
+    for (int i = 0; i < count / 2; i++) {
+        root = avl_delete(i, root);
+    }
+    TEST_ASSERT(is_avl(root), "Deleting the smaller half keeps AVL invariants");
+    TEST_ASSERT_EQUAL(count / 2, bst_find_min(root)->value, "Minimum after deletes is correct");
+    destroy(&root);
+}
+
+void test_avl_random() {
+    printf("\n=== Testing AVL Random Inserts and Deletes ===\n");
+
+    int range = 5000;
+    char* present = calloc(range, 1);
+    Node* root = NULL;
+    int size = 0;
+    int all_valid = 1;
+    srand(42);
+    for (int step = 0; step < 40000; step++) {
+        int val = rand() % range;
+        if (rand() % 3 != 0) {
+            if (!present[val]) {
+                root = avl_insert(val, root);
+                present[val] = 1;
+                size++;
+            }
+        }
+        else {
+            root = avl_delete(val, root);
+            if (present[val]) size--;
+            present[val] = 0;
+        }
+        if (step % 1000 == 0 && (!is_avl(root) || count_nodes(root) != size)) {
+            all_valid = 0;
+        }
+    }
+    TEST_ASSERT(all_valid && is_avl(root), "Random inserts and deletes keep AVL invariants");
+    int lookups_match = 1;
+    for (int val = 0; val < range; val++) {
+        if ((binary_search(val, root) != NULL) != present[val]) {
+            lookups_match = 0;
+        }
+    }
+    TEST_ASSERT(lookups_match, "Membership matches after random operations");
+
+    // Delete everything.
+    for (int val = 0; val < range; val++) {
+        root = avl_delete(val, root);
+    }
+    TEST_ASSERT_NULL(root, "Deleting every value empties the tree");
+    TEST_ASSERT_EQUAL(0, avl_height(root), "Empty tree has height 0");
+    free(present);
+}
+
+// === INLINE VALUE AND POOL TESTS ===
+
+void test_inline_values() {
+    printf("\n=== Testing Inline Values ===\n");
+
+    Node* node = create_node(7);
+    TEST_ASSERT(sizeof(Node) <= 2 * sizeof(Node*) + 4 * sizeof(int), "Node is two links and three ints (32 bytes on 64-bit)");
+    TEST_ASSERT(get_at_path(node, "") == &node->value, "get_at_path points at the inline value");
+    *get_at_path(node, "") = 8;
+    TEST_ASSERT_EQUAL(8, node->value, "Writes through get_at_path update the value");
+    destroy(&node);
+
+    // Two-children delete copies the predecessor value in place.
+    Node* bst = create_test_bst();
+    bst = bst_delete_by_value(5, bst);
+    TEST_ASSERT_EQUAL(4, bst->value, "Root took the predecessor value");
+
+    // Path and search operations see the same value.
+    set_at_path(43, bst, "");
+    TEST_ASSERT(bst->value == 43 && search(43, bst) == bst, "Search finds the value set by path");
+    destroy(&bst);
+}
+
+void test_node_pool() {
+    printf("\n=== Testing Node Pool ===\n");
+
+    NodePool pool = {0};
+    Node* nodes[192];
+    for (int i = 0; i < 192; i++) {
+        nodes[i] = pool_alloc_node(&pool, i);
+    }
+    TEST_ASSERT(nodes[0] != NULL && nodes[191] != NULL, "Pool hands out nodes");
+    TEST_ASSERT(nodes[150]->value == 150 && nodes[150]->size == 1, "Pooled nodes are initialized");
+    TEST_ASSERT_EQUAL(2, pool.num_chunks, "192 nodes fill a 64 and a 128 node chunk");
+
+    // Freed nodes are reused, most recent first, before any new chunk.
+    pool_free_node(&pool, nodes[10]);
+    pool_free_node(&pool, nodes[20]);
+    TEST_ASSERT(pool_alloc_node(&pool, 1) == nodes[20], "Most recently freed node is reused first");
+    TEST_ASSERT(pool_alloc_node(&pool, 2) == nodes[10], "Then the next freed node");
+    TEST_ASSERT_EQUAL(2, pool.num_chunks, "Reuse does not allocate");
+
+    destroy_pool(&pool);
+    TEST_ASSERT(pool.chunks == NULL && pool.free_list == NULL, "destroy_pool empties the pool");
+}
+
+void test_tree_handle() {
+    printf("\n=== Testing Pooled Tree ===\n");
+
+    Tree* tree = create_tree();
+    TEST_ASSERT_NOT_NULL(tree, "create_tree returns a tree");
+    int count = 100000;
+    int all_inserted = 1;
+    for (int i = 0; i < count; i++) {
+        if (tree_insert(tree, i) != 1) all_inserted = 0;
+    }
+    TEST_ASSERT(all_inserted, "Sequential inserts all succeed");
+    TEST_ASSERT_EQUAL(0, tree_insert(tree, 500), "Duplicate insert returns 0");
+    TEST_ASSERT_EQUAL(count, tree->size, "Size counts distinct values");
+    TEST_ASSERT(is_avl(tree->root), "Pooled tree keeps AVL invariants");
+    TEST_ASSERT(tree_find(tree, 12345) != NULL && tree_find(tree, -1) == NULL, "tree_find finds present values only");
+    TEST_ASSERT(binary_search(777, tree->root) != NULL, "Read-only Node functions work on the pooled root");
+
+    // Deleting and reinserting recycles nodes instead of growing the pool.
+    int chunks = tree->pool.num_chunks;
+    for (int i = 0; i < count; i += 2) {
+        tree_delete(tree, i);
+    }
+    TEST_ASSERT_EQUAL(count / 2, tree->size, "Half the values deleted");
+    TEST_ASSERT_EQUAL(0, tree_delete(tree, 0), "Deleting a missing value returns 0");
+    for (int i = 0; i < count; i += 2) {
+        tree_insert(tree, i);
+    }
+    TEST_ASSERT_EQUAL(chunks, tree->pool.num_chunks, "Reinserts reuse freed nodes");
+    TEST_ASSERT(is_avl(tree->root) && count_nodes(tree->root) == count, "Tree is whole again");
+
+    destroy_tree(&tree);
+    TEST_ASSERT_NULL(tree, "destroy_tree sets pointer to NULL");
+    TEST_ASSERT_EQUAL(-1, tree_insert(NULL, 1), "Insert into NULL tree fails");
+}
+
+// === ORDER STATISTICS TESTS ===
+
+// Returns the subtree size if every stored size is right, else -1.
+int check_sizes(Node* node) {
+    if (node == NULL) {
+        return 0;
+    }
+    int left = check_sizes(node->left);
+    int right = check_sizes(node->right);
+    if (left < 0 || right < 0 || node->size != left + right + 1) {
+        return -1;
+    }
+    return node->size;
+}
+
+// Index of the first element >= val in an ascending array.
+int sorted_rank(const int* sorted, int count, int val) {
+    int lo = 0;
+    int hi = count;
+    while (lo < hi) {
+        int mid = lo + (hi - lo) / 2;
+        if (sorted[mid] < val) lo = mid + 1;
+        else hi = mid;
+    }
+    return lo;
+}
+
+// rank, select, range_count and range iteration against a sorted copy.
+int order_statistics_match(Node* root, const int* sorted, int count) {
+    int ok = check_sizes(root) == count && bst_size(root) == count;
+    for (int k = 0; k < count; k++) {
+        Node* node = bst_select(k, root);
+        ok &= node != NULL && node->value == sorted[k];
+        ok &= bst_rank(sorted[k], root) == k;
+        ok &= bst_rank(sorted[k] + 1, root) == k + 1; // Values are even: +1 is absent
+    }
+    ok &= bst_select(-1, root) == NULL && bst_select(count, root) == NULL;
+    for (int trial = 0; trial < 2000; trial++) {
+        int lo = rand() % (2 * count + 10) - 5;
+        int hi = lo + rand() % 200;
+        int first = sorted_rank(sorted, count, lo);
+        int last = sorted_rank(sorted, count, hi);
+        ok &= bst_range_count(lo, hi, root) == last - first;
+        TreeIterator it;
+        init_range_iterator(&it, root, lo, hi);
+        int values[200];
+        int got = tree_iterator_fill(&it, values, 200);
+        destroy_tree_iterator(&it);
+        ok &= got == last - first && memcmp(values, sorted + first, got * sizeof(int)) == 0;
+    }
+    return ok;
+}
+
+void test_order_statistics() {
+    printf("\n=== Testing Order Statistics ===\n");
+    int count = 5000;
+    int* sorted = malloc(count * sizeof(int));
+    int* keys = malloc(count * sizeof(int));
+    for (int i = 0; i < count; i++) {
+        sorted[i] = 2 * i;
+        keys[i] = 2 * i;
+    }
+    srand(23);
+    for (int i = count - 1; i > 0; i--) {
+        int j = rand() % (i + 1);
+        int tmp = keys[i];
+        keys[i] = keys[j];
+        keys[j] = tmp;
+    }
+
+    Node* avl = NULL;
+    Node* bst = NULL;
+    Tree* tree = create_tree();
+    for (int i = 0; i < count; i++) {
+        avl = avl_insert(keys[i], avl);
+        bst = bst_insert(keys[i], bst);
+        tree_insert(tree, keys[i]);
+    }
+    TEST_ASSERT(order_statistics_match(avl, sorted, count), "AVL rank/select/range match sorted order");
+    TEST_ASSERT(order_statistics_match(bst, sorted, count), "BST rank/select/range match sorted order");
+    TEST_ASSERT(order_statistics_match(tree->root, sorted, count), "Pooled tree rank/select/range match");
+
+    // Delete every value that is a multiple of 4 (including two-child nodes).
+    int kept = 0;
+    for (int i = 0; i < count; i++) {
+        if (sorted[i] % 4 == 0) {
+            avl = avl_delete(sorted[i], avl);
+            bst = bst_delete_by_value(sorted[i], bst);
+            tree_delete(tree, sorted[i]);
+        }
+        else {
+            sorted[kept++] = sorted[i];
+        }
+    }
+    TEST_ASSERT(order_statistics_match(avl, sorted, kept), "AVL sizes survive deletes");
+    TEST_ASSERT(order_statistics_match(bst, sorted, kept), "BST sizes survive deletes");
+    TEST_ASSERT(order_statistics_match(tree->root, sorted, kept), "Pooled tree sizes survive deletes");
+
+    // Whole-range and empty-range edge cases.
+    TEST_ASSERT_EQUAL(kept, bst_range_count(INT_MIN, INT_MAX, avl), "Full range counts every value");
+    TEST_ASSERT_EQUAL(0, bst_range_count(10, 10, avl), "Empty range counts nothing");
+    TEST_ASSERT_EQUAL(0, bst_range_count(10, 5, avl), "Reversed range counts nothing");
+    TEST_ASSERT_EQUAL(0, bst_rank(5, NULL), "Rank in an empty tree is 0");
+    TEST_ASSERT_NULL(bst_select(0, NULL), "Select in an empty tree is NULL");
+    TreeIterator it;
+    init_range_iterator(&it, avl, 6, 6);
+    TEST_ASSERT_NULL(tree_iterator_next(&it), "Empty range iterator yields nothing");
+    init_range_iterator(&it, avl, 6, 7);
+    Node* only = tree_iterator_next(&it);
+    TEST_ASSERT(only != NULL && only->value == 6 && tree_iterator_next(&it) == NULL, "Range [6, 7) yields only 6");
+    destroy_tree_iterator(&it);
+
+    destroy(&avl);
+    destroy(&bst);
+    destroy_tree(&tree);
+    free(sorted);
+    free(keys);
+}
+
+// === BULK CONSTRUCTION TESTS ===
+
+void test_bulk_build() {
+    printf("\n=== Testing Bulk Construction ===\n");
+    int sizes[] = {0, 1, 2, 3, 7, 1000, 300000};
+    int thread_counts[] = {1, 3, 4};
+    int ok = 1;
+    int* out = malloc(300000 * sizeof(int));
+    int* sorted = malloc(300000 * sizeof(int));
+    for (int i = 0; i < 300000; i++) {
+        sorted[i] = 3 * i - 1000;
+    }
+    for (int s = 0; s < 7; s++) {
+        int n = sizes[s];
+        // Perfect balance: height is the bits needed to count n nodes.
+        int expected_height = 0;
+        while ((1LL << expected_height) <= n) expected_height++;
+        for (int t = 0; t < 3; t++) {
+            Tree* tree = bst_build_from_sorted(sorted, n, thread_counts[t]);
+            ok &= tree != NULL && tree->size == n;
+            ok &= avl_height(tree->root) == expected_height && get_height(tree->root) == expected_height;
+            ok &= is_avl(tree->root) && check_sizes(tree->root) == n;
+            ok &= tree->pool.num_chunks == (n > 0);
+            for (int f = 0; f < 3; f++) {
+                memset(out, 0, n * sizeof(int));
+                ok &= bst_to_sorted_array(tree->root, out, n, thread_counts[f]) == n;
+                ok &= memcmp(out, sorted, n * sizeof(int)) == 0;
+            }
+            destroy_tree(&tree);
+        }
+    }
+    TEST_ASSERT(ok, "Balanced builds and flattens match the input for every size and thread count");
+
+    // The built tree is an ordinary pooled Tree afterwards.
+    Tree* tree = bst_build_from_sorted(sorted, 1000, 2);
+    ok = tree_insert(tree, 1) == 1 && tree_insert(tree, -1000) == 0;
+    ok &= tree_delete(tree, 2) == 1 && tree_delete(tree, 500) == 1;
+    ok &= tree->size == 999 && tree->pool.num_chunks == 2 && is_avl(tree->root);
+    ok &= check_sizes(tree->root) == 999 && bst_rank(1, tree->root) == 334;
+    TEST_ASSERT(ok, "Built tree takes inserts and deletes");
+    TEST_ASSERT_EQUAL(999, bst_to_sorted_array(tree->root, out, 10, 4), "Short buffer still returns node count");
+    TEST_ASSERT(out[0] == -1000 && out[9] == -973, "Short buffer gets the smallest values");
+    destroy_tree(&tree);
+
+    int unsorted[] = {1, 3, 2};
+    int repeated[] = {1, 2, 2};
+    TEST_ASSERT_NULL(bst_build_from_sorted(unsorted, 3, 1), "Build rejects unsorted values");
+    TEST_ASSERT_NULL(bst_build_from_sorted(repeated, 3, 1), "Build rejects duplicate values");
+    TEST_ASSERT_NULL(bst_build_from_sorted(sorted, 3, 0), "Build rejects zero threads");
+    TEST_ASSERT_EQUAL(-1, bst_to_sorted_array(NULL, NULL, 5, 1), "Flatten rejects a NULL buffer");
+    TEST_ASSERT_EQUAL(0, bst_to_sorted_array(NULL, out, 5, 1), "Flatten of an empty tree writes nothing");
+    free(out);
+    free(sorted);
+}
+
 // === MAIN TEST RUNNER ===
 
 int main() {
@@ -441,6 +989,8 @@ int main() {
     test_get_at_path();
     test_set_at_path();
     test_traversals();
+    test_traversal_iterators();
+    test_deep_traversals();
     test_search();
     test_count_nodes();
     test_get_height();
@@ -452,6 +1002,22 @@ int main() {
     test_bst_find_min_max();
     test_bst_delete();
     test_bst_comprehensive();
+
+    // Run AVL tests
+    test_avl_rotations();
+    test_avl_sequential();
+    test_avl_random();
+
+    // Run inline value and pool tests
+    test_inline_values();
+    test_node_pool();
+    test_tree_handle();
+
+    // Run order statistics tests
+    test_order_statistics();
+
+    // Run bulk construction tests
+    test_bulk_build();
     
     // Print summary
     printf("\n===================================\n");
@@ -0,0 +1,409 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+// Set when the build supplies its own BPLUS_KEY_LESS: the tests that spell out
+// ascending int keys are skipped, and test_bplus_key_order checks the order.
+#ifdef BPLUS_KEY_LESS
+#define CUSTOM_KEY_ORDER 1
+#endif
+
+#include "bplus_tree.h"
+
+// Test counter
+int tests_run = 0;
+int tests_passed = 0;
+
+// Test helper macros
+#define TEST_ASSERT(condition, message) \
+    do { \
+        tests_run++; \
+        if (condition) { \
+            tests_passed++; \
+            printf("PASSED - %s\n", message); \
+        } else { \
+            printf("FAILED - %s\n", message); \
+        } \
+    } while(0)
+
+#define TEST_ASSERT_NULL(ptr, message) \
+    TEST_ASSERT((ptr) == NULL, message)
+
+#define TEST_ASSERT_NOT_NULL(ptr, message) \
+    TEST_ASSERT((ptr) != NULL, message)
+
+#define TEST_ASSERT_EQUAL(expected, actual, message) \
+    TEST_ASSERT((expected) == (actual), message)
+
+// Checks the subtree at node: ascending keys within [lo, hi), node fill
+// within bounds, every leaf at level 0, and the leaf chain visiting leaves
+// in tree order (*prev is the leaf before this subtree). Returns its key
+// count, or -1 if anything is wrong.
+long long check_node(void* node, int level, int is_root, const BPlusKey* lo, const BPlusKey* hi, BPlusLeaf** prev) {
+    const BPlusKey* keys;
+    int count;
+    if (level == 0) {
+        BPlusLeaf* leaf = node;
+        keys = leaf->keys;
+        count = leaf->count;
+        if ((!is_root && count < (int)BPLUS_LEAF_KEYS / 2) || count > (int)BPLUS_LEAF_KEYS) return -1;
+        if (*prev != NULL && (*prev)->next != leaf) return -1;
+        *prev = leaf;
+    }
+    else {
+        BPlusInternal* inner = node;
+        keys = inner->keys;
+        count = inner->count;
+        if ((is_root ? count < 1 : count < ((int)BPLUS_INTERNAL_KEYS - 1) / 2) || count > (int)BPLUS_INTERNAL_KEYS) return -1;
+    }
+    if ((uintptr_t)node % 64 != 0) return -1;
+    for (int i = 0; i < count; i++) {
+        if (i > 0 && !BPLUS_KEY_LESS(keys[i - 1], keys[i])) return -1;
+        if (lo != NULL && BPLUS_KEY_LESS(keys[i], *lo)) return -1;
+        if (hi != NULL && !BPLUS_KEY_LESS(keys[i], *hi)) return -1;
+    }
+    if (level == 0) {
+        return count;
+    }
+    BPlusInternal* inner = node;
+    long long total = 0;
+    for (int i = 0; i <= count; i++) {
+        const BPlusKey* child_lo = (i > 0) ? &keys[i - 1] : lo;
+        const BPlusKey* child_hi = (i < count) ? &keys[i] : hi;
+        long long keys_below = check_node(inner->children[i], level - 1, 0, child_lo, child_hi, prev);
+        if (keys_below < 0) return -1;
+        total += keys_below;
+    }
+    return total;
+}
+
+int is_valid_bplus(BPlusTree* tree) {
+    BPlusLeaf* prev = NULL;
+    long long total = check_node(tree->root, tree->height, 1, NULL, NULL, &prev);
+    return total == tree->size && prev != NULL && prev->next == NULL;
+}
+
+void shuffle(BPlusKey* array, int count) {
+    for (int i = count - 1; i > 0; i--) {
+        int j = rand() % (i + 1);
+        BPlusKey tmp = array[i];
+        array[i] = array[j];
+        array[j] = tmp;
+    }
+}
+
+void test_node_layout() {
+    printf("\n=== Testing B+-Tree Node Layout ===\n");
+    TEST_ASSERT(sizeof(BPlusLeaf) <= BPLUS_NODE_BYTES, "Leaf fits in BPLUS_NODE_BYTES");
+    TEST_ASSERT(sizeof(BPlusInternal) <= BPLUS_NODE_BYTES, "Internal node fits in BPLUS_NODE_BYTES");
+    TEST_ASSERT(BPLUS_NODE_BYTES % 64 == 0, "Node size is a whole number of cache lines");
+    TEST_ASSERT(BPLUS_LEAF_KEYS >= 4 && BPLUS_INTERNAL_KEYS >= 4, "Nodes hold several keys");
+}
+
+void test_bplus_empty() {
+    printf("\n=== Testing Empty B+-Tree ===\n");
+    BPlusTree* tree = create_bplus_tree();
+    BPlusKey key = 0;
+    BPlusValue value;
+    TEST_ASSERT_NOT_NULL(tree, "Create empty tree");
+    TEST_ASSERT_EQUAL(0, tree->size, "Empty tree has size 0");
+    TEST_ASSERT_NULL(bplus_find(tree, 1), "Find in empty tree returns NULL");
+    TEST_ASSERT_EQUAL(0, bplus_min(tree, &key), "Min of empty tree reports none");
+    TEST_ASSERT_EQUAL(0, bplus_max(tree, &key), "Max of empty tree reports none");
+    TEST_ASSERT_EQUAL(0, bplus_delete(tree, 1), "Delete from empty tree reports absent");
+    BPlusIterator it = bplus_iter_begin(tree);
+    TEST_ASSERT_EQUAL(0, bplus_iter_next(&it, &key, &value), "Iterating an empty tree yields nothing");
+    TEST_ASSERT(is_valid_bplus(tree), "Empty tree is valid");
+    destroy_bplus_tree(&tree);
+    TEST_ASSERT_NULL(tree, "Destroy sets tree to NULL");
+    destroy_bplus_tree(&tree);
+    destroy_bplus_tree(NULL);
+
+    TEST_ASSERT_EQUAL(-1, bplus_insert(NULL, 1, 1), "Insert into NULL tree fails");
+    TEST_ASSERT_EQUAL(0, bplus_delete(NULL, 1), "Delete from NULL tree reports absent");
+    TEST_ASSERT_NULL(bplus_find(NULL, 1), "Find in NULL tree returns NULL");
+}
+
+void test_bplus_insert_find() {
+    printf("\n=== Testing B+-Tree Insert and Find ===\n");
+    BPlusTree* tree = create_bplus_tree();
+    TEST_ASSERT_EQUAL(1, bplus_insert(tree, 5, 50), "Insert new key returns 1");
+    TEST_ASSERT_EQUAL(0, bplus_insert(tree, 5, 55), "Insert existing key returns 0");
+    TEST_ASSERT_EQUAL(1, tree->size, "Updating does not grow the tree");
+    TEST_ASSERT(bplus_find(tree, 5) != NULL && *bplus_find(tree, 5) == 55, "Insert updates the value");
+    *bplus_find(tree, 5) = 56;
+    TEST_ASSERT_EQUAL(56, *bplus_find(tree, 5), "Value can be written through find");
+    destroy_bplus_tree(&tree);
+
+    // Ascending keys: every split happens at the right edge.
+    int count = 100000;
+    tree = create_bplus_tree();
+    int ok = 1;
+    for (int i = 0; i < count; i++) {
+        ok &= bplus_insert(tree, i, 2 * i) == 1;
+    }
+    TEST_ASSERT(ok, "Insert 100000 ascending keys");
+    TEST_ASSERT(is_valid_bplus(tree), "Ascending tree is valid");
+    // With every node at least half full, height is logarithmic in the fanout.
+    int max_height = 0;
+    for (long long nodes = count / ((int)BPLUS_LEAF_KEYS / 2); nodes > 1; nodes /= ((int)BPLUS_INTERNAL_KEYS + 1) / 2) {
+        max_height++;
+    }
+    TEST_ASSERT(tree->height <= max_height, "Ascending tree stays shallow");
+    ok = 1;
+    for (int i = 0; i < count; i++) {
+        BPlusValue* value = bplus_find(tree, i);
+        ok &= value != NULL && *value == 2 * i;
+    }
+    TEST_ASSERT(ok, "Every ascending key is found with its value");
+    TEST_ASSERT_NULL(bplus_find(tree, -1), "Key below range not found");
+    TEST_ASSERT_NULL(bplus_find(tree, count), "Key above range not found");
+#ifndef CUSTOM_KEY_ORDER
+    BPlusKey key;
+    TEST_ASSERT(bplus_min(tree, &key) && key == 0, "Min of ascending tree");
+    TEST_ASSERT(bplus_max(tree, &key) && key == count - 1, "Max of ascending tree");
+#endif
+    destroy_bplus_tree(&tree);
+
+    // Descending keys: every split happens at the left edge.
+    tree = create_bplus_tree();
+    for (int i = count - 1; i >= 0; i--) {
+        bplus_insert(tree, i, i);
+    }
+    TEST_ASSERT(is_valid_bplus(tree) && tree->size == count, "Descending tree is valid");
+    destroy_bplus_tree(&tree);
+}
+
+void test_bplus_random() {
+    printf("\n=== Testing B+-Tree Random Insert and Delete ===\n");
+    // Random operations against a membership array.
+    int range = 20000;
+    char* present = calloc(range, 1);
+    BPlusTree* tree = create_bplus_tree();
+    srand(3);
+    int ok = 1;
+    int valid = 1;
+    for (int step = 0; step < 200000; step++) {
+        int key = rand() % range;
+        // Phases favouring inserts, then deletes, so the tree grows and shrinks.
+        int insert = (step / 50000) % 2 == 0 ? rand() % 3 != 0 : rand() % 3 == 0;
+        if (insert) {
+            ok &= bplus_insert(tree, key, key + 1) == !present[key];
+            present[key] = 1;
+        }
+        else {
+            ok &= bplus_delete(tree, key) == present[key];
+            present[key] = 0;
+        }
+        if (step % 5000 == 0) {
+            valid &= is_valid_bplus(tree);
+        }
+    }
+    TEST_ASSERT(ok, "Insert and delete results match a reference set");
+    TEST_ASSERT(valid, "Tree stays valid through random operations");
+    ok = 1;
+    int expected_size = 0;
+    for (int key = 0; key < range; key++) {
+        BPlusValue* value = bplus_find(tree, key);
+        ok &= present[key] ? (value != NULL && *value == key + 1) : value == NULL;
+        expected_size += present[key];
+    }
+    TEST_ASSERT(ok, "Find agrees with the reference set");
+    TEST_ASSERT_EQUAL(expected_size, tree->size, "Size matches the reference set");
+
+    // Delete everything: the tree collapses back to one empty leaf.
+    for (int key = 0; key < range; key++) {
+        bplus_delete(tree, key);
+    }
+    TEST_ASSERT_EQUAL(0, tree->size, "Deleting every key empties the tree");
+    TEST_ASSERT_EQUAL(0, tree->height, "Empty tree shrinks to a single leaf");
+    TEST_ASSERT(is_valid_bplus(tree), "Emptied tree is valid");
+    destroy_bplus_tree(&tree);
+    free(present);
+}
+
+void test_bplus_bulk_load() {
+    printf("\n=== Testing B+-Tree Bulk Load ===\n");
+    int sizes[] = {0, 1, (int)BPLUS_LEAF_KEYS, (int)BPLUS_LEAF_KEYS + 1, 1000, 123457};
+    int ok = 1;
+    for (int s = 0; s < 6; s++) {
+        int count = sizes[s];
+        BPlusKey* keys = malloc((count + 1) * sizeof(BPlusKey));
+        BPlusValue* values = malloc((count + 1) * sizeof(BPlusValue));
+        for (int i = 0; i < count; i++) {
+            keys[i] = 3 * i;
+            values[i] = i;
+        }
+        BPlusTree* tree = bplus_bulk_load(keys, values, count);
+        ok &= tree != NULL && tree->size == count && is_valid_bplus(tree);
+        for (int i = 0; i < count && ok; i++) {
+            BPlusValue* value = bplus_find(tree, 3 * i);
+            ok &= value != NULL && *value == i && bplus_find(tree, 3 * i + 1) == NULL;
+        }
+        // A bulk loaded tree takes ordinary updates afterwards.
+        for (int i = 0; i < count && ok; i += 2) {
+            ok &= bplus_delete(tree, 3 * i) == 1;
+            ok &= bplus_insert(tree, 3 * i + 1, -i) == 1;
+        }
+        ok &= is_valid_bplus(tree);
+        destroy_bplus_tree(&tree);
+        free(keys);
+        free(values);
+    }
+    TEST_ASSERT(ok, "Bulk load builds valid trees of every size that accept updates");
+
+    BPlusKey keys[] = {1, 2, 3};
+    BPlusTree* tree = bplus_bulk_load(keys, NULL, 3);
+    TEST_ASSERT(tree != NULL && *bplus_find(tree, 2) == 0, "Bulk load without values stores zeros");
+    destroy_bplus_tree(&tree);
+    BPlusKey unsorted[] = {1, 3, 2};
+    BPlusKey repeated[] = {1, 2, 2};
+    TEST_ASSERT_NULL(bplus_bulk_load(unsorted, NULL, 3), "Bulk load rejects unsorted keys");
+    TEST_ASSERT_NULL(bplus_bulk_load(repeated, NULL, 3), "Bulk load rejects duplicate keys");
+    TEST_ASSERT_NULL(bplus_bulk_load(NULL, NULL, 3), "Bulk load rejects NULL keys");
+}
+
+void test_bplus_iteration() {
+    printf("\n=== Testing B+-Tree Iteration ===\n");
+    int count = 50000;
+    BPlusKey* keys = malloc(count * sizeof(BPlusKey));
+    for (int i = 0; i < count; i++) {
+        keys[i] = 2 * i;
+    }
+    shuffle(keys, count);
+    BPlusTree* tree = create_bplus_tree();
+    for (int i = 0; i < count; i++) {
+        bplus_insert(tree, keys[i], keys[i] / 2);
+    }
+    BPlusIterator it = bplus_iter_begin(tree);
+    BPlusKey key;
+    BPlusValue value;
+    int seen = 0;
+    int ok = 1;
+    while (bplus_iter_next(&it, &key, &value)) {
+        ok &= key == 2 * seen && value == seen;
+        seen++;
+    }
+    TEST_ASSERT(ok && seen == count, "Iteration visits every key in order");
+    TEST_ASSERT_EQUAL(0, bplus_iter_next(&it, &key, &value), "Iterator stays at the end");
+
+    // Range scans start at the first key >= the bound.
+    it = bplus_iter_from(tree, 1001);
+    TEST_ASSERT(bplus_iter_next(&it, &key, NULL) && key == 1002, "Range starts at the next key up");
+    it = bplus_iter_from(tree, 1002);
+    TEST_ASSERT(bplus_iter_next(&it, NULL, &value) && value == 501, "Range starts at an equal key");
+    it = bplus_iter_from(tree, -5);
+    TEST_ASSERT(bplus_iter_next(&it, &key, NULL) && key == 0, "Range below all keys starts at the min");
+    it = bplus_iter_from(tree, 2 * count);
+    TEST_ASSERT_EQUAL(0, bplus_iter_next(&it, &key, NULL), "Range above all keys is empty");
+    int in_range = 0;
+    it = bplus_iter_from(tree, 100);
+    while (bplus_iter_next(&it, &key, NULL) && key < 200) {
+        in_range++;
+    }
+    TEST_ASSERT_EQUAL(50, in_range, "Scan of [100, 200) sees 50 keys");
+    destroy_bplus_tree(&tree);
+    free(keys);
+}
+
+void test_bplus_scalar_search() {
+    printf("\n=== Testing B+-Tree Scalar Node Search ===\n");
+    // Whatever the CPU supports, the scalar path must give the same answers.
+    int count = 20000;
+    BPlusTree* tree = create_bplus_tree();
+    int simd = tree->use_simd;
+    tree->use_simd = 0;
+    srand(9);
+    for (int i = 0; i < count; i++) {
+        bplus_insert(tree, rand() % (4 * count), i);
+    }
+    for (int i = 0; i < count / 2; i++) {
+        bplus_delete(tree, rand() % (4 * count));
+    }
+    TEST_ASSERT(is_valid_bplus(tree), "Tree built with scalar search is valid");
+    int ok = 1;
+    for (int key = 0; key < 4 * count; key++) {
+        tree->use_simd = 0;
+        BPlusValue* scalar = bplus_find(tree, key);
+        tree->use_simd = simd;
+        ok &= scalar == bplus_find(tree, key);
+    }
+    TEST_ASSERT(ok, "Scalar and SIMD search find the same keys");
+    destroy_bplus_tree(&tree);
+}
+
+void test_bplus_key_order() {
+    printf("\n=== Testing B+-Tree Key Order ===\n");
+    // Whatever BPLUS_KEY_LESS is, iteration follows it.
+    int count = 30000;
+    BPlusKey* keys = malloc(count * sizeof(BPlusKey));
+    for (int i = 0; i < count; i++) {
+        keys[i] = 3 * i - count;
+    }
+    srand(13);
+    shuffle(keys, count);
+    BPlusTree* tree = create_bplus_tree();
+    for (int i = 0; i < count; i++) {
+        bplus_insert(tree, keys[i], i);
+    }
+    for (int i = 0; i < count; i += 3) {
+        bplus_delete(tree, keys[i]);
+    }
+    TEST_ASSERT(is_valid_bplus(tree), "Tree is valid under the key order");
+    int ok = 1;
+    for (int i = 0; i < count; i++) {
+        BPlusValue* value = bplus_find(tree, keys[i]);
+        ok &= (i % 3 == 0) ? value == NULL : (value != NULL && *value == i);
+    }
+    TEST_ASSERT(ok, "Find locates every remaining key");
+
+    BPlusIterator it = bplus_iter_begin(tree);
+    BPlusKey first;
+    int nonempty = bplus_iter_next(&it, &first, NULL);
+    TEST_ASSERT(nonempty, "Iteration starts with a key");
+    if (nonempty) {
+        BPlusKey prev = first;
+        BPlusKey key;
+        long long seen = 1;
+        int violations = 0;
+        while (bplus_iter_next(&it, &key, NULL)) {
+            violations += !BPLUS_KEY_LESS(prev, key);
+            prev = key;
+            seen++;
+        }
+        TEST_ASSERT(violations == 0 && seen == tree->size, "Iteration visits every key in BPLUS_KEY_LESS order");
+        BPlusKey min;
+        BPlusKey max;
+        bplus_min(tree, &min);
+        bplus_max(tree, &max);
+        TEST_ASSERT(first == min && prev == max, "Min and max are the ends of the iteration");
+    }
+    destroy_bplus_tree(&tree);
+    free(keys);
+}
+
+int main() {
+    printf("Running B+-tree tests...\n");
+
+    test_node_layout();
+    test_bplus_empty();
+    test_bplus_insert_find();
+    test_bplus_random();
+#ifndef CUSTOM_KEY_ORDER
+    test_bplus_bulk_load();
+    test_bplus_iteration();
+#endif
+    test_bplus_scalar_search();
+    test_bplus_key_order();
+
+    // Print summary
+    printf("\n===================================\n");
+    printf("Test Summary: %d/%d tests passed\n", tests_passed, tests_run);
+
+    if (tests_passed == tests_run) {
+        printf("SUCCESS - All tests passed!\n");
+        return 0;
+    } else {
+        printf("FAILED - %d tests failed\n", tests_run - tests_passed);
+        return 1;
+    }
+}
@@ -0,0 +1,639 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <pthread.h>
+#include "skiplist.h"
+
+// Test counter
+int tests_run = 0;
+int tests_passed = 0;
+
+// Test helper macros
+#define TEST_ASSERT(condition, message) \
+    do { \
+        tests_run++; \
+        if (condition) { \
+            tests_passed++; \
+            printf("PASSED - %s\n", message); \
+        } else { \
+            printf("FAILED - %s\n", message); \
+        } \
+    } while(0)
+
+#define TEST_ASSERT_NULL(ptr, message) \
+    TEST_ASSERT((ptr) == NULL, message)
+
+#define TEST_ASSERT_NOT_NULL(ptr, message) \
+    TEST_ASSERT((ptr) != NULL, message)
+
+#define TEST_ASSERT_EQUAL(expected, actual, message) \
+    TEST_ASSERT((expected) == (actual), message)
+
+#define STRESS_THREADS 8
+
+uint64_t next_random(uint64_t* state) {
+    *state ^= *state << 13;
+    *state ^= *state >> 7;
+    *state ^= *state << 17;
+    return *state;
+}
+
+// Checks a quiescent list: level 0 strictly ascending with no marked nodes,
+// each upper level a sublist of the one below, and the size field matching.
+// Returns the number of values, or -1 if anything is wrong.
+int check_skiplist(SkipList* list) {
+    int count = 0;
+    for (int level = SKIPLIST_MAX_LEVEL - 1; level >= 0; level--) {
+        SkipNode* below = list->head;
+        SkipNode* prev = NULL;
+        uintptr_t raw = atomic_load(&list->head->next[level]);
+        count = 0;
+        while (raw != 0) {
+            SkipNode* node = (SkipNode*)raw;
+            if (raw & 1 || node->levels <= level) {
+                return -1;
+            }
+            if (prev != NULL && prev->value >= node->value) {
+                return -1;
+            }
+            if (level > 0) {
+                // node must also appear on level - 1, after below
+                while (below != node && below != NULL) {
+                    below = (SkipNode*)(atomic_load(&below->next[level - 1]) & ~(uintptr_t)1);
+                }
+                if (below == NULL) {
+                    return -1;
+                }
+            }
+            prev = node;
+            raw = atomic_load(&node->next[level]);
+            count++;
+        }
+    }
+    return count == skiplist_size(list) ? count : -1;
+}
+
+void test_skiplist_empty() {
+    printf("\n=== Testing Empty Skiplist ===\n");
+
+    SkipList* list = create_skiplist();
+    TEST_ASSERT_NOT_NULL(list, "Create skiplist");
+
+    int val = -1;
+    int out[4];
+    TEST_ASSERT_EQUAL(0, skiplist_find(list, 5), "Find in empty list");
+    TEST_ASSERT_EQUAL(0, skiplist_delete(list, 5), "Delete from empty list");
+    TEST_ASSERT_EQUAL(0, skiplist_min(list, &val), "Min of empty list");
+    TEST_ASSERT_EQUAL(0, skiplist_max(list, &val), "Max of empty list");
+    TEST_ASSERT_EQUAL(0, skiplist_range(list, -100, 100, out, 4), "Range of empty list");
+    TEST_ASSERT_EQUAL(0, skiplist_size(list), "Empty list has size 0");
+    TEST_ASSERT_EQUAL(0, check_skiplist(list), "Empty list structure");
+
+    TEST_ASSERT_EQUAL(-1, skiplist_insert(NULL, 1), "Insert into NULL list fails");
+    TEST_ASSERT_EQUAL(0, skiplist_find(NULL, 1), "Find in NULL list");
+    TEST_ASSERT_EQUAL(0, skiplist_delete(NULL, 1), "Delete from NULL list");
+
+    destroy_skiplist(&list);
+    TEST_ASSERT_NULL(list, "Destroy sets pointer to NULL");
+    destroy_skiplist(&list);
+    destroy_skiplist(NULL);
+}
+
+void test_skiplist_sequential() {
+    printf("\n=== Testing Sequential Operations ===\n");
+
+    SkipList* list = create_skiplist();
+    TEST_ASSERT_EQUAL(1, skiplist_insert(list, 50), "Insert 50");
+    TEST_ASSERT_EQUAL(0, skiplist_insert(list, 50), "Duplicate insert returns 0");
+    TEST_ASSERT_EQUAL(1, skiplist_insert(list, -2147483647 - 1), "Insert INT_MIN");
+    TEST_ASSERT_EQUAL(1, skiplist_insert(list, 2147483647), "Insert INT_MAX");
+    int val = 0;
+    TEST_ASSERT(skiplist_min(list, &val) && val == -2147483647 - 1, "Min is INT_MIN");
+    TEST_ASSERT(skiplist_max(list, &val) && val == 2147483647, "Max is INT_MAX");
+    TEST_ASSERT_EQUAL(1, skiplist_delete(list, 2147483647), "Delete INT_MAX");
+    TEST_ASSERT(skiplist_max(list, &val) && val == 50, "Max falls back to 50");
+    TEST_ASSERT_EQUAL(0, skiplist_delete(list, 2147483647), "Second delete returns 0");
+    destroy_skiplist(&list);
+
+    // Random operations against a presence table
+    enum { RANGE = 4096, OPS = 200000 };
+    list = create_skiplist();
+    char* present = calloc(RANGE, 1);
+    uint64_t rng = 12345;
+    int model_size = 0;
+    int mismatches = 0;
+    for (int i = 0; i < OPS; i++) {
+        int key = (int)(next_random(&rng) % RANGE) - RANGE / 2;
+        int slot = key + RANGE / 2;
+        switch (next_random(&rng) % 3) {
+            case 0:
+                mismatches += skiplist_insert(list, key) != !present[slot];
+                model_size += !present[slot];
+                present[slot] = 1;
+                break;
+            case 1:
+                mismatches += skiplist_delete(list, key) != present[slot];
+                model_size -= present[slot];
+                present[slot] = 0;
+                break;
+            default:
+                mismatches += skiplist_find(list, key) != present[slot];
+                break;
+        }
+    }
+    TEST_ASSERT_EQUAL(0, mismatches, "Random insert/delete/find match the model");
+    TEST_ASSERT_EQUAL(model_size, check_skiplist(list), "Structure valid after random operations");
+
+    int* out = malloc(RANGE * sizeof(int));
+    int expected = 0;
+    int range_ok = 1;
+    for (int slot = 100; slot < 900; slot++) {
+        expected += present[slot];
+    }
+    int count = skiplist_range(list, 100 - RANGE / 2, 900 - RANGE / 2, out, RANGE);
+    for (int i = 0, slot = 100; slot < 900; slot++) {
+        if (present[slot]) {
+            range_ok &= i < count && out[i++] == slot - RANGE / 2;
+        }
+    }
+    TEST_ASSERT(count == expected && range_ok, "Range returns exactly the values in [lo, hi)");
+    TEST_ASSERT_EQUAL(expected < 5 ? expected : 5,
+                      skiplist_range(list, 100 - RANGE / 2, 900 - RANGE / 2, out, 5),
+                      "Range stops at max");
+    TEST_ASSERT_EQUAL(0, skiplist_range(list, 10, 10, out, RANGE), "Empty range");
+
+    int lo = 0;
+    int hi = RANGE - 1;
+    while (lo < RANGE && !present[lo]) {
+        lo++;
+    }
+    while (hi >= 0 && !present[hi]) {
+        hi--;
+    }
+    int min_val = 0;
+    int max_val = 0;
+    TEST_ASSERT(skiplist_min(list, &min_val) && min_val == lo - RANGE / 2, "Min matches the model");
+    TEST_ASSERT(skiplist_max(list, &max_val) && max_val == hi - RANGE / 2, "Max matches the model");
+
+    free(out);
+    free(present);
+    destroy_skiplist(&list);
+}
+
+void test_skiplist_reclamation() {
+    printf("\n=== Testing Epoch Reclamation ===\n");
+
+    SkipList* list = create_skiplist();
+    unsigned long start = atomic_load(&list->epoch);
+    for (int round = 0; round < 100; round++) {
+        for (int i = 0; i < 1000; i++) {
+            skiplist_insert(list, i);
+        }
+        for (int i = 0; i < 1000; i++) {
+            skiplist_delete(list, i);
+        }
+    }
+    TEST_ASSERT(atomic_load(&list->epoch) > start + 100, "Epoch advances as nodes are retired");
+
+    int waiting = 0;
+    for (int j = 0; j < 3; j++) {
+        for (SkipNode* node = list->slots[0].retired[j]; node != NULL; node = node->retired_next) {
+            waiting++;
+        }
+    }
+    TEST_ASSERT(waiting <= 3 * 64, "Retired nodes are freed, not hoarded");
+    TEST_ASSERT_EQUAL(0, check_skiplist(list), "List empty after churn");
+    destroy_skiplist(&list);
+}
+
+// === CONCURRENT TESTS ===
+
+typedef struct StressArgs {
+    SkipList* list;
+    int id;
+    int ops;
+    int range;
+    int failures;
+    int* inserted; // Per key successful inserts minus deletes
+} StressArgs;
+
+// Each thread owns the keys congruent to its id, so its own view of them
+// must be exactly sequential even while other threads reshape the list.
+void* disjoint_worker(void* arg) {
+    StressArgs* a = arg;
+    char* present = calloc(a->range, 1);
+    uint64_t rng = 0x9E3779B97F4A7C15ULL * (a->id + 1);
+    for (int i = 0; i < a->ops; i++) {
+        int index = (int)(next_random(&rng) % (a->range / STRESS_THREADS));
+        int key = index * STRESS_THREADS + a->id;
+        switch (next_random(&rng) % 3) {
+            case 0:
+                a->failures += skiplist_insert(a->list, key) != !present[key];
+                present[key] = 1;
+                break;
+            case 1:
+                a->failures += skiplist_delete(a->list, key) != present[key];
+                present[key] = 0;
+                break;
+            default:
+                a->failures += skiplist_find(a->list, key) != present[key];
+                break;
+        }
+    }
+    for (int key = a->id; key < a->range; key += STRESS_THREADS) {
+        a->inserted[key] = present[key];
+    }
+    free(present);
+    skiplist_release_thread(a->list);
+    return NULL;
+}
+
+// All threads fight over a few keys. Each successful insert must be matched
+// by a successful delete or by the key still being present at the end.
+void* contended_worker(void* arg) {
+    StressArgs* a = arg;
+    uint64_t rng = 0xD1B54A32D192ED03ULL * (a->id + 1);
+    for (int i = 0; i < a->ops; i++) {
+        int key = (int)(next_random(&rng) % a->range);
+        if (next_random(&rng) & 1) {
+            if (skiplist_insert(a->list, key) == 1) {
+                a->inserted[key]++;
+            }
+        } else if (skiplist_delete(a->list, key) == 1) {
+            a->inserted[key]--;
+        }
+    }
+    skiplist_release_thread(a->list);
+    return NULL;
+}
+
+void run_workers(void* (*worker)(void*), SkipList* list, int ops, int range, StressArgs* args) {
+    pthread_t threads[STRESS_THREADS];
+    for (int t = 0; t < STRESS_THREADS; t++) {
+        args[t] = (StressArgs){list, t, ops, range, 0, calloc(range, sizeof(int))};
+        pthread_create(&threads[t], NULL, worker, &args[t]);
+    }
+    for (int t = 0; t < STRESS_THREADS; t++) {
+        pthread_join(threads[t], NULL);
+    }
+}
+
+void test_concurrent_stress() {
+    printf("\n=== Testing Concurrent Stress ===\n");
+
+    enum { RANGE = 1 << 14 };
+    SkipList* list = create_skiplist();
+    StressArgs args[STRESS_THREADS];
+    run_workers(disjoint_worker, list, 200000, RANGE, args);
+    int failures = 0;
+    int matches = 1;
+    for (int t = 0; t < STRESS_THREADS; t++) {
+        failures += args[t].failures;
+        for (int key = t; key < RANGE; key += STRESS_THREADS) {
+            matches &= skiplist_find(list, key) == args[t].inserted[key];
+        }
+        free(args[t].inserted);
+    }
+    TEST_ASSERT_EQUAL(0, failures, "Disjoint keys: every thread sees its own operations in order");
+    TEST_ASSERT(matches, "Disjoint keys: final contents match every thread's model");
+    TEST_ASSERT(check_skiplist(list) >= 0, "Disjoint keys: structure valid");
+    destroy_skiplist(&list);
+
+    list = create_skiplist();
+    run_workers(contended_worker, list, 200000, 64, args);
+    int balanced = 1;
+    for (int key = 0; key < 64; key++) {
+        int net = 0;
+        for (int t = 0; t < STRESS_THREADS; t++) {
+            net += args[t].inserted[key];
+        }
+        balanced &= net == skiplist_find(list, key);
+    }
+    for (int t = 0; t < STRESS_THREADS; t++) {
+        free(args[t].inserted);
+    }
+    TEST_ASSERT(balanced, "Contended keys: successful inserts minus deletes equal final presence");
+    TEST_ASSERT(check_skiplist(list) >= 0, "Contended keys: structure valid");
+    destroy_skiplist(&list);
+}
+
+// === LINEARIZABILITY ===
+
+// One completed operation on one key. start and end come from a shared
+// counter read before the call and after it returns, so the call's real
+// duration lies inside [start, end].
+typedef enum { OP_INSERT, OP_DELETE, OP_FIND } OpKind;
+
+typedef struct HistoryOp {
+    OpKind kind;
+    int key;
+    int result;
+    long start;
+    long end;
+} HistoryOp;
+
+#define MAX_KEY_OPS 64
+#define MEMO_SIZE (1 << 16)
+
+typedef struct MemoEntry {
+    uint64_t done; // Bitmask of linearized ops
+    int present;   // Key's state after them
+    int used;
+} MemoEntry;
+
+typedef struct Checker {
+    const HistoryOp* ops[MAX_KEY_OPS];
+    int count;
+    MemoEntry memo[MEMO_SIZE]; // States already explored
+} Checker;
+
+// Sequential set semantics for one key: returns the state after op, or -1 if
+// op's result is impossible from present.
+int apply_op(const HistoryOp* op, int present) {
+    switch (op->kind) {
+        case OP_INSERT: return op->result == !present ? 1 : -1;
+        case OP_DELETE: return op->result == present ? 0 : -1;
+        default: return op->result == present ? present : -1;
+    }
+}
+
+int memo_seen(Checker* c, uint64_t done, int present) {
+    size_t i = (size_t)((done * 0x9E3779B97F4A7C15ULL) >> 48 ^ present) & (MEMO_SIZE - 1);
+    for (int probes = 0; c->memo[i].used; probes++) {
+        if (c->memo[i].done == done && c->memo[i].present == present) {
+            return 1;
+        }
+        if (probes == MEMO_SIZE) {
+            return 0; // Full: explore again rather than guess
+        }
+        i = (i + 1) & (MEMO_SIZE - 1);
+    }
+    c->memo[i] = (MemoEntry){done, present, 1};
+    return 0;
+}
+
+// Wing & Gong search: some op that started before every pending op ended
+// can go next. Tries each, and remembers states already shown to fail.
+int linearize(Checker* c, uint64_t done, int present) {
+    if (done == (c->count == 64 ? ~0ULL : (1ULL << c->count) - 1)) {
+        return 1;
+    }
+    if (memo_seen(c, done, present)) {
+        return 0;
+    }
+    long first_end = -1;
+    for (int i = 0; i < c->count; i++) {
+        if (!(done >> i & 1) && (first_end < 0 || c->ops[i]->end < first_end)) {
+            first_end = c->ops[i]->end;
+        }
+    }
+    for (int i = 0; i < c->count; i++) {
+        if (done >> i & 1 || c->ops[i]->start > first_end) {
+            continue;
+        }
+        int next = apply_op(c->ops[i], present);
+        if (next >= 0 && linearize(c, done | 1ULL << i, next)) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+// Checks one key's history from a known starting state. Linearizability is
+// compositional, so checking every key separately checks the whole set.
+// @return: 1 if linearizable, 0 if not, -1 if too long to check
+int check_key_history(Checker* c, const HistoryOp* ops, int count, int key, int present) {
+    c->count = 0;
+    for (int i = 0; i < count; i++) {
+        if (ops[i].key == key) {
+            if (c->count == MAX_KEY_OPS) {
+                return -1;
+            }
+            c->ops[c->count++] = &ops[i];
+        }
+    }
+    memset(c->memo, 0, sizeof(c->memo));
+    return linearize(c, 0, present);
+}
+
+typedef struct HistoryArgs {
+    SkipList* list;
+    int id;
+    int ops;
+    int keys;
+    atomic_long* clock;
+    HistoryOp* history;
+} HistoryArgs;
+
+void* history_worker(void* arg) {
+    HistoryArgs* a = arg;
+    uint64_t rng = 0xA0761D6478BD642FULL * (a->id + 1) + (uint64_t)(uintptr_t)a->history;
+    for (int i = 0; i < a->ops; i++) {
+        HistoryOp* op = &a->history[i];
+        op->key = (int)(next_random(&rng) % a->keys);
+        op->kind = (OpKind)(next_random(&rng) % 3);
+        op->start = atomic_fetch_add(a->clock, 1);
+        switch (op->kind) {
+            case OP_INSERT: op->result = skiplist_insert(a->list, op->key); break;
+            case OP_DELETE: op->result = skiplist_delete(a->list, op->key); break;
+            default: op->result = skiplist_find(a->list, op->key); break;
+        }
+        op->end = atomic_fetch_add(a->clock, 1);
+    }
+    skiplist_release_thread(a->list);
+    return NULL;
+}
+
+void test_linearizability() {
+    printf("\n=== Testing Linearizability ===\n");
+
+    Checker* checker = malloc(sizeof(Checker));
+
+    // The checker itself must reject impossible histories.
+    HistoryOp bad[2] = {{OP_INSERT, 0, 1, 0, 1}, {OP_INSERT, 0, 1, 2, 3}};
+    TEST_ASSERT_EQUAL(0, check_key_history(checker, bad, 2, 0, 0), "Checker rejects two sequential successful inserts");
+    HistoryOp overlap[3] = {{OP_INSERT, 0, 1, 0, 5}, {OP_FIND, 0, 1, 1, 2}, {OP_FIND, 0, 0, 3, 4}};
+    TEST_ASSERT_EQUAL(0, check_key_history(checker, overlap, 3, 0, 0), "Checker rejects a find undoing an earlier find");
+    HistoryOp good[3] = {{OP_INSERT, 0, 1, 0, 5}, {OP_FIND, 0, 0, 1, 2}, {OP_FIND, 0, 1, 3, 4}};
+    TEST_ASSERT_EQUAL(1, check_key_history(checker, good, 3, 0, 0), "Checker accepts a find ordered before an overlapping insert");
+
+    enum { KEYS = 16, OPS = 120, ROUNDS = 200 };
+    SkipList* list = create_skiplist();
+    HistoryOp* history = malloc(STRESS_THREADS * OPS * sizeof(HistoryOp));
+    atomic_long clock = 0;
+    int violations = 0;
+    int checked = 0;
+    for (int round = 0; round < ROUNDS; round++) {
+        int initial[KEYS];
+        for (int key = 0; key < KEYS; key++) {
+            initial[key] = skiplist_find(list, key);
+        }
+        pthread_t threads[STRESS_THREADS];
+        HistoryArgs args[STRESS_THREADS];
+        for (int t = 0; t < STRESS_THREADS; t++) {
+            args[t] = (HistoryArgs){list, t + round * STRESS_THREADS, OPS, KEYS, &clock, history + t * OPS};
+            pthread_create(&threads[t], NULL, history_worker, &args[t]);
+        }
+        for (int t = 0; t < STRESS_THREADS; t++) {
+            pthread_join(threads[t], NULL);
+        }
+        for (int key = 0; key < KEYS; key++) {
+            int result = check_key_history(checker, history, STRESS_THREADS * OPS, key, initial[key]);
+            if (result >= 0) {
+                checked++;
+                violations += result == 0;
+            }
+        }
+    }
+    TEST_ASSERT(checked > ROUNDS * KEYS / 2, "Most per-key histories were short enough to check");
+    TEST_ASSERT_EQUAL(0, violations, "Every checked per-key history is linearizable");
+    TEST_ASSERT(check_skiplist(list) >= 0, "Structure valid after history rounds");
+
+    free(history);
+    free(checker);
+    destroy_skiplist(&list);
+}
+
+// === RANGE SCANS UNDER UPDATES ===
+
+typedef struct RangeArgs {
+    SkipList* list;
+    int id;
+    int ops;
+    atomic_int* stop;
+    int failures;
+} RangeArgs;
+
+#define RANGE_KEYS 8192
+
+// Writers churn keys = 1 mod 4; keys = 0 mod 4 stay put; keys = 2, 3 mod 4
+// never exist.
+void* range_writer(void* arg) {
+    RangeArgs* a = arg;
+    uint64_t rng = 0x8BB84B93962EACC9ULL * (a->id + 1);
+    for (int i = 0; i < a->ops; i++) {
+        int key = (int)(next_random(&rng) % (RANGE_KEYS / 4)) * 4 + 1;
+        if (next_random(&rng) & 1) {
+            skiplist_insert(a->list, key);
+        } else {
+            skiplist_delete(a->list, key);
+        }
+    }
+    skiplist_release_thread(a->list);
+    return NULL;
+}
+
+void* range_reader(void* arg) {
+    RangeArgs* a = arg;
+    uint64_t rng = 0x4F1BBCDCBFA53E0BULL * (a->id + 1);
+    int* out = malloc(RANGE_KEYS * sizeof(int));
+    while (!atomic_load(a->stop)) {
+        int lo = (int)(next_random(&rng) % RANGE_KEYS);
+        int hi = lo + (int)(next_random(&rng) % 512);
+        int count = skiplist_range(a->list, lo, hi, out, RANGE_KEYS);
+        int stable = (lo + 3) / 4 * 4;
+        int seen_stable = 0;
+        for (int i = 0; i < count; i++) {
+            a->failures += out[i] < lo || out[i] >= hi || (i > 0 && out[i - 1] >= out[i]);
+            a->failures += out[i] % 4 >= 2;
+            seen_stable += out[i] % 4 == 0;
+        }
+        for (; stable < hi && stable <= RANGE_KEYS; stable += 4) {
+            seen_stable--;
+        }
+        a->failures += seen_stable != 0;
+        int val = 0;
+        a->failures += !skiplist_min(a->list, &val) || val != 0;
+        a->failures += !skiplist_max(a->list, &val) || val != RANGE_KEYS;
+    }
+    free(out);
+    skiplist_release_thread(a->list);
+    return NULL;
+}
+
+void test_concurrent_ranges() {
+    printf("\n=== Testing Range Scans Under Updates ===\n");
+
+    SkipList* list = create_skiplist();
+    for (int key = 0; key <= RANGE_KEYS; key += 4) {
+        skiplist_insert(list, key);
+    }
+    atomic_int stop = 0;
+    pthread_t threads[STRESS_THREADS];
+    RangeArgs args[STRESS_THREADS];
+    for (int t = 0; t < STRESS_THREADS; t++) {
+        args[t] = (RangeArgs){list, t, 100000, &stop, 0};
+        pthread_create(&threads[t], NULL, t < STRESS_THREADS / 2 ? range_writer : range_reader, &args[t]);
+    }
+    for (int t = 0; t < STRESS_THREADS / 2; t++) {
+        pthread_join(threads[t], NULL);
+    }
+    atomic_store(&stop, 1);
+    int failures = 0;
+    for (int t = STRESS_THREADS / 2; t < STRESS_THREADS; t++) {
+        pthread_join(threads[t], NULL);
+        failures += args[t].failures;
+    }
+    TEST_ASSERT_EQUAL(0, failures, "Scans are sorted, in range, and include every untouched key");
+    TEST_ASSERT(check_skiplist(list) >= 0, "Structure valid after concurrent scans");
+    destroy_skiplist(&list);
+}
+
+void* slot_worker(void* arg) {
+    SkipList* list = arg;
+    int ok = skiplist_insert(list, 1) >= 0;
+    skiplist_release_thread(list);
+    return (void*)(intptr_t)ok;
+}
+
+void test_thread_slots() {
+    printf("\n=== Testing Thread Registration ===\n");
+
+    SkipList* list = create_skiplist();
+    int ok = 1;
+    for (int i = 0; i < 2 * SKIPLIST_MAX_THREADS; i++) {
+        pthread_t thread;
+        void* result = NULL;
+        pthread_create(&thread, NULL, slot_worker, list);
+        pthread_join(thread, &result);
+        ok &= result != NULL;
+    }
+    TEST_ASSERT(ok, "Released slots are reused by later threads");
+    TEST_ASSERT_EQUAL(1, skiplist_size(list), "Value inserted once");
+
+    // Two lists used alternately by one thread.
+    SkipList* other = create_skiplist();
+    for (int i = 0; i < 100; i++) {
+        skiplist_insert(list, i);
+        skiplist_insert(other, -i);
+    }
+    TEST_ASSERT(skiplist_size(list) == 100 && skiplist_size(other) == 100, "One thread can use several lists");
+    TEST_ASSERT(check_skiplist(list) >= 0 && check_skiplist(other) >= 0, "Both lists valid");
+    destroy_skiplist(&other);
+    destroy_skiplist(&list);
+}
+
+int main() {
+    printf("Running skiplist tests...\n");
+
+    test_skiplist_empty();
+    test_skiplist_sequential();
+    test_skiplist_reclamation();
+    test_concurrent_stress();
+    test_linearizability();
+    test_concurrent_ranges();
+    test_thread_slots();
+
+    // Print summary
+    printf("\n===================================\n");
+    printf("Test Summary: %d/%d tests passed\n", tests_passed, tests_run);
+
+    if (tests_passed == tests_run) {
+        printf("SUCCESS - All tests passed!\n");
+        return 0;
+    } else {
+        printf("FAILED - %d tests failed\n", tests_run - tests_passed);
+        return 1;
+    }
+}
@@ -0,0 +1,173 @@
+#include "multiqueue.h"
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+// Throughput and quality benchmark for the MultiQueue.
+// 1. Throughput: threads do a 50/50 insert/pop mix against either a single Heap
+//    behind one mutex (what we had) or a MultiQueue with c = 2.
+// 2. Rank error: how far from the true minimum each pop lands, for growing c * p.
+
+#define PREFILL 1000000
+
+typedef struct LockedHeap {
+    pthread_mutex_t lock;
+    Heap* heap;
+} LockedHeap;
+
+typedef struct BenchArgs {
+    LockedHeap* locked;
+    MultiQueue* mq;
+    int ops;
+    unsigned int seed;
+} BenchArgs;
+
+double now_seconds() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+void* locked_worker(void* arg) {
+    BenchArgs* args = arg;
+    int val;
+    for (int i = 0; i < args->ops; i++) {
+        pthread_mutex_lock(&args->locked->lock);
+        if (i & 1) {
+            pop_value(args->locked->heap, &val);
+        }
+        else {
+            insert(rand_r(&args->seed), args->locked->heap);
+        }
+        pthread_mutex_unlock(&args->locked->lock);
+    }
+    return NULL;
+}
+
+void* mq_worker(void* arg) {
+    BenchArgs* args = arg;
+    int val;
+    for (int i = 0; i < args->ops; i++) {
+        if (i & 1) {
+            mq_pop(args->mq, &val);
+        }
+        else {
+            mq_insert(rand_r(&args->seed), args->mq);
+        }
+    }
+    return NULL;
+}
+
+double run_threads(int nthreads, void* (*worker)(void*), LockedHeap* locked, MultiQueue* mq, int ops) {
+    pthread_t* threads = malloc(nthreads * sizeof(pthread_t));
+    BenchArgs* args = malloc(nthreads * sizeof(BenchArgs));
+    double start = now_seconds();
+    for (int t = 0; t < nthreads; t++) {
+        args[t] = (BenchArgs){locked, mq, ops, (unsigned int)(t + 1) * 7919u};
+        pthread_create(&threads[t], NULL, worker, &args[t]);
+    }
+    for (int t = 0; t < nthreads; t++) {
+        pthread_join(threads[t], NULL);
+    }
+    double elapsed = now_seconds() - start;
+    free(threads);
+    free(args);
+    return (double)nthreads * ops / elapsed / 1e6; // Mops/s
+}
+
+void bench_throughput(int max_threads, int ops) {
+    printf("=== Throughput (50%% insert / 50%% pop, prefill %d) ===\n", PREFILL);
+    printf("%8s %18s %18s\n", "threads", "mutex Heap Mops/s", "MultiQueue Mops/s");
+    unsigned int seed = 42;
+    for (int nthreads = 1; nthreads <= max_threads; nthreads *= 2) {
+        LockedHeap locked;
+        pthread_mutex_init(&locked.lock, NULL);
+        locked.heap = create_heap(PREFILL * 2);
+        for (int i = 0; i < PREFILL; i++) {
+            insert(rand_r(&seed), locked.heap);
+        }
+        double locked_mops = run_threads(nthreads, locked_worker, &locked, NULL, ops);
+        destroy(&locked.heap);
+        pthread_mutex_destroy(&locked.lock);
+
+        MultiQueue* mq = create_multiqueue(nthreads, 2);
+        for (int i = 0; i < PREFILL; i++) {
+            mq_insert(rand_r(&seed), mq);
+        }
+        double mq_mops = run_threads(nthreads, mq_worker, NULL, mq, ops);
+        destroy_multiqueue(&mq);
+
+        printf("%8d %18.2f %18.2f\n", nthreads, locked_mops, mq_mops);
+    }
+}
+
+// Fenwick tree over key presence, so "how many smaller keys are still queued" is O(log n).
+void fenwick_add(int* tree, int n, int idx, int delta) {
+    for (idx++; idx <= n; idx += idx & -idx) {
+        tree[idx] += delta;
+    }
+}
+
+int fenwick_prefix(int* tree, int idx) {
+    // Sum of presence over keys [0, idx)
+    int sum = 0;
+    for (; idx > 0; idx -= idx & -idx) {
+        sum += tree[idx];
+    }
+    return sum;
+}
+
+void bench_rank_error(int max_threads, int n) {
+    printf("\n=== Rank error (%d distinct keys, c = 2) ===\n", n);
+    printf("%8s %10s %12s %10s\n", "p", "queues", "mean rank", "max rank");
+    int* keys = malloc(n * sizeof(int));
+    int* tree = malloc((n + 1) * sizeof(int));
+    unsigned int seed = 1234;
+    for (int p = 1; p <= max_threads; p *= 2) {
+        // Random permutation of 0..n-1 so every key is distinct.
+        for (int i = 0; i < n; i++) {
+            keys[i] = i;
+        }
+        for (int i = n - 1; i > 0; i--) {
+            int j = rand_r(&seed) % (i + 1);
+            int tmp = keys[i];
+            keys[i] = keys[j];
+            keys[j] = tmp;
+        }
+        MultiQueue* mq = create_multiqueue(p, 2);
+        for (int i = 0; i <= n; i++) {
+            tree[i] = 0;
+        }
+        for (int i = 0; i < n; i++) {
+            mq_insert(keys[i], mq);
+            fenwick_add(tree, n, keys[i], 1);
+        }
+        // Rank 0 means the pop returned the true minimum.
+        double total_rank = 0;
+        int max_rank = 0;
+        int val;
+        while (mq_pop(mq, &val)) {
+            int rank = fenwick_prefix(tree, val);
+            total_rank += rank;
+            if (rank > max_rank) {
+                max_rank = rank;
+            }
+            fenwick_add(tree, n, val, -1);
+        }
+        printf("%8d %10d %12.2f %10d\n", p, mq->num_queues, total_rank / n, max_rank);
+        destroy_multiqueue(&mq);
+    }
+    free(keys);
+    free(tree);
+}
+
+int main(int argc, char** argv) {
+    // Usage: ./bench_multiqueue [max_threads] [ops_per_thread]
+    int max_threads = (argc > 1) ? atoi(argv[1]) : 64;
+    int ops = (argc > 2) ? atoi(argv[2]) : 1000000;
+
+    bench_throughput(max_threads, ops);
+    bench_rank_error(max_threads, 1000000);
+    return 0;
+}
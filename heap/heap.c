@@ -11,6 +11,7 @@ Heap* create_heap(int size) {
     Heap* heap = malloc(sizeof(Heap));
     if (heap == NULL) {
         fprintf(stderr, "ERROR - Could not malloc %lu bytes.\n", sizeof(Heap));
+        return NULL;
     }
     heap->count = 0;
     heap->length = size;
@@ -18,6 +19,7 @@ Heap* create_heap(int size) {
     if (heap->array == NULL) {
         free(heap);
         fprintf(stderr, "ERROR - Could not malloc %lu bytes.\n", size * sizeof(int));
+        return NULL;
     }
     return heap;
 }
@@ -110,26 +112,26 @@ int choose_child(Heap* heap, int a, int b) {
     return (heap->array[a] < heap->array[b]) ? a : b;
 }
 
-int* pop(Heap* heap) {
-    // Returns element at the head.
+int pop_value(Heap* heap, int* out) {
+    // Same as pop, but writes the root into caller-owned memory instead of a static.
+    // Safe to call on different heaps from different threads at once.
     if (heap == NULL) {
         // Bad case
         fprintf(stderr, "ERROR - Must pass a valid Heap*");
-        return NULL;
+        return 0;
     }
     if (heap->count == 0) {
         // Valid case, empty heap with no elements.
-        return NULL;
+        return 0;
     }
-    static int popped_value;
-    popped_value = heap->array[0];
+    *out = heap->array[0];
     // Now, if the count > 1, we have to do some restructuring.
     // Otherwise, return immediately.
     // we do not need to nullify any values.
     // Just decrease count so we can't access the position anymore.
     if (heap->count == 1) {
         (heap->count)--;  
-        return &popped_value;
+        return 1;
     }
     // Else, we do some restructuring.
 
@@ -143,7 +145,7 @@ int* pop(Heap* heap) {
     if (child_idx == -1) {
         // Edge case for a heap with original size 2 (e.g. [1,2])
         // We pop 1, 2 remains. No valid children to iterate to.
-        return &popped_value;
+        return 1;
     }
     int child_val = heap->array[child_idx];
     while (parent_val >= child_val && child_idx != -1) {
@@ -161,6 +163,35 @@ int* pop(Heap* heap) {
         }
     }
     
+    return 1;
+}
+
+int* pop(Heap* heap) {
+    // Returns element at the head.
+    static int popped_value;
+    if (!pop_value(heap, &popped_value)) {
+        return NULL;
+    }
     return &popped_value;
-    
+}
+
+void replace_top(int val, Heap* heap) {
+    // Pop + insert in one sift-down: overwrite the root, then push it down.
+    if (heap == NULL) {
+        fprintf(stderr, "ERROR - Must pass a valid Heap*");
+        return;
+    }
+    if (heap->count == 0) {
+        insert(val, heap);
+        return;
+    }
+    int parent_idx = 0;
+    int child_idx = choose_child(heap, 1, 2);
+    while (child_idx != -1 && heap->array[child_idx] < val) {
+        // Move the smaller child up instead of swapping, write val once at the end.
+        heap->array[parent_idx] = heap->array[child_idx];
+        parent_idx = child_idx;
+        child_idx = choose_child(heap, (2* parent_idx +1), (2* parent_idx +2));
+    }
+    heap->array[parent_idx] = val;
 }
@@ -22,6 +22,14 @@ void insert(int val, Heap* heap);
 // Remove and return the minimum element (returns pointer, NULL if empty)
 int* pop(Heap* heap);
 
+// Remove the minimum element into *out (returns 1, or 0 if empty).
+// Reentrant alternative to pop, which returns a pointer to a static.
+int pop_value(Heap* heap, int* out);
+
+// Replace the minimum element with val and restore the heap (one sift-down).
+// Equivalent to pop followed by insert, but about half the work.
+void replace_top(int val, Heap* heap);
+
 // Internal function to resize the heap when needed
 void resize(Heap* heap);
 
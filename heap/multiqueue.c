@@ -0,0 +1,161 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include "multiqueue.h"
+
+// Per-thread xorshift state. Seeded lazily so every thread gets its own sequence.
+static __thread uint64_t mq_rng_state = 0;
+static atomic_ullong mq_seed_counter = 0;
+
+unsigned int mq_random(void) {
+    if (mq_rng_state == 0) {
+        // Spread the seeds apart; a zero state would get stuck at zero.
+        uint64_t seed = atomic_fetch_add(&mq_seed_counter, 1) + 1;
+        mq_rng_state = seed * 0x9E3779B97F4A7C15ULL;
+    }
+    mq_rng_state ^= mq_rng_state >> 12;
+    mq_rng_state ^= mq_rng_state << 25;
+    mq_rng_state ^= mq_rng_state >> 27;
+    return (unsigned int)((mq_rng_state * 0x2545F4914F6CDD1DULL) >> 32);
+}
+
+MultiQueue* create_multiqueue(int num_threads, int c) {
+    if (num_threads < 1 || c < 1) {
+        fprintf(stderr, "ERROR - num_threads and c must be >= 1\n");
+        return NULL;
+    }
+    MultiQueue* mq = malloc(sizeof(MultiQueue));
+    if (mq == NULL) {
+        fprintf(stderr, "ERROR - Could not malloc %lu bytes.\n", sizeof(MultiQueue));
+        return NULL;
+    }
+    mq->num_queues = num_threads * c;
+    // sizeof(MQSlot) is a multiple of 64 thanks to the _Alignas, so aligned_alloc is happy.
+    mq->slots = aligned_alloc(64, mq->num_queues * sizeof(MQSlot));
+    if (mq->slots == NULL) {
+        fprintf(stderr, "ERROR - Could not malloc %lu bytes.\n", mq->num_queues * sizeof(MQSlot));
+        free(mq);
+        return NULL;
+    }
+    for (int i = 0; i < mq->num_queues; i++) {
+        MQSlot* slot = &mq->slots[i];
+        slot->heap = create_heap(16);
+        if (slot->heap == NULL) {
+            for (int j = 0; j < i; j++) {
+                pthread_mutex_destroy(&mq->slots[j].lock);
+                destroy(&mq->slots[j].heap);
+            }
+            free(mq->slots);
+            free(mq);
+            return NULL;
+        }
+        pthread_mutex_init(&slot->lock, NULL);
+        atomic_init(&slot->top, 0);
+        atomic_init(&slot->count, 0);
+    }
+    return mq;
+}
+
+void destroy_multiqueue(MultiQueue** mq) {
+    if (mq == NULL || *mq == NULL) {
+        return;
+    }
+    for (int i = 0; i < (*mq)->num_queues; i++) {
+        pthread_mutex_destroy(&(*mq)->slots[i].lock);
+        destroy(&(*mq)->slots[i].heap);
+    }
+    free((*mq)->slots);
+    free(*mq);
+    *mq = NULL;
+}
+
+void mq_publish(MQSlot* slot) {
+    // Called with the slot lock held. Readers peek at these without the lock,
+    // so a stale value only costs a worse choice, never a wrong result.
+    int count = slot->heap->count;
+    if (count > 0) {
+        atomic_store_explicit(&slot->top, slot->heap->array[0], memory_order_relaxed);
+    }
+    atomic_store_explicit(&slot->count, count, memory_order_release);
+}
+
+void mq_insert(int val, MultiQueue* mq) {
+    if (mq == NULL) {
+        fprintf(stderr, "ERROR - Must pass a valid MultiQueue*");
+        return;
+    }
+    while (1) {
+        // Pick a random heap; if someone else holds it, just pick another.
+        MQSlot* slot = &mq->slots[mq_random() % mq->num_queues];
+        if (pthread_mutex_trylock(&slot->lock) != 0) {
+            continue;
+        }
+        insert(val, slot->heap);
+        mq_publish(slot);
+        pthread_mutex_unlock(&slot->lock);
+        return;
+    }
+}
+
+int mq_pop(MultiQueue* mq, int* out) {
+    if (mq == NULL || out == NULL) {
+        fprintf(stderr, "ERROR - Must pass a valid MultiQueue* and out pointer");
+        return 0;
+    }
+    // Fast path: two random choices, take the smaller cached root.
+    for (int attempt = 0; attempt < 2 * mq->num_queues; attempt++) {
+        MQSlot* a = &mq->slots[mq_random() % mq->num_queues];
+        MQSlot* b = &mq->slots[mq_random() % mq->num_queues];
+        int a_count = atomic_load_explicit(&a->count, memory_order_acquire);
+        int b_count = atomic_load_explicit(&b->count, memory_order_acquire);
+        if (a_count == 0 && b_count == 0) {
+            continue;
+        }
+        MQSlot* best;
+        if (a_count == 0) {
+            best = b;
+        }
+        else if (b_count == 0) {
+            best = a;
+        }
+        else {
+            int a_top = atomic_load_explicit(&a->top, memory_order_relaxed);
+            int b_top = atomic_load_explicit(&b->top, memory_order_relaxed);
+            best = (a_top <= b_top) ? a : b;
+        }
+        if (pthread_mutex_trylock(&best->lock) != 0) {
+            continue;
+        }
+        int popped = pop_value(best->heap, out);
+        mq_publish(best);
+        pthread_mutex_unlock(&best->lock);
+        if (popped) {
+            return 1;
+        }
+    }
+    // Slow path: the queue looks (nearly) empty. Visit every heap in order
+    // so we only report empty if each one was empty when we looked at it.
+    for (int i = 0; i < mq->num_queues; i++) {
+        MQSlot* slot = &mq->slots[i];
+        pthread_mutex_lock(&slot->lock);
+        int popped = pop_value(slot->heap, out);
+        mq_publish(slot);
+        pthread_mutex_unlock(&slot->lock);
+        if (popped) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+int mq_size(MultiQueue* mq) {
+    if (mq == NULL) {
+        fprintf(stderr, "ERROR - Must pass a valid MultiQueue*");
+        return 0;
+    }
+    int total = 0;
+    for (int i = 0; i < mq->num_queues; i++) {
+        total += atomic_load_explicit(&mq->slots[i].count, memory_order_relaxed);
+    }
+    return total;
+}
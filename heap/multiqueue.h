@@ -0,0 +1,68 @@
+#ifndef MULTIQUEUE_H
+#define MULTIQUEUE_H
+
+#include <pthread.h>
+#include <stdatomic.h>
+#include "heap.h"
+
+/**
+ * MultiQueue: relaxed concurrent priority queue.
+ * Keeps c * p independent min-heaps (the Heap from heap.c), each behind its own lock.
+ * Insert goes to a random heap; pop looks at the cached roots of two random heaps
+ * and removes from the better one. A pop is not guaranteed to return the global
+ * minimum, but the expected rank of what it returns is O(c * p).
+ */
+
+/**
+ * One heap plus its lock, padded to its own cache line(s)
+ * so neighbouring slots do not false-share.
+ */
+typedef struct MQSlot {
+    _Alignas(64) pthread_mutex_t lock;
+    Heap* heap;
+    atomic_int top;   // Cached root, only meaningful while count > 0
+    atomic_int count; // Cached element count
+} MQSlot;
+
+typedef struct MultiQueue {
+    int num_queues; // c * p
+    MQSlot* slots;
+} MultiQueue;
+
+/**
+ * Creates a MultiQueue sized for num_threads workers
+ * @param num_threads: Expected number of concurrent threads (p)
+ * @param c: Heaps per thread, 2 is the usual choice (c)
+ * @return: Pointer to new queue, or NULL if allocation fails
+ */
+MultiQueue* create_multiqueue(int num_threads, int c);
+
+/**
+ * Frees all heaps and the queue itself
+ * @param mq: Pointer to queue pointer (set to NULL)
+ */
+void destroy_multiqueue(MultiQueue** mq);
+
+/**
+ * Inserts a value into a random heap. Thread-safe.
+ * @param val: Value to insert
+ * @param mq: Target queue
+ */
+void mq_insert(int val, MultiQueue* mq);
+
+/**
+ * Removes an approximately minimal value. Thread-safe.
+ * @param mq: Target queue
+ * @param out: Receives the popped value
+ * @return: 1 if a value was popped, 0 if every heap was empty
+ */
+int mq_pop(MultiQueue* mq, int* out);
+
+/**
+ * Approximate number of elements (exact when no operation is in flight)
+ * @param mq: Target queue
+ * @return: Sum of per-heap counts
+ */
+int mq_size(MultiQueue* mq);
+
+#endif
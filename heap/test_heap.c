@@ -292,6 +292,27 @@ void test_stress() {
     destroy(&stress_heap);
 }
 
+void test_replace_top() {
+    printf("\n=== Testing replace_top ===\n");
+
+    Heap* heap = create_test_heap();
+    replace_top(10, heap);
+    TEST_ASSERT_EQUAL(4, heap->count, "replace_top keeps count unchanged");
+    TEST_ASSERT_EQUAL(2, heap->array[0], "New minimum moves to root");
+    TEST_ASSERT(verify_heap_property(heap), "Heap property maintained after replace_top");
+
+    replace_top(0, heap);
+    TEST_ASSERT_EQUAL(0, heap->array[0], "Smaller value stays at root");
+    TEST_ASSERT(verify_heap_property(heap), "Heap property maintained when root stays");
+
+    destroy(&heap);
+
+    Heap* empty_heap = create_heap(4);
+    replace_top(7, empty_heap);
+    TEST_ASSERT_EQUAL(1, empty_heap->count, "replace_top on empty heap inserts");
+    destroy(&empty_heap);
+}
+
 void test_destroy() {
     printf("\n=== Testing destroy ===\n");
     
@@ -330,6 +351,7 @@ int main() {
     test_resize();
     test_edge_cases();
     test_stress();
+    test_replace_top();
     test_destroy();
     
     print_test_summary();
@@ -0,0 +1,205 @@
+#include "multiqueue.h"
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Test counter
+int tests_run = 0;
+int tests_passed = 0;
+
+// Test helper macros
+#define TEST_ASSERT(condition, message) \
+    do { \
+        tests_run++; \
+        if (condition) { \
+            tests_passed++; \
+            printf("SUCCESS - %s\n", message); \
+        } else { \
+            printf("FAILED - %s\n", message); \
+        } \
+    } while(0)
+
+#define TEST_ASSERT_NULL(ptr, message) \
+    TEST_ASSERT((ptr) == NULL, message)
+
+#define TEST_ASSERT_NOT_NULL(ptr, message) \
+    TEST_ASSERT((ptr) != NULL, message)
+
+#define TEST_ASSERT_EQUAL(expected, actual, message) \
+    TEST_ASSERT((expected) == (actual), message)
+
+#define NUM_THREADS 4
+#define PER_THREAD 5000
+
+typedef struct WorkerArgs {
+    MultiQueue* mq;
+    int id;
+    int* seen;     // seen[v] counts how many times v was popped
+    int popped;
+} WorkerArgs;
+
+void test_create_multiqueue() {
+    printf("\n=== Testing create_multiqueue ===\n");
+
+    MultiQueue* mq = create_multiqueue(4, 2);
+    TEST_ASSERT_NOT_NULL(mq, "create_multiqueue returns non-NULL");
+    TEST_ASSERT_EQUAL(8, mq->num_queues, "num_queues is c * p");
+    TEST_ASSERT_EQUAL(0, mq_size(mq), "New queue is empty");
+    TEST_ASSERT_EQUAL(0, (int)(sizeof(MQSlot) % 64), "Slots are cache line sized");
+
+    int out;
+    TEST_ASSERT_EQUAL(0, mq_pop(mq, &out), "Pop on empty queue returns 0");
+
+    destroy_multiqueue(&mq);
+    TEST_ASSERT_NULL(mq, "destroy_multiqueue sets pointer to NULL");
+
+    TEST_ASSERT_NULL(create_multiqueue(0, 2), "Zero threads is rejected");
+}
+
+void test_single_queue_is_exact() {
+    printf("\n=== Testing single heap degenerates to exact order ===\n");
+
+    // With one heap there is nothing to relax: pops must come out sorted.
+    MultiQueue* mq = create_multiqueue(1, 1);
+    int values[] = {15, 3, 9, 1, 12, 7, 4, 8, 2, 11};
+    int n = sizeof(values) / sizeof(values[0]);
+    for (int i = 0; i < n; i++) {
+        mq_insert(values[i], mq);
+    }
+    TEST_ASSERT_EQUAL(n, mq_size(mq), "All values inserted");
+
+    int sorted = 1;
+    int prev = 0;
+    for (int i = 0; i < n; i++) {
+        int val;
+        mq_pop(mq, &val);
+        if (i > 0 && val < prev) {
+            sorted = 0;
+        }
+        prev = val;
+    }
+    TEST_ASSERT(sorted, "Values come out in sorted order");
+    TEST_ASSERT_EQUAL(0, mq_size(mq), "Queue empty after popping everything");
+
+    destroy_multiqueue(&mq);
+}
+
+void test_sequential_relaxed() {
+    printf("\n=== Testing relaxed pops keep every element ===\n");
+
+    MultiQueue* mq = create_multiqueue(4, 2);
+    int n = 1000;
+    int* seen = calloc(n, sizeof(int));
+    for (int i = n - 1; i >= 0; i--) {
+        mq_insert(i, mq);
+    }
+    TEST_ASSERT_EQUAL(n, mq_size(mq), "All values inserted");
+
+    int val;
+    int popped = 0;
+    while (mq_pop(mq, &val)) {
+        seen[val]++;
+        popped++;
+    }
+    int all_once = 1;
+    for (int i = 0; i < n; i++) {
+        if (seen[i] != 1) {
+            all_once = 0;
+        }
+    }
+    TEST_ASSERT_EQUAL(n, popped, "Pop count matches insert count");
+    TEST_ASSERT(all_once, "Every value popped exactly once");
+
+    free(seen);
+    destroy_multiqueue(&mq);
+}
+
+void* producer(void* arg) {
+    WorkerArgs* args = arg;
+    for (int i = 0; i < PER_THREAD; i++) {
+        mq_insert(args->id * PER_THREAD + i, args->mq);
+    }
+    return NULL;
+}
+
+void* consumer(void* arg) {
+    WorkerArgs* args = arg;
+    int val;
+    while (mq_pop(args->mq, &val)) {
+        // Each value is popped by exactly one thread, so plain writes are race-free.
+        args->seen[val]++;
+        args->popped++;
+    }
+    return NULL;
+}
+
+void test_concurrent() {
+    printf("\n=== Testing concurrent producers and consumers ===\n");
+
+    MultiQueue* mq = create_multiqueue(NUM_THREADS, 2);
+    int total = NUM_THREADS * PER_THREAD;
+    int* seen = calloc(total, sizeof(int));
+    pthread_t threads[NUM_THREADS];
+    WorkerArgs args[NUM_THREADS];
+
+    for (int i = 0; i < NUM_THREADS; i++) {
+        args[i] = (WorkerArgs){mq, i, seen, 0};
+        pthread_create(&threads[i], NULL, producer, &args[i]);
+    }
+    for (int i = 0; i < NUM_THREADS; i++) {
+        pthread_join(threads[i], NULL);
+    }
+    TEST_ASSERT_EQUAL(total, mq_size(mq), "Concurrent inserts all landed");
+
+    for (int i = 0; i < NUM_THREADS; i++) {
+        pthread_create(&threads[i], NULL, consumer, &args[i]);
+    }
+    int popped = 0;
+    for (int i = 0; i < NUM_THREADS; i++) {
+        pthread_join(threads[i], NULL);
+        popped += args[i].popped;
+    }
+    int all_once = 1;
+    for (int i = 0; i < total; i++) {
+        if (seen[i] != 1) {
+            all_once = 0;
+        }
+    }
+    TEST_ASSERT_EQUAL(total, popped, "Concurrent pops drained the queue");
+    TEST_ASSERT(all_once, "No value lost or duplicated under contention");
+    TEST_ASSERT_EQUAL(0, mq_size(mq), "Queue empty after concurrent drain");
+
+    free(seen);
+    destroy_multiqueue(&mq);
+}
+
+void print_test_summary() {
+    printf("\n==================================================\n");
+    printf("TEST SUMMARY\n");
+    printf("==================================================\n");
+    printf("Tests run: %d\n", tests_run);
+    printf("Tests passed: %d\n", tests_passed);
+    printf("Tests failed: %d\n", tests_run - tests_passed);
+    printf("Success rate: %.1f%%\n", (float)tests_passed / tests_run * 100);
+
+    if (tests_passed == tests_run) {
+        printf("\nSUCCESS - ALL TESTS PASSED!\n");
+    } else {
+        printf("\nFAILED - Some tests failed. Check the output above for details.\n");
+    }
+}
+
+int main() {
+    printf("MULTIQUEUE TEST SUITE\n");
+    printf("=====================\n");
+
+    test_create_multiqueue();
+    test_single_queue_is_exact();
+    test_sequential_relaxed();
+    test_concurrent();
+
+    print_test_summary();
+
+    return (tests_passed == tests_run) ? 0 : 1;
+}
@@ -0,0 +1,212 @@
+#include "topk.h"
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Test counter
+int tests_run = 0;
+int tests_passed = 0;
+
+// Test helper macros
+#define TEST_ASSERT(condition, message) \
+    do { \
+        tests_run++; \
+        if (condition) { \
+            tests_passed++; \
+            printf("SUCCESS - %s\n", message); \
+        } else { \
+            printf("FAILED - %s\n", message); \
+        } \
+    } while(0)
+
+#define TEST_ASSERT_NULL(ptr, message) \
+    TEST_ASSERT((ptr) == NULL, message)
+
+#define TEST_ASSERT_NOT_NULL(ptr, message) \
+    TEST_ASSERT((ptr) != NULL, message)
+
+#define TEST_ASSERT_EQUAL(expected, actual, message) \
+    TEST_ASSERT((expected) == (actual), message)
+
+#define NUM_THREADS 4
+
+// Reference answer: sort a copy descending and take the first k.
+int compare_desc(const void* a, const void* b) {
+    int x = *(const int*)a;
+    int y = *(const int*)b;
+    return (x < y) - (x > y);
+}
+
+int matches_reference(const int* stream, int n, int k, const int* got, int got_count) {
+    int* copy = malloc(n * sizeof(int));
+    memcpy(copy, stream, n * sizeof(int));
+    qsort(copy, n, sizeof(int), compare_desc);
+    int expected_count = (n < k) ? n : k;
+    int ok = (got_count == expected_count);
+    for (int i = 0; ok && i < expected_count; i++) {
+        ok = (copy[i] == got[i]);
+    }
+    free(copy);
+    return ok;
+}
+
+void test_create_topk() {
+    printf("\n=== Testing create_topk ===\n");
+
+    TopK* topk = create_topk(5);
+    TEST_ASSERT_NOT_NULL(topk, "create_topk returns non-NULL");
+    TEST_ASSERT_EQUAL(5, topk->k, "k stored correctly");
+    TEST_ASSERT_NULL(topk_threshold(topk), "No threshold before K values seen");
+    destroy_topk(&topk);
+    TEST_ASSERT_NULL(topk, "destroy_topk sets pointer to NULL");
+
+    TEST_ASSERT_NULL(create_topk(0), "k = 0 is rejected");
+    topk_push(1, NULL);
+    topk_push_batch((int[]){1, 2}, 2, NULL);
+    TEST_ASSERT(1, "Pushing into a NULL TopK is rejected without crashing");
+}
+
+void test_push() {
+    printf("\n=== Testing topk_push ===\n");
+
+    TopK* topk = create_topk(3);
+    int stream[] = {5, 1, 9, 3, 7, 2, 8};
+    int n = sizeof(stream) / sizeof(stream[0]);
+    for (int i = 0; i < n; i++) {
+        topk_push(stream[i], topk);
+    }
+    int out[3];
+    int count = topk_results(topk, out);
+    TEST_ASSERT_EQUAL(3, count, "Keeps exactly K values");
+    TEST_ASSERT(out[0] == 9 && out[1] == 8 && out[2] == 7, "Results are the K largest, descending");
+    TEST_ASSERT_EQUAL(7, *topk_threshold(topk), "Threshold is the smallest kept value");
+
+    // Values at or below the threshold do not change anything.
+    topk_push(7, topk);
+    topk_push(-100, topk);
+    count = topk_results(topk, out);
+    TEST_ASSERT(count == 3 && out[2] == 7, "Values <= threshold are rejected");
+
+    destroy_topk(&topk);
+
+    // Fewer values than K: everything is kept.
+    TopK* small = create_topk(10);
+    topk_push(2, small);
+    topk_push(1, small);
+    count = topk_results(small, out);
+    TEST_ASSERT(count == 2 && out[0] == 2 && out[1] == 1, "Short stream returns all values");
+    destroy_topk(&small);
+}
+
+void test_batch_matches_reference() {
+    printf("\n=== Testing topk_push_batch ===\n");
+
+    int n = 100000;
+    int k = 100;
+    int* stream = malloc(n * sizeof(int));
+    unsigned int seed = 7;
+    for (int i = 0; i < n; i++) {
+        // Include negatives and duplicates.
+        stream[i] = (int)(rand_r(&seed) % 200001) - 100000;
+    }
+    TopK* topk = create_topk(k);
+    // Odd batch sizes exercise the scalar tail.
+    for (int i = 0; i < n; i += 1001) {
+        int len = (n - i < 1001) ? n - i : 1001;
+        topk_push_batch(stream + i, len, topk);
+    }
+    int* out = malloc(k * sizeof(int));
+    int count = topk_results(topk, out);
+    TEST_ASSERT(matches_reference(stream, n, k, out, count), "Batched ingest matches full sort");
+    TEST_ASSERT_EQUAL(2 * k, topk->heap->length, "Heap never grew past its O(K) reservation");
+
+    // Ascending stream: the worst case, every value is admitted.
+    TopK* asc = create_topk(k);
+    for (int i = 0; i < n; i++) {
+        stream[i] = i;
+    }
+    topk_push_batch(stream, n, asc);
+    count = topk_results(asc, out);
+    TEST_ASSERT(count == k && out[0] == n - 1 && out[k - 1] == n - k, "Ascending stream keeps the last K");
+
+    free(out);
+    free(stream);
+    destroy_topk(&topk);
+    destroy_topk(&asc);
+}
+
+typedef struct ThreadArgs {
+    const int* stream;
+    int len;
+    TopK* partial;
+} ThreadArgs;
+
+void* topk_worker(void* arg) {
+    ThreadArgs* args = arg;
+    topk_push_batch(args->stream, args->len, args->partial);
+    return NULL;
+}
+
+void test_merge() {
+    printf("\n=== Testing topk_merge across threads ===\n");
+
+    int n = 200000;
+    int k = 50;
+    int* stream = malloc(n * sizeof(int));
+    unsigned int seed = 99;
+    for (int i = 0; i < n; i++) {
+        stream[i] = rand_r(&seed);
+    }
+    pthread_t threads[NUM_THREADS];
+    ThreadArgs args[NUM_THREADS];
+    int chunk = n / NUM_THREADS;
+    for (int t = 0; t < NUM_THREADS; t++) {
+        args[t].stream = stream + t * chunk;
+        args[t].len = (t == NUM_THREADS - 1) ? n - t * chunk : chunk;
+        args[t].partial = create_topk(k);
+        pthread_create(&threads[t], NULL, topk_worker, &args[t]);
+    }
+    TopK* merged = create_topk(k);
+    for (int t = 0; t < NUM_THREADS; t++) {
+        pthread_join(threads[t], NULL);
+        topk_merge(merged, args[t].partial);
+        destroy_topk(&args[t].partial);
+    }
+    int out[50];
+    int count = topk_results(merged, out);
+    TEST_ASSERT(matches_reference(stream, n, k, out, count), "Merged partial results match full sort");
+
+    free(stream);
+    destroy_topk(&merged);
+}
+
+void print_test_summary() {
+    printf("\n==================================================\n");
+    printf("TEST SUMMARY\n");
+    printf("==================================================\n");
+    printf("Tests run: %d\n", tests_run);
+    printf("Tests passed: %d\n", tests_passed);
+    printf("Tests failed: %d\n", tests_run - tests_passed);
+    printf("Success rate: %.1f%%\n", (float)tests_passed / tests_run * 100);
+
+    if (tests_passed == tests_run) {
+        printf("\nSUCCESS - ALL TESTS PASSED!\n");
+    } else {
+        printf("\nFAILED - Some tests failed. Check the output above for details.\n");
+    }
+}
+
+int main() {
+    printf("TOP-K TEST SUITE\n");
+    printf("================\n");
+
+    test_create_topk();
+    test_push();
+    test_batch_matches_reference();
+    test_merge();
+
+    print_test_summary();
+
+    return (tests_passed == tests_run) ? 0 : 1;
+}
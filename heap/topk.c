@@ -0,0 +1,153 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "topk.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define TOPK_HAVE_X86 1
+#endif
+
+TopK* create_topk(int k) {
+    if (k < 1) {
+        fprintf(stderr, "ERROR - k must be >= 1\n");
+        return NULL;
+    }
+    TopK* topk = malloc(sizeof(TopK));
+    if (topk == NULL) {
+        fprintf(stderr, "ERROR - Could not malloc %lu bytes.\n", sizeof(TopK));
+        return NULL;
+    }
+    topk->k = k;
+    // insert() grows the heap once it is 70% full. Reserving 2k up front means
+    // it never resizes while holding at most k values, so memory is fixed at O(k).
+    topk->heap = create_heap(2 * k);
+    if (topk->heap == NULL) {
+        free(topk);
+        return NULL;
+    }
+    return topk;
+}
+
+void destroy_topk(TopK** topk) {
+    if (topk == NULL || *topk == NULL) {
+        return;
+    }
+    destroy(&(*topk)->heap);
+    free(*topk);
+    *topk = NULL;
+}
+
+void topk_push(int val, TopK* topk) {
+    if (topk == NULL) {
+        fprintf(stderr, "ERROR - Must pass a valid TopK*");
+        return;
+    }
+    Heap* heap = topk->heap;
+    if (heap->count < topk->k) {
+        // Still filling up, everything is admitted.
+        insert(val, heap);
+    }
+    else if (val > heap->array[0]) {
+        // Beats the smallest kept value: evict it.
+        replace_top(val, heap);
+    }
+    // Otherwise rejected with a single compare.
+}
+
+void topk_push_batch_scalar(const int* vals, int n, TopK* topk) {
+    for (int i = 0; i < n; i++) {
+        topk_push(vals[i], topk);
+    }
+}
+
+#ifdef TOPK_HAVE_X86
+__attribute__((target("avx2")))
+void topk_push_batch_avx2(const int* vals, int n, TopK* topk) {
+    Heap* heap = topk->heap;
+    int i = 0;
+    // Fill phase has no threshold yet.
+    while (i < n && heap->count < topk->k) {
+        insert(vals[i++], heap);
+    }
+    __m256i threshold = _mm256_set1_epi32(heap->array[0]);
+    for (; i + 8 <= n; i += 8) {
+        __m256i v = _mm256_loadu_si256((const __m256i*)(vals + i));
+        int mask = _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(v, threshold)));
+        if (mask == 0) {
+            // Common case on long streams: the whole block is rejected.
+            continue;
+        }
+        while (mask) {
+            int lane = __builtin_ctz(mask);
+            mask &= mask - 1;
+            // The threshold may have risen within this block, so re-check.
+            if (vals[i + lane] > heap->array[0]) {
+                replace_top(vals[i + lane], heap);
+            }
+        }
+        threshold = _mm256_set1_epi32(heap->array[0]);
+    }
+    topk_push_batch_scalar(vals + i, n - i, topk);
+}
+#endif
+
+void topk_push_batch(const int* vals, int n, TopK* topk) {
+    if (topk == NULL || (vals == NULL && n > 0)) {
+        fprintf(stderr, "ERROR - Must pass a valid TopK* and values");
+        return;
+    }
+#ifdef TOPK_HAVE_X86
+    if (__builtin_cpu_supports("avx2")) {
+        topk_push_batch_avx2(vals, n, topk);
+        return;
+    }
+#endif
+    topk_push_batch_scalar(vals, n, topk);
+}
+
+void topk_merge(TopK* dst, const TopK* src) {
+    if (dst == NULL || src == NULL) {
+        fprintf(stderr, "ERROR - Must pass valid TopK* for dst and src");
+        return;
+    }
+    topk_push_batch(src->heap->array, src->heap->count, dst);
+}
+
+int* topk_threshold(TopK* topk) {
+    if (topk == NULL || topk->heap->count < topk->k) {
+        return NULL;
+    }
+    return peek(topk->heap);
+}
+
+int topk_results(const TopK* topk, int* out) {
+    if (topk == NULL || out == NULL) {
+        fprintf(stderr, "ERROR - Must pass a valid TopK* and out buffer");
+        return 0;
+    }
+    int count = topk->heap->count;
+    for (int i = 0; i < count; i++) {
+        out[i] = topk->heap->array[i];
+    }
+    // out is a copy of a min-heap; heapsort it in place. Moving the minimum to
+    // the back each round leaves the array in descending order.
+    for (int end = count - 1; end > 0; end--) {
+        int val = out[end];
+        out[end] = out[0];
+        int parent = 0;
+        int child = 1;
+        while (child < end) {
+            if (child + 1 < end && out[child + 1] < out[child]) {
+                child++;
+            }
+            if (out[child] >= val) {
+                break;
+            }
+            out[parent] = out[child];
+            parent = child;
+            child = 2 * parent + 1;
+        }
+        out[parent] = val;
+    }
+    return count;
+}
@@ -0,0 +1,70 @@
+#ifndef TOPK_H
+#define TOPK_H
+
+#include "heap.h"
+
+/**
+ * Bounded top-K selector over a stream of ints.
+ * Keeps the K largest values seen so far in a size-K min-heap. The root is the
+ * smallest of those, so any incoming value <= root is rejected with one compare.
+ * Memory stays O(K) however long the stream is.
+ */
+typedef struct TopK {
+    int k;      // How many values to keep
+    Heap* heap; // Min-heap of the current top K, root = admission threshold
+} TopK;
+
+/**
+ * Creates an empty top-K selector
+ * @param k: Number of largest values to keep (must be >= 1)
+ * @return: Pointer to new selector, or NULL on bad k / allocation failure
+ */
+TopK* create_topk(int k);
+
+/**
+ * Frees the selector and its heap
+ * @param topk: Pointer to selector pointer (set to NULL)
+ */
+void destroy_topk(TopK** topk);
+
+/**
+ * Offers one stream value
+ * @param val: Value from the stream
+ * @param topk: Target selector
+ */
+void topk_push(int val, TopK* topk);
+
+/**
+ * Offers a batch of stream values. Uses AVX2 (when the CPU has it) to compare
+ * 8 values at a time against the current threshold and only touches the heap
+ * for the few that beat it.
+ * @param vals: Batch of values
+ * @param n: Number of values in the batch
+ * @param topk: Target selector
+ */
+void topk_push_batch(const int* vals, int n, TopK* topk);
+
+/**
+ * Folds another selector's results into dst (e.g. per-thread partial results).
+ * Not thread-safe: merge after the worker threads have been joined.
+ * @param dst: Selector receiving the values
+ * @param src: Selector to read from (unchanged)
+ */
+void topk_merge(TopK* dst, const TopK* src);
+
+/**
+ * Current admission threshold
+ * @param topk: Target selector
+ * @return: Pointer to the smallest kept value, or NULL while fewer than K were seen
+ */
+int* topk_threshold(TopK* topk);
+
+/**
+ * Copies the kept values out in descending order
+ * @param topk: Target selector (unchanged)
+ * @param out: Buffer with room for at least K ints
+ * @return: Number of values written (min(K, values seen))
+ */
+int topk_results(const TopK* topk, int* out);
+
+#endif
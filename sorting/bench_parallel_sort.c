@@ -0,0 +1,68 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "sorting.h"
+#include "parallel_sort.h"
+
+// Speedup of the parallel sorts over sequential introsort (quick_sort),
+// for 1 to max_threads threads on random keys.
+
+double now_seconds() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+int check_sorted(int* array, int count) {
+    for (int i = 1; i < count; i++) {
+        if (array[i-1] > array[i]) return 0;
+    }
+    return 1;
+}
+
+double time_sort(void (*fn)(int*, int, int), int* input, int* work, int count, int nthreads) {
+    memcpy(work, input, count * sizeof(int));
+    double start = now_seconds();
+    fn(work, count, nthreads);
+    double elapsed = now_seconds() - start;
+    if (!check_sorted(work, count)) {
+        printf("WRONG result\n");
+    }
+    return elapsed;
+}
+
+int main(int argc, char** argv) {
+    // Usage: ./bench_parallel_sort [count] [max_threads]
+    int count = (argc > 1) ? atoi(argv[1]) : 100000000;
+    int max_threads = (argc > 2) ? atoi(argv[2]) : 64;
+    int* input = malloc(count * sizeof(int));
+    int* work = malloc(count * sizeof(int));
+    if (input == NULL || work == NULL) {
+        fprintf(stderr, "Failed to allocate %d ints\n", count);
+        return 1;
+    }
+    unsigned int seed = 2024;
+    for (int i = 0; i < count; i++) input[i] = rand_r(&seed);
+
+    memcpy(work, input, count * sizeof(int));
+    double start = now_seconds();
+    quick_sort(work, count);
+    double sequential = now_seconds() - start;
+    printf("n = %d, sequential quick_sort: %.1f ms\n", count, sequential * 1000);
+    printf("%8s %14s %9s %14s %9s %14s %9s\n", "threads",
+           "merge ms", "speedup", "sample ms", "speedup", "auto ms", "speedup");
+
+    for (int nthreads = 1; nthreads <= max_threads; nthreads *= 2) {
+        double merge = time_sort(parallel_merge_sort, input, work, count, nthreads);
+        double sample = time_sort(parallel_sample_sort, input, work, count, nthreads);
+        double automatic = time_sort(parallel_sort, input, work, count, nthreads);
+        printf("%8d %14.1f %9.2f %14.1f %9.2f %14.1f %9.2f\n", nthreads,
+               merge * 1000, sequential / merge,
+               sample * 1000, sequential / sample,
+               automatic * 1000, sequential / automatic);
+    }
+    free(input);
+    free(work);
+    return 0;
+}
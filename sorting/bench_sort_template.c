@@ -0,0 +1,131 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "sort_template.h"
+
+// Typed template sorts against libc qsort on 16- and 32-byte records.
+// qsort calls the comparator through a pointer and moves elements with a
+// size-generic swap; the template sorts inline both.
+
+typedef struct Record16 {
+    int key;
+    int id;
+    long long payload;
+} Record16;
+
+typedef struct Record32 {
+    long long key;
+    long long payload[3];
+} Record32;
+
+#define R16_LESS(a, b) ((a)->key < (b)->key)
+#define R16_KEY(r) ((r)->key)
+#define R32_LESS(a, b) ((a)->key < (b)->key)
+#define R32_KEY(r) ((r)->key)
+
+SORT_DEFINE(r16, Record16, R16_LESS)
+SORT_DEFINE_RADIX(r16_by_key, Record16, int, R16_KEY)
+SORT_DEFINE(r32, Record32, R32_LESS)
+SORT_DEFINE_RADIX(r32_by_key, Record32, long long, R32_KEY)
+
+int compare_r16(const void* a, const void* b) {
+    int x = ((const Record16*)a)->key;
+    int y = ((const Record16*)b)->key;
+    return (x > y) - (x < y);
+}
+
+int compare_r32(const void* a, const void* b) {
+    long long x = ((const Record32*)a)->key;
+    long long y = ((const Record32*)b)->key;
+    return (x > y) - (x < y);
+}
+
+void qsort_r16(Record16* array, int count) {
+    qsort(array, count, sizeof(Record16), compare_r16);
+}
+
+void qsort_r32(Record32* array, int count) {
+    qsort(array, count, sizeof(Record32), compare_r32);
+}
+
+double now_seconds() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+void bench_r16(int count) {
+    const char* names[] = {"qsort", "r16_quick_sort", "r16_merge_sort", "r16_by_key_radix_sort"};
+    void (*fns[])(Record16*, int) = {qsort_r16, r16_quick_sort, r16_merge_sort, r16_by_key_radix_sort};
+    int num_fns = sizeof(fns) / sizeof(fns[0]);
+    Record16* input = malloc(count * sizeof(Record16));
+    Record16* work = malloc(count * sizeof(Record16));
+    srand(1);
+    for (int i = 0; i < count; i++) {
+        input[i].key = rand() - RAND_MAX / 2;
+        input[i].id = i;
+        input[i].payload = i;
+    }
+    printf("\n16-byte records, n = %d\n", count);
+    printf("%-24s%12s%12s%12s\n", "sort", "ms", "ns/elem", "vs qsort");
+    double base = 0;
+    for (int f = 0; f < num_fns; f++) {
+        memcpy(work, input, count * sizeof(Record16));
+        double start = now_seconds();
+        fns[f](work, count);
+        double elapsed = now_seconds() - start;
+        for (int i = 1; i < count; i++) {
+            if (work[i].key < work[i-1].key) {
+                printf("  WRONG result from %s\n", names[f]);
+                break;
+            }
+        }
+        if (f == 0) base = elapsed;
+        printf("%-24s%12.2f%12.2f%11.2fx\n", names[f], elapsed * 1000, elapsed / count * 1e9, base / elapsed);
+    }
+    free(input);
+    free(work);
+}
+
+void bench_r32(int count) {
+    const char* names[] = {"qsort", "r32_quick_sort", "r32_merge_sort", "r32_by_key_radix_sort"};
+    void (*fns[])(Record32*, int) = {qsort_r32, r32_quick_sort, r32_merge_sort, r32_by_key_radix_sort};
+    int num_fns = sizeof(fns) / sizeof(fns[0]);
+    Record32* input = malloc(count * sizeof(Record32));
+    Record32* work = malloc(count * sizeof(Record32));
+    srand(2);
+    for (int i = 0; i < count; i++) {
+        input[i].key = ((long long)rand() << 31) ^ rand();
+        input[i].payload[0] = i;
+        input[i].payload[1] = -i;
+        input[i].payload[2] = 0;
+    }
+    printf("\n32-byte records, n = %d\n", count);
+    printf("%-24s%12s%12s%12s\n", "sort", "ms", "ns/elem", "vs qsort");
+    double base = 0;
+    for (int f = 0; f < num_fns; f++) {
+        memcpy(work, input, count * sizeof(Record32));
+        double start = now_seconds();
+        fns[f](work, count);
+        double elapsed = now_seconds() - start;
+        for (int i = 1; i < count; i++) {
+            if (work[i].key < work[i-1].key) {
+                printf("  WRONG result from %s\n", names[f]);
+                break;
+            }
+        }
+        if (f == 0) base = elapsed;
+        printf("%-24s%12.2f%12.2f%11.2fx\n", names[f], elapsed * 1000, elapsed / count * 1e9, base / elapsed);
+    }
+    free(input);
+    free(work);
+}
+
+int main(int argc, char** argv) {
+    // Usage: ./bench_sort_template [count]
+    int count = (argc > 1) ? atoi(argv[1]) : 1000000;
+    bench_r16(count);
+    bench_r32(count);
+    return 0;
+}
@@ -0,0 +1,670 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "sorting.h"
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+// Benchmark driver for the sorts in sorting.h.
+// Runs every registered sort over every input distribution and prints milliseconds.
+// With --csv it instead sweeps sizes from 10 up to a maximum and writes one CSV
+// row per (sort, distribution, size) with time, comparison and move counts, and
+// hardware counters.
+
+// Comparison and move counting. Build bench_sorting.c and sorting.c with
+// -DSORT_COUNT to count inside the timed sorts themselves (and qsort's
+// comparator); without it those CSV columns are empty. The counting slows the
+// sorts down, so take times from a build without it.
+
+// Allocator call counting. Build with -DCOUNT_ALLOCS -Wl,--wrap=malloc to enable;
+// without it the malloc column reads n/a.
+long long malloc_calls = 0;
+#ifdef COUNT_ALLOCS
+void* __real_malloc(size_t size);
+void* __wrap_malloc(size_t size) {
+    malloc_calls++;
+    return __real_malloc(size);
+}
+#endif
+
+typedef struct SortEntry {
+    const char* name;
+    void (*sort)(int* array, int count);
+    int max_count;    // Skip inputs bigger than this (0 = no limit), for the O(n^2) sorts
+    int moves_hidden; // Moves happen inside libc and are not counted
+} SortEntry;
+
+typedef struct Distribution {
+    const char* name;
+    void (*fill)(int* array, int count, unsigned int* seed);
+} Distribution;
+
+int compare_ints(const void* a, const void* b) {
+#ifdef SORT_COUNT
+    sort_comparisons++;
+#endif
+    int x = *(const int*)a;
+    int y = *(const int*)b;
+    return (x > y) - (x < y);
+}
+
+void libc_qsort(int* array, int count) {
+    qsort(array, count, sizeof(int), compare_ints);
+}
+
+void fill_random(int* array, int count, unsigned int* seed) {
+    for (int i = 0; i < count; i++) array[i] = rand_r(seed);
+}
+
+void fill_sorted(int* array, int count, unsigned int* seed) {
+    (void)seed;
+    for (int i = 0; i < count; i++) array[i] = i;
+}
+
+void fill_reverse(int* array, int count, unsigned int* seed) {
+    (void)seed;
+    for (int i = 0; i < count; i++) array[i] = count - i;
+}
+
+void fill_organ_pipe(int* array, int count, unsigned int* seed) {
+    // 0, 1, ..., n/2, ..., 1, 0
+    (void)seed;
+    for (int i = 0; i < count; i++) array[i] = (i < count / 2) ? i : count - i;
+}
+
+void fill_all_equal(int* array, int count, unsigned int* seed) {
+    (void)seed;
+    for (int i = 0; i < count; i++) array[i] = 42;
+}
+
+void fill_few_unique(int* array, int count, unsigned int* seed) {
+    // 16 distinct keys, like status codes or enum fields.
+    for (int i = 0; i < count; i++) array[i] = rand_r(seed) % 16;
+}
+
+void fill_zipf(int* array, int count, unsigned int* seed) {
+    // Zipf (s = 1) over up to 2^20 distinct keys: key k has weight 1/k, so a
+    // few keys dominate and there is a long tail, as in real IDs and words.
+    int num_keys = (count < (1 << 20)) ? count : (1 << 20);
+    if (num_keys < 1) return;
+    double* cdf = malloc(num_keys * sizeof(double));
+    if (cdf == NULL) {
+        fill_random(array, count, seed);
+        return;
+    }
+    double total = 0;
+    for (int k = 0; k < num_keys; k++) {
+        total += 1.0 / (k + 1);
+        cdf[k] = total;
+    }
+    for (int i = 0; i < count; i++) {
+        double u = (rand_r(seed) / (RAND_MAX + 1.0)) * total;
+        int lo = 0;
+        int hi = num_keys - 1;
+        while (lo < hi) {
+            int mid = lo + (hi - lo) / 2;
+            if (cdf[mid] < u) lo = mid + 1;
+            else hi = mid;
+        }
+        array[i] = lo;
+    }
+    free(cdf);
+}
+
+void fill_sawtooth(int* array, int count, unsigned int* seed) {
+    // 16 ascending teeth: 0..p-1, 0..p-1, ...
+    (void)seed;
+    int period = count / 16 + 1;
+    for (int i = 0; i < count; i++) array[i] = i % period;
+}
+
+// The top-down merge sort that sorting.c used to ship: one malloc/free per merge step.
+// Kept here only as the baseline for the allocator comparison.
+void legacy_merge(int* array, int st, int mid, int ed) {
+    int* extra_space = malloc((ed-st+1) * sizeof(int));
+    int ptr1 = st;
+    int ptr2 = mid+1;
+    int extra_idx = 0;
+    while (ptr1 <= mid && ptr2 <= ed) {
+        extra_space[extra_idx++] = (array[ptr1] <= array[ptr2]) ? array[ptr1++] : array[ptr2++];
+    }
+    while (ptr1 <= mid) extra_space[extra_idx++] = array[ptr1++];
+    while (ptr2 <= ed) extra_space[extra_idx++] = array[ptr2++];
+    memcpy(array + st, extra_space, (ed-st+1) * sizeof(int));
+    free(extra_space);
+}
+
+void legacy_merge_sort_step(int* array, int st, int ed) {
+    if (st >= ed) {
+        return;
+    }
+    int mid = (st+ed)/2;
+    legacy_merge_sort_step(array, st, mid);
+    legacy_merge_sort_step(array, mid+1, ed);
+    legacy_merge(array, st, mid, ed);
+}
+
+void legacy_merge_sort(int* array, int count) {
+    legacy_merge_sort_step(array, 0, count-1);
+}
+
+SortEntry sorts[] = {
+    {.name = "quick_sort", .sort = quick_sort},
+    {.name = "merge_sort", .sort = merge_sort},
+    {.name = "power_sort", .sort = power_sort},
+    {.name = "heap_sort", .sort = heap_sort},
+    {.name = "radix_sort", .sort = radix_sort},
+    {.name = "radix_sort_inplace", .sort = radix_sort_inplace},
+    {.name = "qsort", .sort = libc_qsort, .moves_hidden = 1},
+    {.name = "insertion_sort", .sort = insertion_sort, .max_count = 50000},
+    {.name = "selection_sort", .sort = selection_sort, .max_count = 20000},
+    {.name = "bubble_sort", .sort = bubble_sort, .max_count = 20000},
+};
+
+Distribution distributions[] = {
+    {"random", fill_random},
+    {"sorted", fill_sorted},
+    {"reverse", fill_reverse},
+    {"organ_pipe", fill_organ_pipe},
+    {"all_equal", fill_all_equal},
+    {"few_unique", fill_few_unique},
+    {"zipf", fill_zipf},
+    {"sawtooth", fill_sawtooth},
+};
+
+double now_seconds() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+int check_sorted(int* array, int count) {
+    for (int i = 1; i < count; i++) {
+        if (array[i-1] > array[i]) return 0;
+    }
+    return 1;
+}
+
+void bench_merge_allocs(int count) {
+    // Random input, sorted by the old per-merge-malloc sort and the new buffer-based ones.
+    int* input = malloc(count * sizeof(int));
+    int* work = malloc(count * sizeof(int));
+    int* buffer = malloc(count * sizeof(int));
+    unsigned int seed = 12345;
+    fill_random(input, count, &seed);
+
+    printf("\nmerge sort allocations, n = %d\n", count);
+    printf("%-24s%12s%16s\n", "variant", "ms", "malloc calls");
+    for (int v = 0; v < 3; v++) {
+        const char* names[] = {"legacy top-down", "merge_sort", "merge_sort_with_buffer"};
+        memcpy(work, input, count * sizeof(int));
+        malloc_calls = 0;
+        double start = now_seconds();
+        if (v == 0) legacy_merge_sort(work, count);
+        else if (v == 1) merge_sort(work, count);
+        else merge_sort_with_buffer(work, count, buffer);
+        double elapsed = now_seconds() - start;
+        long long calls = malloc_calls;
+        printf("%-24s%12.2f", names[v], elapsed * 1000);
+#ifdef COUNT_ALLOCS
+        printf("%16lld\n", calls);
+#else
+        (void)calls;
+        printf("%16s\n", "n/a");
+#endif
+        if (!check_sorted(work, count)) {
+            printf("  WRONG result\n");
+        }
+    }
+    free(input);
+    free(work);
+    free(buffer);
+}
+
+void bench_size_sweep(int max_count) {
+    // Random keys from 10^3 up to max_count, in ns per element, to find where
+    // radix sort overtakes the comparison sorts.
+    const char* names[] = {"quick_sort", "merge_sort", "radix_sort", "radix_sort_inplace", "qsort"};
+    void (*fns[])(int*, int) = {quick_sort, merge_sort, radix_sort, radix_sort_inplace, libc_qsort};
+    int num_fns = sizeof(fns) / sizeof(fns[0]);
+    int* input = malloc(max_count * sizeof(int));
+    int* work = malloc(max_count * sizeof(int));
+    unsigned int seed = 777;
+    fill_random(input, max_count, &seed);
+
+    printf("\nsize sweep, random keys, ns per element\n");
+    printf("%-12s", "n");
+    for (int f = 0; f < num_fns; f++) {
+        printf("%20s", names[f]);
+    }
+    printf("\n");
+    for (long long count = 1000; count <= max_count; count *= 10) {
+        printf("%-12lld", count);
+        for (int f = 0; f < num_fns; f++) {
+            // Repeat small sizes so the timer resolution does not dominate.
+            int reps = (int)(10000000 / count);
+            if (reps < 1) reps = 1;
+            double total = 0;
+            for (int r = 0; r < reps; r++) {
+                memcpy(work, input, count * sizeof(int));
+                double start = now_seconds();
+                fns[f](work, count);
+                total += now_seconds() - start;
+            }
+            printf("%20.2f", total / reps / count * 1e9);
+        }
+        printf("\n");
+    }
+    free(input);
+    free(work);
+}
+
+void bench_small_batches() {
+    // Lots of independent small arrays, like per-request batches. Rebuild with
+    // -DSORTING_NO_SIMD to get the scalar quick_sort numbers for comparison.
+    const char* names[] = {"quick_sort", "network_sort", "insertion_sort", "qsort"};
+    void (*fns[])(int*, int) = {quick_sort, network_sort, insertion_sort, libc_qsort};
+    int num_fns = sizeof(fns) / sizeof(fns[0]);
+    int total = 1 << 22;
+    int* input = malloc(total * sizeof(int));
+    int* work = malloc(total * sizeof(int));
+    unsigned int seed = 31337;
+    fill_random(input, total, &seed);
+
+    printf("\nsmall batches, %d elements per size, ns per element\n", total);
+    printf("%-12s", "batch size");
+    for (int f = 0; f < num_fns; f++) {
+        printf("%16s", names[f]);
+    }
+    printf("\n");
+    for (int batch = 8; batch <= 256; batch *= 2) {
+        printf("%-12d", batch);
+        for (int f = 0; f < num_fns; f++) {
+            if (fns[f] == network_sort && batch > 64) {
+                printf("%16s", "n/a");
+                continue;
+            }
+            memcpy(work, input, total * sizeof(int));
+            double start = now_seconds();
+            for (int st = 0; st < total; st += batch) {
+                fns[f](work + st, batch);
+            }
+            double elapsed = now_seconds() - start;
+            printf("%16.2f", elapsed / total * 1e9);
+        }
+        printf("\n");
+    }
+    free(input);
+    free(work);
+}
+
+void fill_disordered(int* array, int count, int percent, unsigned int* seed) {
+    // Sorted input where `percent` % of the positions took part in a random swap.
+    for (int i = 0; i < count; i++) array[i] = i;
+    long long swaps = (long long)count * percent / 200;
+    for (long long s = 0; s < swaps; s++) {
+        int a = rand_r(seed) % count;
+        int b = rand_r(seed) % count;
+        int tmp = array[a];
+        array[a] = array[b];
+        array[b] = tmp;
+    }
+}
+
+void fill_runs(int* array, int count, int num_runs, unsigned int* seed) {
+    // num_runs sorted runs of random lengths, alternately ascending and descending.
+    int max_len = (2 * count / num_runs > 0) ? 2 * count / num_runs : 1;
+    int st = 0;
+    for (int r = 0; r < num_runs && st < count; r++) {
+        int len = (r == num_runs - 1) ? count - st : 1 + rand_r(seed) % max_len;
+        if (st + len > count) len = count - st;
+        int base = rand_r(seed) % count;
+        for (int i = 0; i < len; i++) {
+            array[st + i] = (r % 2 == 0) ? base + i : base - i;
+        }
+        st += len;
+    }
+}
+
+void fill_sorted_tail(int* array, int count, int tail, unsigned int* seed) {
+    // Sorted input with `tail` random values appended, like a log with a fresh batch.
+    for (int i = 0; i < count; i++) {
+        array[i] = (i < count - tail) ? i : rand_r(seed) % count;
+    }
+}
+
+void bench_disorder(int count) {
+    // Inputs with a controlled amount of presortedness: the adaptive sort
+    // should approach O(n) as the disorder goes to zero.
+    const char* names[] = {"power_sort", "merge_sort", "quick_sort", "qsort"};
+    void (*fns[])(int*, int) = {power_sort, merge_sort, quick_sort, libc_qsort};
+    int num_fns = sizeof(fns) / sizeof(fns[0]);
+    int* input = malloc(count * sizeof(int));
+    int* work = malloc(count * sizeof(int));
+
+    printf("\ncontrolled disorder, n = %d, time in ms\n", count);
+    printf("%-20s", "input");
+    for (int f = 0; f < num_fns; f++) {
+        printf("%14s", names[f]);
+    }
+    printf("\n");
+    for (int c = 0; c < 12; c++) {
+        char label[32];
+        unsigned int seed = 4242;
+        if (c < 5) {
+            int percents[] = {0, 1, 5, 20, 100};
+            fill_disordered(input, count, percents[c], &seed);
+            snprintf(label, sizeof(label), "swapped %d%%", percents[c]);
+        }
+        else if (c < 9) {
+            int runs[] = {2, 16, 256, 4096};
+            fill_runs(input, count, runs[c - 5], &seed);
+            snprintf(label, sizeof(label), "%d runs", runs[c - 5]);
+        }
+        else {
+            int tails[] = {10, 1000, 100000};
+            int tail = (tails[c - 9] < count) ? tails[c - 9] : count;
+            fill_sorted_tail(input, count, tail, &seed);
+            snprintf(label, sizeof(label), "sorted + %d tail", tail);
+        }
+        printf("%-20s", label);
+        for (int f = 0; f < num_fns; f++) {
+            memcpy(work, input, count * sizeof(int));
+            double start = now_seconds();
+            fns[f](work, count);
+            double elapsed = now_seconds() - start;
+            if (!check_sorted(work, count)) {
+                printf("%14s", "WRONG");
+                continue;
+            }
+            printf("%14.2f", elapsed * 1000);
+        }
+        printf("\n");
+    }
+    free(input);
+    free(work);
+}
+
+void bench_percentiles(int count) {
+    // p50, p90, p99 and p99.9 of random keys: full sorts against selection.
+    int ranks[] = {count / 2, (int)(count * 0.9), (int)(count * 0.99), (int)(count * 0.999)};
+    int num_ranks = sizeof(ranks) / sizeof(ranks[0]);
+    int* input = malloc(count * sizeof(int));
+    int* work = malloc(count * sizeof(int));
+    if (input == NULL || work == NULL) {
+        printf("\npercentiles: could not allocate %d elements, skipped\n", count);
+        free(input);
+        free(work);
+        return;
+    }
+    unsigned int seed = 99;
+    fill_random(input, count, &seed);
+    int expected[4];
+
+    printf("\npercentile extraction (p50, p90, p99, p99.9), n = %d\n", count);
+    printf("%-28s%12s%12s\n", "method", "ms", "vs sort");
+    const char* names[] = {"quick_sort + index", "radix_sort + index", "nth_element (p50 only)", "nth_element x4", "multi_select"};
+    double base = 0;
+    for (int m = 0; m < 5; m++) {
+        memcpy(work, input, count * sizeof(int));
+        int got[4];
+        double start = now_seconds();
+        if (m == 0 || m == 1) {
+            if (m == 0) quick_sort(work, count);
+            else radix_sort(work, count);
+            for (int r = 0; r < num_ranks; r++) got[r] = work[ranks[r]];
+        }
+        else if (m == 2) {
+            nth_element(work, count, ranks[0]);
+            got[0] = work[ranks[0]];
+        }
+        else if (m == 3) {
+            // Each call re-partitions from scratch (after the first it is on
+            // partially ordered data, but still a full pass per rank).
+            for (int r = 0; r < num_ranks; r++) {
+                nth_element(work, count, ranks[r]);
+                got[r] = work[ranks[r]];
+            }
+        }
+        else {
+            multi_select(work, count, ranks, num_ranks);
+            for (int r = 0; r < num_ranks; r++) got[r] = work[ranks[r]];
+        }
+        double elapsed = now_seconds() - start;
+        if (m == 0) {
+            base = elapsed;
+            memcpy(expected, got, sizeof(got));
+        }
+        int ok = 1;
+        for (int r = 0; r < ((m == 2) ? 1 : num_ranks); r++) {
+            ok &= (got[r] == expected[r]);
+        }
+        printf("%-28s%12.2f%11.2fx%s\n", names[m], elapsed * 1000, base / elapsed, ok ? "" : "  WRONG");
+    }
+    free(input);
+    free(work);
+}
+
+// === HARDWARE COUNTERS ===
+// perf_event_open counters for the calling thread, user space only. Any counter
+// the kernel or CPU refuses (containers, VMs, perf_event_paranoid) reads as -1
+// and its CSV field is left empty.
+
+#define NUM_PERF_COUNTERS 3
+
+typedef struct PerfCounters {
+    int fds[NUM_PERF_COUNTERS]; // cycles, branch-misses, LLC read misses
+} PerfCounters;
+
+void perf_open(PerfCounters* perf) {
+    for (int c = 0; c < NUM_PERF_COUNTERS; c++) {
+        perf->fds[c] = -1;
+    }
+#ifdef __linux__
+    unsigned int types[] = {PERF_TYPE_HARDWARE, PERF_TYPE_HARDWARE, PERF_TYPE_HW_CACHE};
+    unsigned long long configs[] = {
+        PERF_COUNT_HW_CPU_CYCLES,
+        PERF_COUNT_HW_BRANCH_MISSES,
+        PERF_COUNT_HW_CACHE_LL | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16),
+    };
+    for (int c = 0; c < NUM_PERF_COUNTERS; c++) {
+        struct perf_event_attr attr;
+        memset(&attr, 0, sizeof(attr));
+        attr.size = sizeof(attr);
+        attr.type = types[c];
+        attr.config = configs[c];
+        attr.disabled = 1;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        perf->fds[c] = (int)syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+    }
+#endif
+}
+
+void perf_close(PerfCounters* perf) {
+#ifdef __linux__
+    for (int c = 0; c < NUM_PERF_COUNTERS; c++) {
+        if (perf->fds[c] >= 0) close(perf->fds[c]);
+    }
+#endif
+}
+
+void perf_start(PerfCounters* perf) {
+#ifdef __linux__
+    for (int c = 0; c < NUM_PERF_COUNTERS; c++) {
+        if (perf->fds[c] >= 0) {
+            ioctl(perf->fds[c], PERF_EVENT_IOC_RESET, 0);
+            ioctl(perf->fds[c], PERF_EVENT_IOC_ENABLE, 0);
+        }
+    }
+#else
+    (void)perf;
+#endif
+}
+
+void perf_stop(PerfCounters* perf, long long* values) {
+    for (int c = 0; c < NUM_PERF_COUNTERS; c++) {
+        values[c] = -1;
+#ifdef __linux__
+        if (perf->fds[c] >= 0) {
+            ioctl(perf->fds[c], PERF_EVENT_IOC_DISABLE, 0);
+            long long value;
+            if (read(perf->fds[c], &value, sizeof(value)) == sizeof(value)) {
+                values[c] = value;
+            }
+        }
+#else
+        (void)perf;
+#endif
+    }
+}
+
+void print_csv_count(long long value, int reps) {
+    // Per-sort average, or an empty field when not measured.
+    if (value < 0) printf(",");
+    else printf(",%.1f", (double)value / reps);
+}
+
+// The CSV harness repeats a sort until about this much time is measured.
+#define CSV_TARGET_SECONDS 0.05
+
+void run_csv(long long max_count) {
+    // Sizes 10, 100, ... up to max_count. Small inputs sort many copies in one
+    // timed window (up to 2^20 elements in total) so the timer and counter
+    // syscalls stay out of the measurement; every number is per sort call.
+    int num_sorts = sizeof(sorts) / sizeof(sorts[0]);
+    int num_dists = sizeof(distributions) / sizeof(distributions[0]);
+    PerfCounters perf;
+    perf_open(&perf);
+    printf("sort,distribution,n,reps,time_ns,ns_per_element,comparisons,moves,cycles,branch_misses,llc_misses,correct\n");
+    for (long long count = 10; count <= max_count; count *= 10) {
+        int max_reps = (count < (1 << 20)) ? (int)((1 << 20) / count) : 1;
+        int* input = malloc(count * sizeof(int));
+        int* work = malloc(count * max_reps * sizeof(int));
+        if (input == NULL || work == NULL) {
+            fprintf(stderr, "ERROR - Could not allocate %lld elements, stopping\n", count * (max_reps + 1));
+            free(input);
+            free(work);
+            break;
+        }
+        for (int d = 0; d < num_dists; d++) {
+            unsigned int seed = 12345;
+            distributions[d].fill(input, count, &seed);
+            for (int s = 0; s < num_sorts; s++) {
+                if (sorts[s].max_count != 0 && count > sorts[s].max_count) {
+                    continue;
+                }
+                // One calibration run (which also warms the caches) sets the
+                // repetitions, so O(n^2) sorts are not repeated needlessly.
+                memcpy(work, input, count * sizeof(int));
+                double start = now_seconds();
+                sorts[s].sort(work, count);
+                double single = now_seconds() - start;
+                int reps = max_reps;
+                if (single * reps > CSV_TARGET_SECONDS) {
+                    reps = (int)(CSV_TARGET_SECONDS / single);
+                    if (reps < 1) reps = 1;
+                }
+                for (int r = 0; r < reps; r++) {
+                    memcpy(work + r * count, input, count * sizeof(int));
+                }
+                long long counters[NUM_PERF_COUNTERS];
+#ifdef SORT_COUNT
+                sort_comparisons = 0;
+                sort_moves = 0;
+#endif
+                perf_start(&perf);
+                start = now_seconds();
+                for (int r = 0; r < reps; r++) {
+                    sorts[s].sort(work + r * count, count);
+                }
+                double elapsed = now_seconds() - start;
+                perf_stop(&perf, counters);
+                int correct = 1;
+                for (int r = 0; r < reps && correct; r++) {
+                    correct = check_sorted(work + r * count, count);
+                }
+
+                long long comparisons = -1;
+                long long moves = -1;
+#ifdef SORT_COUNT
+                comparisons = sort_comparisons;
+                moves = sorts[s].moves_hidden ? -1 : sort_moves;
+#endif
+                printf("%s,%s,%lld,%d,%.1f,%.3f", sorts[s].name, distributions[d].name, count, reps,
+                       elapsed / reps * 1e9, elapsed / reps / count * 1e9);
+                print_csv_count(comparisons, reps);
+                print_csv_count(moves, reps);
+                for (int c = 0; c < NUM_PERF_COUNTERS; c++) {
+                    print_csv_count(counters[c], reps);
+                }
+                printf(",%d\n", correct);
+                fflush(stdout);
+            }
+        }
+        free(input);
+        free(work);
+    }
+    perf_close(&perf);
+}
+
+int main(int argc, char** argv) {
+    // Usage: ./bench_sorting [count] [sweep_max] [percentile_count]
+    //        ./bench_sorting --csv [max_count]   (sizes 10 .. max_count, default 10^7)
+    if (argc > 1 && strcmp(argv[1], "--csv") == 0) {
+        run_csv((argc > 2) ? atoll(argv[2]) : 10000000);
+        return 0;
+    }
+    int count = (argc > 1) ? atoi(argv[1]) : 1000000;
+    int sweep_max = (argc > 2) ? atoi(argv[2]) : 10000000;
+    int percentile_count = (argc > 3) ? atoi(argv[3]) : 100000000;
+    int num_sorts = sizeof(sorts) / sizeof(sorts[0]);
+    int num_dists = sizeof(distributions) / sizeof(distributions[0]);
+    int* input = malloc(count * sizeof(int));
+    int* work = malloc(count * sizeof(int));
+
+    printf("n = %d, time in ms\n", count);
+    printf("%-20s", "sort");
+    for (int d = 0; d < num_dists; d++) {
+        printf("%12s", distributions[d].name);
+    }
+    printf("\n");
+
+    for (int s = 0; s < num_sorts; s++) {
+        printf("%-20s", sorts[s].name);
+        for (int d = 0; d < num_dists; d++) {
+            if (sorts[s].max_count != 0 && count > sorts[s].max_count) {
+                printf("%12s", "skipped");
+                continue;
+            }
+            unsigned int seed = 12345;
+            distributions[d].fill(input, count, &seed);
+            memcpy(work, input, count * sizeof(int));
+            double start = now_seconds();
+            sorts[s].sort(work, count);
+            double elapsed = now_seconds() - start;
+            if (!check_sorted(work, count)) {
+                printf("%12s", "WRONG");
+                continue;
+            }
+            printf("%12.2f", elapsed * 1000);
+        }
+        printf("\n");
+    }
+
+    free(input);
+    free(work);
+
+    bench_merge_allocs(count);
+    bench_disorder(count);
+    bench_size_sweep(sweep_max);
+    bench_small_batches();
+    bench_percentiles(percentile_count);
+    return 0;
+}
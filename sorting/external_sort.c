@@ -0,0 +1,369 @@
+#define _POSIX_C_SOURCE 200809L
+#include <fcntl.h>
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "sorting.h"
+#include "external_sort.h"
+
+#define EXT_DEFAULT_BUDGET ((size_t)256 << 20)
+// Every run reader and the writer get at least this much buffer during a merge,
+// so reads stay large and sequential even at high fan-in.
+#define EXT_MIN_BUFFER ((size_t)64 << 10)
+// Below this budget the merge could not even hold two readers and a writer.
+#define EXT_MIN_BUDGET (3 * EXT_MIN_BUFFER)
+
+typedef struct ExtRunList {
+    char** paths;
+    int count;
+    int capacity;
+} ExtRunList;
+
+typedef struct ExtReader {
+    FILE* file;
+    int* buf;
+    size_t capacity; // In ints
+    size_t len;
+    size_t pos;
+    int done;
+} ExtReader;
+
+FILE* ext_open(const char* path, const char* mode) {
+    FILE* file = fopen(path, mode);
+    if (file == NULL) {
+        fprintf(stderr, "ERROR - Could not open %s\n", path);
+        return NULL;
+    }
+    // All buffering is done here with large blocks; stdio would only add a copy.
+    setvbuf(file, NULL, _IONBF, 0);
+    if (mode[0] == 'r') {
+        posix_fadvise(fileno(file), 0, 0, POSIX_FADV_SEQUENTIAL);
+    }
+    return file;
+}
+
+int ext_write_all(FILE* file, const int* array, size_t count) {
+    if (fwrite(array, sizeof(int), count, file) != count) {
+        fprintf(stderr, "ERROR - Write failed\n");
+        return -1;
+    }
+    return 0;
+}
+
+int ext_close(FILE* file) {
+    if (fclose(file) != 0) {
+        fprintf(stderr, "ERROR - Could not flush output\n");
+        return -1;
+    }
+    return 0;
+}
+
+int ext_add_run(ExtRunList* runs, const char* temp_dir, FILE** file) {
+    // Creates an empty temp file for a new run and appends its path to runs.
+    if (runs->count == runs->capacity) {
+        int new_capacity = (runs->capacity == 0) ? 16 : runs->capacity * 2;
+        char** paths = realloc(runs->paths, new_capacity * sizeof(char*));
+        if (paths == NULL) {
+            fprintf(stderr, "ERROR - Could not grow the run list\n");
+            return -1;
+        }
+        runs->paths = paths;
+        runs->capacity = new_capacity;
+    }
+    size_t len = strlen(temp_dir) + sizeof("/extsort_XXXXXX");
+    char* path = malloc(len);
+    if (path == NULL) {
+        fprintf(stderr, "ERROR - Could not malloc %lu bytes.\n", len);
+        return -1;
+    }
+    snprintf(path, len, "%s/extsort_XXXXXX", temp_dir);
+    int fd = mkstemp(path);
+    if (fd < 0) {
+        fprintf(stderr, "ERROR - Could not create a run file in %s\n", temp_dir);
+        free(path);
+        return -1;
+    }
+    close(fd);
+    *file = ext_open(path, "wb");
+    if (*file == NULL) {
+        remove(path);
+        free(path);
+        return -1;
+    }
+    runs->paths[runs->count++] = path;
+    return 0;
+}
+
+void ext_clear_runs(ExtRunList* runs) {
+    for (int i = 0; i < runs->count; i++) {
+        remove(runs->paths[i]);
+        free(runs->paths[i]);
+    }
+    free(runs->paths);
+    runs->paths = NULL;
+    runs->count = 0;
+    runs->capacity = 0;
+}
+
+size_t ext_read_chunk(FILE* file, int* array, size_t capacity, int* error) {
+    // fread until the chunk is full or the file ends.
+    size_t total = 0;
+    while (total < capacity) {
+        size_t got = fread(array + total, sizeof(int), capacity - total, file);
+        total += got;
+        if (got == 0) {
+            break;
+        }
+    }
+    if (ferror(file)) {
+        fprintf(stderr, "ERROR - Read failed\n");
+        *error = 1;
+    }
+    return total;
+}
+
+int ext_create_runs(const char* in_path, const char* out_path, size_t budget, const char* temp_dir, ExtRunList* runs) {
+    // Phase 1: cut the input into sorted runs. Half the budget holds the chunk,
+    // the other half is the radix sort's scratch. Both are allocated together,
+    // so sorting a chunk cannot fail. If the whole input fits in one chunk it is
+    // written straight to out_path and no runs are created.
+    size_t chunk = budget / (2 * sizeof(int));
+    if (chunk > INT_MAX) {
+        chunk = INT_MAX;
+    }
+    int* array = malloc(2 * chunk * sizeof(int));
+    if (array == NULL) {
+        fprintf(stderr, "ERROR - Could not malloc %lu bytes.\n", 2 * chunk * sizeof(int));
+        return -1;
+    }
+    int* scratch = array + chunk;
+    FILE* in = ext_open(in_path, "rb");
+    if (in == NULL) {
+        free(array);
+        return -1;
+    }
+    // fread would silently drop a partial int at the end, so check the size first.
+    if (fseeko(in, 0, SEEK_END) == 0) {
+        off_t size = ftello(in);
+        rewind(in);
+        if (size % sizeof(int) != 0) {
+            fprintf(stderr, "ERROR - Input size is not a multiple of %lu bytes\n", sizeof(int));
+            fclose(in);
+            free(array);
+            return -1;
+        }
+    }
+    int error = 0;
+    while (!error) {
+        size_t count = ext_read_chunk(in, array, chunk, &error);
+        if (error || (count == 0 && runs->count > 0)) {
+            break;
+        }
+        radix_sort_with_buffer(array, (int)count, scratch);
+        FILE* out = NULL;
+        if (runs->count == 0 && count < chunk) {
+            // Single chunk: the input is fully read, so out_path may even be in_path.
+            fclose(in);
+            in = NULL;
+            out = ext_open(out_path, "wb");
+            if (out == NULL) {
+                error = 1;
+                break;
+            }
+            error = ext_write_all(out, array, count) != 0;
+            error |= ext_close(out) != 0;
+            break;
+        }
+        if (ext_add_run(runs, temp_dir, &out) != 0) {
+            error = 1;
+            break;
+        }
+        error = ext_write_all(out, array, count) != 0;
+        error |= ext_close(out) != 0;
+        if (count < chunk) {
+            break;
+        }
+    }
+    if (in != NULL) {
+        fclose(in);
+    }
+    free(array);
+    return error ? -1 : 0;
+}
+
+void ext_reader_fill(ExtReader* reader, int* error) {
+    reader->len = fread(reader->buf, sizeof(int), reader->capacity, reader->file);
+    reader->pos = 0;
+    if (reader->len == 0) {
+        if (ferror(reader->file)) {
+            fprintf(stderr, "ERROR - Read failed\n");
+            *error = 1;
+        }
+        reader->done = 1;
+    }
+}
+
+// Loser tree helpers: a leaf beats another if the other is exhausted or its
+// current value is not larger.
+static inline int ext_beats(const ExtReader* readers, int a, int b) {
+    if (readers[b].done) return 1;
+    if (readers[a].done) return 0;
+    return readers[a].buf[readers[a].pos] <= readers[b].buf[readers[b].pos];
+}
+
+int ext_merge(char** paths, int k, FILE* out, size_t budget) {
+    // k-way merge of sorted run files into out. The budget is split evenly
+    // between k read buffers and one write buffer.
+    if (k < 1) {
+        return 0;
+    }
+    size_t buffer_ints = budget / ((size_t)(k + 1) * sizeof(int));
+    int* memory = malloc((size_t)(k + 1) * buffer_ints * sizeof(int));
+    ExtReader* readers = calloc(k, sizeof(ExtReader));
+    // Loser tree: tree[1..k-1] hold the loser of each match and tree[0] the
+    // overall winner. Leaf i sits at implicit position k + i. The build needs
+    // the winner of every subtree too, hence 2k slots of scratch.
+    int* tree = malloc(k * sizeof(int));
+    int* winners = malloc(2 * k * sizeof(int));
+    if (memory == NULL || readers == NULL || tree == NULL || winners == NULL) {
+        fprintf(stderr, "ERROR - Could not allocate merge buffers\n");
+        free(memory);
+        free(readers);
+        free(tree);
+        free(winners);
+        return -1;
+    }
+    int error = 0;
+    for (int i = 0; i < k; i++) {
+        readers[i].buf = memory + i * buffer_ints;
+        readers[i].capacity = buffer_ints;
+        readers[i].file = ext_open(paths[i], "rb");
+        if (readers[i].file == NULL) {
+            error = 1;
+            readers[i].done = 1;
+            continue;
+        }
+        ext_reader_fill(&readers[i], &error);
+    }
+
+    for (int i = 0; i < k; i++) {
+        winners[k + i] = i;
+    }
+    for (int node = k - 1; node >= 1; node--) {
+        int a = winners[2 * node];
+        int b = winners[2 * node + 1];
+        int a_wins = ext_beats(readers, a, b);
+        winners[node] = a_wins ? a : b;
+        tree[node] = a_wins ? b : a;
+    }
+    // With k == 1 there are no matches and winners[1] is leaf 0 itself.
+    tree[0] = winners[1];
+    free(winners);
+
+    int* out_buf = memory + k * buffer_ints;
+    size_t out_len = 0;
+    while (!error && !readers[tree[0]].done) {
+        int leaf = tree[0];
+        ExtReader* reader = &readers[leaf];
+        out_buf[out_len++] = reader->buf[reader->pos++];
+        if (out_len == buffer_ints) {
+            error = ext_write_all(out, out_buf, out_len) != 0;
+            out_len = 0;
+        }
+        if (reader->pos == reader->len) {
+            ext_reader_fill(reader, &error);
+        }
+        // Replay the path from the leaf to the root: only log2(k) compares,
+        // each against the stored loser of that match.
+        for (int node = (k + leaf) / 2; node >= 1; node /= 2) {
+            if (ext_beats(readers, tree[node], leaf)) {
+                int tmp = tree[node];
+                tree[node] = leaf;
+                leaf = tmp;
+            }
+        }
+        tree[0] = leaf;
+    }
+    if (!error) {
+        error = ext_write_all(out, out_buf, out_len) != 0;
+    }
+
+    for (int i = 0; i < k; i++) {
+        if (readers[i].file != NULL) {
+            fclose(readers[i].file);
+        }
+    }
+    free(memory);
+    free(readers);
+    free(tree);
+    return error ? -1 : 0;
+}
+
+int external_sort(const char* in_path, const char* out_path, const ExternalSortConfig* config) {
+    if (in_path == NULL || out_path == NULL) {
+        fprintf(stderr, "ERROR - Must pass input and output paths\n");
+        return -1;
+    }
+    size_t budget = (config != NULL && config->memory_budget != 0) ? config->memory_budget : EXT_DEFAULT_BUDGET;
+    if (budget < EXT_MIN_BUDGET) {
+        fprintf(stderr, "ERROR - Memory budget must be at least %lu bytes\n", EXT_MIN_BUDGET);
+        return -1;
+    }
+    const char* temp_dir = (config != NULL) ? config->temp_dir : NULL;
+    if (temp_dir == NULL) {
+        temp_dir = getenv("TMPDIR");
+    }
+    if (temp_dir == NULL) {
+        temp_dir = "/tmp";
+    }
+    size_t budget_fan_in = budget / EXT_MIN_BUFFER - 1;
+    int fan_in = (budget_fan_in > 1024) ? 1024 : (int)budget_fan_in;
+    if (config != NULL && config->max_fan_in >= 2 && config->max_fan_in < fan_in) {
+        fan_in = config->max_fan_in;
+    }
+
+    ExtRunList runs = {NULL, 0, 0};
+    if (ext_create_runs(in_path, out_path, budget, temp_dir, &runs) != 0) {
+        ext_clear_runs(&runs);
+        return -1;
+    }
+
+    // Intermediate passes: merge groups of fan_in runs into new runs until a
+    // single merge can produce the output.
+    while (runs.count > fan_in) {
+        ExtRunList next = {NULL, 0, 0};
+        int error = 0;
+        for (int st = 0; st < runs.count && !error; st += fan_in) {
+            int k = (runs.count - st < fan_in) ? runs.count - st : fan_in;
+            FILE* out = NULL;
+            if (ext_add_run(&next, temp_dir, &out) != 0) {
+                error = 1;
+                break;
+            }
+            error = ext_merge(runs.paths + st, k, out, budget) != 0;
+            error |= ext_close(out) != 0;
+        }
+        ext_clear_runs(&runs);
+        runs = next;
+        if (error) {
+            ext_clear_runs(&runs);
+            return -1;
+        }
+    }
+
+    int error = 0;
+    if (runs.count > 0) {
+        FILE* out = ext_open(out_path, "wb");
+        if (out == NULL) {
+            error = 1;
+        }
+        else {
+            error = ext_merge(runs.paths, runs.count, out, budget) != 0;
+            error |= ext_close(out) != 0;
+        }
+    }
+    ext_clear_runs(&runs);
+    return error ? -1 : 0;
+}
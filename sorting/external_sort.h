@@ -0,0 +1,23 @@
+#ifndef EXTERNAL_SORT_H
+#define EXTERNAL_SORT_H
+
+#include <stddef.h>
+
+// Sorts files of native-endian int32 values that do not fit in memory.
+// The input is read in chunks that fit the memory budget, each chunk is sorted
+// with radix_sort and written to the temp directory as a sorted run, and the
+// runs are k-way merged through a loser tree into the output file. If there are
+// more runs than max_fan_in, intermediate merge passes combine them first.
+
+typedef struct ExternalSortConfig {
+    size_t memory_budget; // Bytes for all buffers together (0 = 256 MB)
+    const char* temp_dir; // Where runs are spilled (NULL = $TMPDIR or /tmp)
+    int max_fan_in;       // Runs merged at once (0 = as many as the budget allows)
+} ExternalSortConfig;
+
+// Sorts in_path into out_path (which may be the same file). config may be NULL
+// for the defaults. Returns 0 on success, -1 on error (message on stderr).
+// Temporary runs are removed in both cases.
+int external_sort(const char* in_path, const char* out_path, const ExternalSortConfig* config);
+
+#endif
@@ -0,0 +1,526 @@
+#include <pthread.h>
+#include <sched.h>
+#include <stdatomic.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "sorting.h"
+#include "parallel_sort.h"
+
+// Below this many elements a task just calls quick_sort.
+#define PSORT_LEAF_SIZE 16384
+// Below this many elements a merge runs sequentially.
+#define PSORT_MERGE_GRAIN 8192
+// parallel_sort switches from merge sort to sample sort at this size.
+#define PSORT_SAMPLE_SORT_THRESHOLD (1 << 22)
+// Samples taken per bucket when choosing sample sort splitters.
+#define PSORT_OVERSAMPLE 64
+// Sample sort buckets and blocks per thread (more than one each for load balance).
+#define PSORT_BUCKETS_PER_THREAD 8
+#define PSORT_BLOCKS_PER_THREAD 4
+
+// === WORK-STEALING POOL ===
+// Every worker owns a deque. It pushes and pops its own tasks at the tail (LIFO,
+// good locality) and idle workers steal from the head (FIFO, the oldest and
+// therefore biggest pieces of work). A task group is an atomic counter of
+// unfinished tasks; waiting on it runs other tasks instead of blocking.
+
+typedef struct PoolTask {
+    void (*fn)(void* arg);
+    void* arg;
+    atomic_int* pending; // Decremented once fn returns
+} PoolTask;
+
+typedef struct PoolDeque {
+    pthread_mutex_t lock;
+    PoolTask* tasks;
+    int head;     // Thieves take from here
+    int tail;     // Owner pushes/pops here
+    int capacity;
+} PoolDeque;
+
+typedef struct ThreadPool {
+    int nthreads;
+    PoolDeque* deques;
+    pthread_t* threads;
+    atomic_int stop;
+} ThreadPool;
+
+typedef struct PoolWorkerArgs {
+    ThreadPool* pool;
+    int id;
+} PoolWorkerArgs;
+
+// Index of the deque owned by the current thread. The thread calling into
+// parallel_sort is worker 0.
+static __thread int pool_worker_id = 0;
+
+void pool_push(PoolDeque* deque, PoolTask task) {
+    pthread_mutex_lock(&deque->lock);
+    if (deque->tail == deque->capacity) {
+        if (deque->head > 0) {
+            // Reclaim the space thieves left at the front.
+            memmove(deque->tasks, deque->tasks + deque->head, (deque->tail - deque->head) * sizeof(PoolTask));
+            deque->tail -= deque->head;
+            deque->head = 0;
+        }
+        else {
+            int new_capacity = deque->capacity * 2;
+            PoolTask* tasks = realloc(deque->tasks, new_capacity * sizeof(PoolTask));
+            if (tasks == NULL) {
+                // Out of memory: run it inline rather than lose it.
+                pthread_mutex_unlock(&deque->lock);
+                task.fn(task.arg);
+                atomic_fetch_sub_explicit(task.pending, 1, memory_order_release);
+                return;
+            }
+            deque->tasks = tasks;
+            deque->capacity = new_capacity;
+        }
+    }
+    deque->tasks[deque->tail++] = task;
+    pthread_mutex_unlock(&deque->lock);
+}
+
+int pool_take(PoolDeque* deque, PoolTask* out, int steal) {
+    // steal = 0: owner pops newest; steal = 1: thief takes oldest.
+    if (pthread_mutex_trylock(&deque->lock) != 0) {
+        return 0;
+    }
+    int found = 0;
+    if (deque->head < deque->tail) {
+        *out = steal ? deque->tasks[deque->head++] : deque->tasks[--deque->tail];
+        found = 1;
+        if (deque->head == deque->tail) {
+            deque->head = 0;
+            deque->tail = 0;
+        }
+    }
+    pthread_mutex_unlock(&deque->lock);
+    return found;
+}
+
+int pool_find_task(ThreadPool* pool, PoolTask* out) {
+    int id = pool_worker_id;
+    if (pool_take(&pool->deques[id], out, 0)) {
+        return 1;
+    }
+    for (int k = 1; k < pool->nthreads; k++) {
+        if (pool_take(&pool->deques[(id + k) % pool->nthreads], out, 1)) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+void pool_run(PoolTask task) {
+    task.fn(task.arg);
+    atomic_fetch_sub_explicit(task.pending, 1, memory_order_release);
+}
+
+void* pool_worker_main(void* arg) {
+    PoolWorkerArgs* args = arg;
+    ThreadPool* pool = args->pool;
+    pool_worker_id = args->id;
+    PoolTask task;
+    while (!atomic_load_explicit(&pool->stop, memory_order_acquire)) {
+        if (pool_find_task(pool, &task)) {
+            pool_run(task);
+        }
+        else {
+            sched_yield();
+        }
+    }
+    return NULL;
+}
+
+void pool_spawn(ThreadPool* pool, void (*fn)(void*), void* arg, atomic_int* pending) {
+    atomic_fetch_add_explicit(pending, 1, memory_order_relaxed);
+    PoolTask task = {fn, arg, pending};
+    pool_push(&pool->deques[pool_worker_id], task);
+}
+
+void pool_wait(ThreadPool* pool, atomic_int* pending) {
+    // Help out until every task of this group has finished.
+    PoolTask task;
+    while (atomic_load_explicit(pending, memory_order_acquire) > 0) {
+        if (pool_find_task(pool, &task)) {
+            pool_run(task);
+        }
+        else {
+            sched_yield();
+        }
+    }
+}
+
+void pool_free(ThreadPool* pool, int num_deques, PoolWorkerArgs* args) {
+    // Frees the first num_deques deques and everything else the pool owns.
+    // Its worker threads must already have been joined.
+    for (int i = 0; i < num_deques; i++) {
+        pthread_mutex_destroy(&pool->deques[i].lock);
+        free(pool->deques[i].tasks);
+    }
+    free(pool->deques);
+    free(pool->threads);
+    free(pool);
+    free(args);
+}
+
+void pool_stop(ThreadPool* pool, int num_started) {
+    // Workers 1 .. num_started - 1 are running; stop and join them.
+    atomic_store_explicit(&pool->stop, 1, memory_order_release);
+    for (int i = 1; i < num_started; i++) {
+        pthread_join(pool->threads[i], NULL);
+    }
+}
+
+ThreadPool* pool_create(int nthreads, PoolWorkerArgs** args_out) {
+    ThreadPool* pool = malloc(sizeof(ThreadPool));
+    PoolWorkerArgs* args = malloc(nthreads * sizeof(PoolWorkerArgs));
+    if (pool == NULL || args == NULL) {
+        fprintf(stderr, "Failed to allocate thread pool\n");
+        free(pool);
+        free(args);
+        return NULL;
+    }
+    pool->nthreads = nthreads;
+    pool->deques = calloc(nthreads, sizeof(PoolDeque));
+    pool->threads = malloc(nthreads * sizeof(pthread_t));
+    if (pool->deques == NULL || pool->threads == NULL) {
+        fprintf(stderr, "Failed to allocate thread pool\n");
+        pool_free(pool, 0, args);
+        return NULL;
+    }
+    atomic_init(&pool->stop, 0);
+    for (int i = 0; i < nthreads; i++) {
+        pool->deques[i].capacity = 64;
+        pool->deques[i].tasks = malloc(64 * sizeof(PoolTask));
+        if (pool->deques[i].tasks == NULL) {
+            fprintf(stderr, "Failed to allocate %lu bytes of memory\n", 64 * sizeof(PoolTask));
+            pool_free(pool, i, args);
+            return NULL;
+        }
+        pthread_mutex_init(&pool->deques[i].lock, NULL);
+    }
+    pool_worker_id = 0;
+    for (int i = 1; i < nthreads; i++) {
+        args[i] = (PoolWorkerArgs){pool, i};
+        if (pthread_create(&pool->threads[i], NULL, pool_worker_main, &args[i]) != 0) {
+            // The callers fall back to a sequential sort, so a pool short of
+            // threads is not worth keeping.
+            fprintf(stderr, "Failed to start thread %d of %d\n", i, nthreads);
+            pool_stop(pool, i);
+            pool_free(pool, nthreads, args);
+            return NULL;
+        }
+    }
+    *args_out = args;
+    return pool;
+}
+
+void pool_destroy(ThreadPool* pool, PoolWorkerArgs* args) {
+    pool_stop(pool, pool->nthreads);
+    pool_free(pool, pool->nthreads, args);
+}
+
+// === PARALLEL MERGE SORT ===
+
+typedef struct MergeTask {
+    ThreadPool* pool;
+    const int* a;
+    int na;
+    const int* b;
+    int nb;
+    int* out;
+} MergeTask;
+
+typedef struct MergeSortTask {
+    ThreadPool* pool;
+    int* array;
+    int* buffer;
+    int count;
+    int into_buffer; // Result must end up in buffer (1) or in array (0)
+} MergeSortTask;
+
+int psort_lower_bound(const int* array, int count, int val) {
+    // First index whose value is >= val.
+    int st = 0;
+    while (count > 0) {
+        int half = count / 2;
+        if (array[st + half] < val) {
+            st += half + 1;
+            count -= half + 1;
+        }
+        else {
+            count = half;
+        }
+    }
+    return st;
+}
+
+void psort_merge_task(void* arg) {
+    // Merge a and b into out. Big merges are split around the median of the
+    // larger input: everything left of it goes to one task, the rest to another.
+    MergeTask* t = arg;
+    if (t->na + t->nb <= PSORT_MERGE_GRAIN) {
+        int i = 0, j = 0, k = 0;
+        while (i < t->na && j < t->nb) {
+            t->out[k++] = (t->a[i] <= t->b[j]) ? t->a[i++] : t->b[j++];
+        }
+        memcpy(t->out + k, t->a + i, (t->na - i) * sizeof(int));
+        k += t->na - i;
+        memcpy(t->out + k, t->b + j, (t->nb - j) * sizeof(int));
+        return;
+    }
+    const int* a = t->a;
+    const int* b = t->b;
+    int na = t->na;
+    int nb = t->nb;
+    if (na < nb) {
+        // Split the larger side so both halves shrink.
+        const int* tmp = a; a = b; b = tmp;
+        int tmp_n = na; na = nb; nb = tmp_n;
+    }
+    int mid_a = na / 2;
+    int mid_b = psort_lower_bound(b, nb, a[mid_a]);
+    t->out[mid_a + mid_b] = a[mid_a];
+    MergeTask left = {t->pool, a, mid_a, b, mid_b, t->out};
+    MergeTask right = {t->pool, a + mid_a + 1, na - mid_a - 1, b + mid_b, nb - mid_b, t->out + mid_a + mid_b + 1};
+    atomic_int pending = 0;
+    pool_spawn(t->pool, psort_merge_task, &left, &pending);
+    psort_merge_task(&right);
+    pool_wait(t->pool, &pending);
+}
+
+void psort_merge_sort_task(void* arg) {
+    MergeSortTask* t = arg;
+    if (t->count <= PSORT_LEAF_SIZE) {
+        quick_sort(t->array, t->count);
+        if (t->into_buffer) {
+            memcpy(t->buffer, t->array, t->count * sizeof(int));
+        }
+        return;
+    }
+    // Sort the halves into the opposite location, so the merge lands where we need it.
+    int half = t->count / 2;
+    MergeSortTask left = {t->pool, t->array, t->buffer, half, !t->into_buffer};
+    MergeSortTask right = {t->pool, t->array + half, t->buffer + half, t->count - half, !t->into_buffer};
+    atomic_int pending = 0;
+    pool_spawn(t->pool, psort_merge_sort_task, &left, &pending);
+    psort_merge_sort_task(&right);
+    pool_wait(t->pool, &pending);
+
+    int* src = t->into_buffer ? t->array : t->buffer;
+    int* dst = t->into_buffer ? t->buffer : t->array;
+    MergeTask merge = {t->pool, src, half, src + half, t->count - half, dst};
+    psort_merge_task(&merge);
+}
+
+void parallel_merge_sort(int* array, int count, int nthreads) {
+    if (nthreads <= 1 || count <= PSORT_LEAF_SIZE) {
+        quick_sort(array, count);
+        return;
+    }
+    int* buffer = malloc(count * sizeof(int));
+    if (buffer == NULL) {
+        fprintf(stderr, "Failed to allocate %lu bytes of memory\n", count * sizeof(int));
+        quick_sort(array, count);
+        return;
+    }
+    PoolWorkerArgs* args;
+    ThreadPool* pool = pool_create(nthreads, &args);
+    if (pool == NULL) {
+        free(buffer);
+        quick_sort(array, count);
+        return;
+    }
+    MergeSortTask root = {pool, array, buffer, count, 0};
+    psort_merge_sort_task(&root);
+    pool_destroy(pool, args);
+    free(buffer);
+}
+
+// === PARALLEL SAMPLE SORT ===
+
+typedef struct SampleSort {
+    ThreadPool* pool;
+    int* array;
+    int* buffer;
+    unsigned short* bucket_of; // Bucket index of every element, from the classify pass
+    int count;
+    const int* splitters;      // nbuckets - 1 sorted splitters
+    int nbuckets;
+    int nblocks;
+    int* block_counts;         // [block][bucket] histogram, then scatter offsets
+    int* bucket_starts;        // nbuckets + 1 prefix sums
+} SampleSort;
+
+typedef struct SampleSortTask {
+    SampleSort* sort;
+    int index; // Block or bucket number, depending on the phase
+} SampleSortTask;
+
+int psort_find_bucket(const int* splitters, int num_splitters, int val) {
+    // upper_bound over the splitters: number of splitters <= val.
+    int st = 0;
+    int count = num_splitters;
+    while (count > 0) {
+        int half = count / 2;
+        if (splitters[st + half] <= val) {
+            st += half + 1;
+            count -= half + 1;
+        }
+        else {
+            count = half;
+        }
+    }
+    return st;
+}
+
+void psort_block_range(SampleSort* s, int block, int* st, int* ed) {
+    long long per_block = ((long long)s->count + s->nblocks - 1) / s->nblocks;
+    long long lo = block * per_block;
+    long long hi = lo + per_block;
+    *st = (lo < s->count) ? (int)lo : s->count;
+    *ed = (hi < s->count) ? (int)hi : s->count;
+}
+
+void psort_classify_task(void* arg) {
+    SampleSortTask* t = arg;
+    SampleSort* s = t->sort;
+    int st, ed;
+    psort_block_range(s, t->index, &st, &ed);
+    int* counts = s->block_counts + (long long)t->index * s->nbuckets;
+    for (int i = st; i < ed; i++) {
+        int bucket = psort_find_bucket(s->splitters, s->nbuckets - 1, s->array[i]);
+        s->bucket_of[i] = (unsigned short)bucket;
+        counts[bucket]++;
+    }
+}
+
+void psort_scatter_task(void* arg) {
+    // block_counts now holds this block's write offset for every bucket.
+    SampleSortTask* t = arg;
+    SampleSort* s = t->sort;
+    int st, ed;
+    psort_block_range(s, t->index, &st, &ed);
+    int* offsets = s->block_counts + (long long)t->index * s->nbuckets;
+    for (int i = st; i < ed; i++) {
+        s->buffer[offsets[s->bucket_of[i]]++] = s->array[i];
+    }
+}
+
+void psort_bucket_task(void* arg) {
+    SampleSortTask* t = arg;
+    SampleSort* s = t->sort;
+    int st = s->bucket_starts[t->index];
+    int len = s->bucket_starts[t->index + 1] - st;
+    quick_sort(s->buffer + st, len);
+    memcpy(s->array + st, s->buffer + st, len * sizeof(int));
+}
+
+void psort_run_phase(SampleSort* s, SampleSortTask* tasks, int ntasks, void (*fn)(void*)) {
+    atomic_int pending = 0;
+    for (int i = 0; i < ntasks; i++) {
+        tasks[i] = (SampleSortTask){s, i};
+        pool_spawn(s->pool, fn, &tasks[i], &pending);
+    }
+    pool_wait(s->pool, &pending);
+}
+
+void parallel_sample_sort(int* array, int count, int nthreads) {
+    if (nthreads <= 1 || count <= 2 * PSORT_LEAF_SIZE) {
+        quick_sort(array, count);
+        return;
+    }
+    SampleSort s;
+    s.array = array;
+    s.count = count;
+    s.nbuckets = nthreads * PSORT_BUCKETS_PER_THREAD;
+    if (s.nbuckets > 4096) {
+        s.nbuckets = 4096;
+    }
+    s.nblocks = nthreads * PSORT_BLOCKS_PER_THREAD;
+    int nsamples = s.nbuckets * PSORT_OVERSAMPLE;
+    int* samples = malloc(nsamples * sizeof(int));
+    int* splitters = malloc(s.nbuckets * sizeof(int));
+    s.buffer = malloc(count * sizeof(int));
+    s.bucket_of = malloc(count * sizeof(unsigned short));
+    s.block_counts = calloc((long long)s.nblocks * s.nbuckets, sizeof(int));
+    s.bucket_starts = malloc((s.nbuckets + 1) * sizeof(int));
+    int ntasks = (s.nblocks > s.nbuckets) ? s.nblocks : s.nbuckets;
+    SampleSortTask* tasks = malloc(ntasks * sizeof(SampleSortTask));
+    if (samples == NULL || splitters == NULL || s.buffer == NULL || s.bucket_of == NULL
+        || s.block_counts == NULL || s.bucket_starts == NULL || tasks == NULL) {
+        fprintf(stderr, "Failed to allocate sample sort scratch, falling back to merge sort\n");
+        free(samples); free(splitters); free(s.buffer); free(s.bucket_of);
+        free(s.block_counts); free(s.bucket_starts); free(tasks);
+        parallel_merge_sort(array, count, nthreads);
+        return;
+    }
+
+    // Splitters: every PSORT_OVERSAMPLE-th element of a sorted random sample.
+    uint64_t rng = 0x9E3779B97F4A7C15ULL;
+    for (int i = 0; i < nsamples; i++) {
+        rng ^= rng << 13;
+        rng ^= rng >> 7;
+        rng ^= rng << 17;
+        samples[i] = array[rng % (uint64_t)count];
+    }
+    quick_sort(samples, nsamples);
+    for (int i = 0; i < s.nbuckets - 1; i++) {
+        splitters[i] = samples[(i + 1) * PSORT_OVERSAMPLE];
+    }
+    s.splitters = splitters;
+
+    PoolWorkerArgs* args;
+    s.pool = pool_create(nthreads, &args);
+    if (s.pool == NULL) {
+        free(samples); free(splitters); free(s.buffer); free(s.bucket_of);
+        free(s.block_counts); free(s.bucket_starts); free(tasks);
+        quick_sort(array, count);
+        return;
+    }
+
+    // 1. Classify: per-block bucket histograms.
+    psort_run_phase(&s, tasks, s.nblocks, psort_classify_task);
+
+    // 2. Exclusive prefix sum in bucket-major order turns the histograms into
+    //    write offsets, so blocks scatter into disjoint slots without locking.
+    int sum = 0;
+    for (int b = 0; b < s.nbuckets; b++) {
+        s.bucket_starts[b] = sum;
+        for (int blk = 0; blk < s.nblocks; blk++) {
+            int* cell = &s.block_counts[(long long)blk * s.nbuckets + b];
+            int n = *cell;
+            *cell = sum;
+            sum += n;
+        }
+    }
+    s.bucket_starts[s.nbuckets] = sum;
+
+    // 3. Scatter into the buffer, 4. sort each bucket and copy it back.
+    psort_run_phase(&s, tasks, s.nblocks, psort_scatter_task);
+    psort_run_phase(&s, tasks, s.nbuckets, psort_bucket_task);
+
+    pool_destroy(s.pool, args);
+    free(samples);
+    free(splitters);
+    free(s.buffer);
+    free(s.bucket_of);
+    free(s.block_counts);
+    free(s.bucket_starts);
+    free(tasks);
+}
+
+void parallel_sort(int* array, int count, int nthreads) {
+    // Sample sort moves every element only twice, which wins once the input
+    // no longer fits in cache; below that the merge sort's lower setup cost wins.
+    if (count >= PSORT_SAMPLE_SORT_THRESHOLD) {
+        parallel_sample_sort(array, count, nthreads);
+    }
+    else {
+        parallel_merge_sort(array, count, nthreads);
+    }
+}
@@ -0,0 +1,20 @@
+#ifndef PARALLEL_SORT_H
+#define PARALLEL_SORT_H
+
+// Multi-threaded sorts built on the sequential sorts in sorting.h.
+// Each call starts a small work-stealing pthreads pool of nthreads workers
+// (the calling thread is one of them) and tears it down before returning.
+// nthreads <= 1 simply runs quick_sort.
+
+// Picks parallel_merge_sort or parallel_sample_sort depending on the input size.
+void parallel_sort(int* array, int count, int nthreads);
+
+// Task-parallel merge sort: halves are sorted as stealable tasks down to
+// quick_sort leaves, and merges are themselves split in parallel.
+void parallel_merge_sort(int* array, int count, int nthreads);
+
+// Sample sort: splitters from a sorted random sample, parallel bucket
+// classification and scatter, then quick_sort on every bucket in parallel.
+void parallel_sample_sort(int* array, int count, int nthreads);
+
+#endif
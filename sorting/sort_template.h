@@ -0,0 +1,297 @@
+#ifndef SORT_TEMPLATE_H
+#define SORT_TEMPLATE_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Typed sorts for any element type, generated by macros so the comparison is
+// inlined into the sort loop instead of called through a pointer like qsort.
+//
+//   #define POINT_LESS(a, b) ((a)->x < (b)->x)
+//   SORT_DEFINE(point, Point, POINT_LESS)
+//
+// generates, for Point* arrays:
+//   point_insertion_sort(Point* array, int count)
+//   point_heap_sort(Point* array, int count)
+//   point_quick_sort(Point* array, int count)   - introsort, not stable
+//   point_merge_sort(Point* array, int count)   - stable, one buffer allocation
+//   point_merge_sort_with_buffer(Point* array, int count, Point* buffer)
+//
+// less(a, b) gets two const type* and returns nonzero if *a orders before *b.
+// It can be a function or a function-like macro; either way it is expanded
+// into the generated code.
+//
+//   #define POINT_KEY(p) ((p)->id)
+//   SORT_DEFINE_RADIX(point_by_id, Point, unsigned int, POINT_KEY)
+//
+// generates point_by_id_radix_sort(Point* array, int count), a stable LSD
+// radix sort on an integer key (signed or unsigned, 8 to 64 bits).
+
+// Partitions at or below this size are finished with insertion sort.
+#define SORT_TEMPLATE_INSERTION_THRESHOLD 16
+// Above this size the pivot is a ninther.
+#define SORT_TEMPLATE_NINTHER_THRESHOLD 128
+// Merge sort insertion-sorts runs of this size before merging.
+#define SORT_TEMPLATE_MERGE_RUN 32
+
+// Instrumentation hook, called with the number of elements copied at every
+// element assignment or memcpy (temporaries included, so a swap is 3). Define it
+// before including this header to count data movement; comparisons can be
+// counted inside less. Compiles to nothing by default.
+#ifndef SORT_TEMPLATE_ON_MOVE
+#define SORT_TEMPLATE_ON_MOVE(n)
+#endif
+
+#define SORT_DEFINE(name, type, less) \
+static inline void name##_insertion_sort(type* array, int count) { \
+    for (int i = 1; i < count; i++) { \
+        type key = array[i]; \
+        int j = i - 1; \
+        while (j >= 0 && less(&key, &array[j])) { \
+            array[j + 1] = array[j]; \
+            SORT_TEMPLATE_ON_MOVE(1); \
+            j--; \
+        } \
+        array[j + 1] = key; \
+        SORT_TEMPLATE_ON_MOVE(2); \
+    } \
+} \
+\
+static inline void name##_sift_down(type* array, int root, int count) { \
+    type val = array[root]; \
+    int child = 2 * root + 1; \
+    while (child < count) { \
+        if (child + 1 < count && less(&array[child], &array[child + 1])) { \
+            child++; \
+        } \
+        if (!less(&val, &array[child])) { \
+            break; \
+        } \
+        array[root] = array[child]; \
+        SORT_TEMPLATE_ON_MOVE(1); \
+        root = child; \
+        child = 2 * root + 1; \
+    } \
+    array[root] = val; \
+    SORT_TEMPLATE_ON_MOVE(2); \
+} \
+\
+static inline void name##_heap_sort(type* array, int count) { \
+    for (int i = count / 2 - 1; i >= 0; i--) { \
+        name##_sift_down(array, i, count); \
+    } \
+    for (int end = count - 1; end > 0; end--) { \
+        type tmp = array[0]; \
+        array[0] = array[end]; \
+        array[end] = tmp; \
+        SORT_TEMPLATE_ON_MOVE(3); \
+        name##_sift_down(array, 0, end); \
+    } \
+} \
+\
+static inline int name##_median_of_three(type* array, int a, int b, int c) { \
+    if (less(&array[a], &array[b])) { \
+        if (less(&array[b], &array[c])) return b; \
+        return less(&array[a], &array[c]) ? c : a; \
+    } \
+    if (less(&array[a], &array[c])) return a; \
+    return less(&array[b], &array[c]) ? c : b; \
+} \
+\
+static inline int name##_partition(type* array, int st, int ed) { \
+    /* Hoare partition of [st, ed] around a median-of-3 or ninther pivot. */ \
+    /* Returns j with array[st..j] <= pivot <= array[j+1..ed], st <= j < ed. */ \
+    int mid = st + (ed - st) / 2; \
+    int pivot_idx; \
+    if (ed - st + 1 < SORT_TEMPLATE_NINTHER_THRESHOLD) { \
+        pivot_idx = name##_median_of_three(array, st, mid, ed); \
+    } \
+    else { \
+        int step = (ed - st + 1) / 8; \
+        int lo = name##_median_of_three(array, st, st + step, st + 2 * step); \
+        int md = name##_median_of_three(array, mid - step, mid, mid + step); \
+        int hi = name##_median_of_three(array, ed - 2 * step, ed - step, ed); \
+        pivot_idx = name##_median_of_three(array, lo, md, hi); \
+    } \
+    type pivot = array[pivot_idx]; \
+    array[pivot_idx] = array[st]; \
+    array[st] = pivot; \
+    SORT_TEMPLATE_ON_MOVE(3); \
+    int i = st - 1; \
+    int j = ed + 1; \
+    while (1) { \
+        do { \
+            i++; \
+        } while (less(&array[i], &pivot)); \
+        do { \
+            j--; \
+        } while (less(&pivot, &array[j])); \
+        if (i >= j) { \
+            return j; \
+        } \
+        type tmp = array[i]; \
+        array[i] = array[j]; \
+        array[j] = tmp; \
+        SORT_TEMPLATE_ON_MOVE(3); \
+    } \
+} \
+\
+static inline void name##_quick_sort_step(type* array, int st, int ed, int depth_limit) { \
+    /* Introsort: recurse into the smaller side, loop on the larger one. */ \
+    while (ed - st + 1 > SORT_TEMPLATE_INSERTION_THRESHOLD) { \
+        if (depth_limit == 0) { \
+            name##_heap_sort(array + st, ed - st + 1); \
+            return; \
+        } \
+        depth_limit--; \
+        int split = name##_partition(array, st, ed); \
+        if (split - st < ed - split) { \
+            name##_quick_sort_step(array, st, split, depth_limit); \
+            st = split + 1; \
+        } \
+        else { \
+            name##_quick_sort_step(array, split + 1, ed, depth_limit); \
+            ed = split; \
+        } \
+    } \
+    name##_insertion_sort(array + st, ed - st + 1); \
+} \
+\
+static inline void name##_quick_sort(type* array, int count) { \
+    int depth_limit = 0; \
+    for (int n = count; n > 1; n >>= 1) { \
+        depth_limit += 2; \
+    } \
+    name##_quick_sort_step(array, 0, count - 1, depth_limit); \
+} \
+\
+static inline void name##_merge_runs(const type* src, type* dst, int st, int mid, int ed) { \
+    /* Merge src[st, mid) and src[mid, ed) into dst[st, ed), left first on ties. */ \
+    if (mid >= ed || !less(&src[mid], &src[mid - 1])) { \
+        memcpy(dst + st, src + st, (ed - st) * sizeof(type)); \
+        SORT_TEMPLATE_ON_MOVE(ed - st); \
+        return; \
+    } \
+    int ptr1 = st; \
+    int ptr2 = mid; \
+    int out = st; \
+    while (ptr1 < mid && ptr2 < ed) { \
+        if (less(&src[ptr2], &src[ptr1])) { \
+            dst[out++] = src[ptr2++]; \
+        } \
+        else { \
+            dst[out++] = src[ptr1++]; \
+        } \
+    } \
+    memcpy(dst + out, src + ptr1, (mid - ptr1) * sizeof(type)); \
+    out += mid - ptr1; \
+    memcpy(dst + out, src + ptr2, (ed - ptr2) * sizeof(type)); \
+    SORT_TEMPLATE_ON_MOVE(ed - st); \
+} \
+\
+static inline void name##_merge_sort_with_buffer(type* array, int count, type* buffer) { \
+    /* Bottom-up merge sort ping-ponging between array and buffer (count elements). */ \
+    if (count < 2) { \
+        return; \
+    } \
+    type* owned = NULL; \
+    if (buffer == NULL) { \
+        owned = malloc(count * sizeof(type)); \
+        if (owned == NULL) { \
+            fprintf(stderr, "Failed to allocate %lu bytes of memory\n", count * sizeof(type)); \
+            return; \
+        } \
+        buffer = owned; \
+    } \
+    /* Pick the run size so the pass count is even and the result ends in array. */ \
+    int passes = 0; \
+    for (long long width = SORT_TEMPLATE_MERGE_RUN; width < count; width *= 2) { \
+        passes++; \
+    } \
+    int run = (passes % 2 == 1) ? SORT_TEMPLATE_MERGE_RUN / 2 : SORT_TEMPLATE_MERGE_RUN; \
+    for (int st = 0; st < count; st += run) { \
+        int len = (count - st < run) ? count - st : run; \
+        name##_insertion_sort(array + st, len); \
+    } \
+    type* src = array; \
+    type* dst = buffer; \
+    for (long long width = run; width < count; width *= 2) { \
+        for (long long st = 0; st < count; st += 2 * width) { \
+            int mid = (st + width < count) ? st + width : count; \
+            int ed = (st + 2 * width < count) ? st + 2 * width : count; \
+            name##_merge_runs(src, dst, st, mid, ed); \
+        } \
+        type* tmp = src; \
+        src = dst; \
+        dst = tmp; \
+    } \
+    free(owned); \
+} \
+\
+static inline void name##_merge_sort(type* array, int count) { \
+    name##_merge_sort_with_buffer(array, count, NULL); \
+}
+
+// Key bytes are sorted 8 bits per pass, least significant first.
+#define SORT_TEMPLATE_RADIX_BUCKETS 256
+
+#define SORT_DEFINE_RADIX(name, type, key_type, key) \
+static inline unsigned long long name##_radix_key(const type* elem) { \
+    /* Signed keys get their sign bit flipped so unsigned order matches. Sign */ \
+    /* extension above the key width is harmless: those bytes are never sorted on. */ \
+    unsigned long long k = (unsigned long long)(key_type)key(elem); \
+    if ((key_type)-1 < (key_type)1) { \
+        k ^= 1ull << (8 * sizeof(key_type) - 1); \
+    } \
+    return k; \
+} \
+\
+static inline void name##_radix_sort(type* array, int count) { \
+    /* LSD radix sort: histograms for every byte in one read, trivial passes skipped. */ \
+    if (count < 2) { \
+        return; \
+    } \
+    type* buffer = malloc(count * sizeof(type)); \
+    if (buffer == NULL) { \
+        fprintf(stderr, "Failed to allocate %lu bytes of memory\n", count * sizeof(type)); \
+        return; \
+    } \
+    int passes = sizeof(key_type); \
+    int histogram[sizeof(key_type)][SORT_TEMPLATE_RADIX_BUCKETS]; \
+    memset(histogram, 0, sizeof(histogram)); \
+    for (int i = 0; i < count; i++) { \
+        unsigned long long k = name##_radix_key(&array[i]); \
+        for (int p = 0; p < passes; p++) { \
+            histogram[p][(k >> (p * 8)) & (SORT_TEMPLATE_RADIX_BUCKETS - 1)]++; \
+        } \
+    } \
+    type* src = array; \
+    type* dst = buffer; \
+    for (int p = 0; p < passes; p++) { \
+        int shift = p * 8; \
+        if (histogram[p][(name##_radix_key(&src[0]) >> shift) & (SORT_TEMPLATE_RADIX_BUCKETS - 1)] == count) { \
+            continue; \
+        } \
+        int offsets[SORT_TEMPLATE_RADIX_BUCKETS]; \
+        int sum = 0; \
+        for (int b = 0; b < SORT_TEMPLATE_RADIX_BUCKETS; b++) { \
+            offsets[b] = sum; \
+            sum += histogram[p][b]; \
+        } \
+        for (int i = 0; i < count; i++) { \
+            dst[offsets[(name##_radix_key(&src[i]) >> shift) & (SORT_TEMPLATE_RADIX_BUCKETS - 1)]++] = src[i]; \
+        } \
+        SORT_TEMPLATE_ON_MOVE(count); \
+        type* tmp = src; \
+        src = dst; \
+        dst = tmp; \
+    } \
+    if (src != array) { \
+        memcpy(array, src, count * sizeof(type)); \
+        SORT_TEMPLATE_ON_MOVE(count); \
+    } \
+    free(buffer); \
+}
+
+#endif
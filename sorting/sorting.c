@@ -1,13 +1,39 @@
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+
+#if (defined(__x86_64__) || defined(__i386__)) && !defined(SORTING_NO_SIMD)
+#include <immintrin.h>
+#include <stdint.h>
+#define SORTING_HAVE_X86_SIMD 1
+#endif
+
+// Build with -DSORT_COUNT to count the element comparisons and moves every sort
+// makes, in sort_comparisons and sort_moves (sorting.h). A move is one element
+// copied into the array, a scratch buffer or a temporary, so a swap is 3; SIMD
+// code counts one comparison per lane pair. Without the flag the hooks are empty.
+#ifdef SORT_COUNT
+#include "sorting.h"
+long long sort_comparisons = 0;
+long long sort_moves = 0;
+#define SORT_CMP(cond) (sort_comparisons++, (cond))
+#define SORT_COMPARED(n) (sort_comparisons += (n))
+#define SORT_MOVED(n) (sort_moves += (n))
+#else
+#define SORT_CMP(cond) (cond)
+#define SORT_COMPARED(n) ((void)0)
+#define SORT_MOVED(n) ((void)0)
+#endif
 
 void bubble_sort(int* array, int count) {
     // Swap elements with its continuous until the array is sorted.
     while(1) {
         int swapped = 0;
         for (int i = 1; i < count; i++) {
-            if (array[i-1] > array[i]) {
+            if (SORT_CMP(array[i-1] > array[i])) {
                 // Swap
+                SORT_MOVED(3);
                 int tmp = array[i-1];
                 array[i-1] = array[i];
                 array[i] = tmp;
@@ -30,12 +56,13 @@ void selection_sort(int* array, int count) {
     for (int st = 0; st < count-1; st++) {
         int min_idx = st; // We start with st as the index with the minimum element.
         for (int i = st; i < count; i++) {
-            if (array[i] < array[min_idx]) {
+            if (SORT_CMP(array[i] < array[min_idx])) {
                 // Update minimum element's index
                 min_idx = i;
             }
         }
         // Swap minimum element with element at starting position.
+        SORT_MOVED(3);
         int tmp = array[st];
         array[st] = array[min_idx];
         array[min_idx] = tmp;
@@ -50,112 +77,1161 @@ void insertion_sort(int* array, int count) {
     for (int i = 1; i < count; i++) {
         int key = array[i];
         int j = i-1;
-        while (j >= 0 && array[j] > key) {
+        while (j >= 0 && SORT_CMP(array[j] > key)) {
             // Keep shifting while we find bigger values
             // Break if we don't or j is out of bounds.
             array[j+1] = array[j];
+            SORT_MOVED(1);
             j--;
         }
         array[j+1] = key; // j+1 because j could be -1
+        SORT_MOVED(2);
     }
 }
 
-void merge(int* array, int st, int mid, int ed) {
-    // Declare extra space for an array where we'll keep the sorted merge
-    // We'll later copy that to the final array.
-    int* extra_space = malloc((ed-st+1) * sizeof(int));
-    // Set one ptr per subarray to compare the elements.
+// Runs of this size are sorted with insertion sort before the merge passes start.
+#define MERGE_RUN_SIZE 32
+
+void merge_runs(const int* src, int* dst, int st, int mid, int ed) {
+    // Merge src[st, mid) and src[mid, ed) into dst[st, ed).
+    if (mid >= ed || SORT_CMP(src[mid-1] <= src[mid])) {
+        // Already in order (or no right run): nothing to compare, just move it across.
+        memcpy(dst + st, src + st, (ed - st) * sizeof(int));
+        SORT_MOVED(ed - st);
+        return;
+    }
     int ptr1 = st;
-    int ptr2 = mid+1;
-    // Set an idx to keep track of wherewe are in the extra space.
-    int extra_idx = 0;
-    while (ptr1 <= mid && ptr2 <= ed) {
-        // Compare and assign the minimum value between arr[ptr1] and arr[ptr2]
-        int res;
-        if (array[ptr1] <= array[ptr2]) {
-            res = array[ptr1];
-            ptr1++;
+    int ptr2 = mid;
+    int out = st;
+    while (ptr1 < mid && ptr2 < ed) {
+        // <= takes from the left run on ties, which keeps the sort stable.
+        SORT_MOVED(1);
+        if (SORT_CMP(src[ptr1] <= src[ptr2])) {
+            dst[out++] = src[ptr1++];
         }
         else {
-            res = array[ptr2];
-            ptr2++;
+            dst[out++] = src[ptr2++];
+        }
+    }
+    // Copy any leftovers; only one of these has anything left.
+    SORT_MOVED((mid - ptr1) + (ed - ptr2));
+    memcpy(dst + out, src + ptr1, (mid - ptr1) * sizeof(int));
+    out += mid - ptr1;
+    memcpy(dst + out, src + ptr2, (ed - ptr2) * sizeof(int));
+}
+
+int merge_pass_count(int count, int run) {
+    // Number of doubling passes needed to grow runs of this size to the whole array.
+    int passes = 0;
+    for (long long width = run; width < count; width *= 2) {
+        passes++;
+    }
+    return passes;
+}
+
+void merge_sort_with_buffer(int* array, int count, int* buffer) {
+    // Bottom-up merge sort. Each pass merges pairs of runs from src into dst and
+    // then the two swap roles, so nothing is copied back between passes.
+    if (count < 2) {
+        return;
+    }
+    int* owned = NULL;
+    if (buffer == NULL) {
+        owned = malloc(count * sizeof(int));
+        if (owned == NULL) {
+            fprintf(stderr, "Failed to allocate %lu bytes of memory\n", count * sizeof(int));
+            return;
         }
-        // Assign to the extra space array.
-        extra_space[extra_idx++] = res;
+        buffer = owned;
     }
-    // Copy and paste any possible leftovers onto the extra space.
-    while (ptr1 <= mid) {
-        extra_space[extra_idx++] = array[ptr1];
-        ptr1++;
+    // Pick the run size so the pass count is even: the last pass then writes
+    // into array itself and we never need a final copy out of the buffer.
+    int run = MERGE_RUN_SIZE;
+    if (merge_pass_count(count, run) % 2 == 1) {
+        run /= 2;
     }
-    while (ptr2 <= ed) {
-        extra_space[extra_idx++] = array[ptr2];
-        ptr2++;
+    for (int st = 0; st < count; st += run) {
+        int len = (count - st < run) ? count - st : run;
+        insertion_sort(array + st, len);
     }
+    int* src = array;
+    int* dst = buffer;
+    for (long long width = run; width < count; width *= 2) {
+        for (long long st = 0; st < count; st += 2 * width) {
+            int mid = (st + width < count) ? st + width : count;
+            int ed = (st + 2 * width < count) ? st + 2 * width : count;
+            merge_runs(src, dst, st, mid, ed);
+        }
+        int* tmp = src;
+        src = dst;
+        dst = tmp;
+    }
+    free(owned);
+}
 
-    // Now, copy from extra space to base array.
-    for (int i = 0 ; i < (ed-st+1); i++) {
-        array[st+i] = extra_space[i];
+void merge_sort(int* array, int count) {
+    // Wrapper to match signature. One allocation for the whole sort.
+    merge_sort_with_buffer(array, count, NULL);
+}
+
+// Partitions at or below this size are finished with insertion sort.
+#define INSERTION_SORT_THRESHOLD 16
+// Above this size the pivot is a ninther (median of three medians-of-3).
+#define NINTHER_THRESHOLD 128
+
+void sift_down(int* array, int root, int count) {
+    // Max-heap sift down: push array[root] down until both children are smaller.
+    int val = array[root];
+    int child = 2 * root + 1;
+    while (child < count) {
+        if (child + 1 < count && SORT_CMP(array[child + 1] > array[child])) {
+            child++; // Take the bigger child
+        }
+        if (SORT_CMP(array[child] <= val)) {
+            break;
+        }
+        array[root] = array[child];
+        SORT_MOVED(1);
+        root = child;
+        child = 2 * root + 1;
     }
-    // After copying, free extra space.
-    free(extra_space);
+    array[root] = val;
+    SORT_MOVED(2);
 }
 
-void merge_sort_step(int* array, int st, int ed) {
-    // Divide and conquer.
-    // Keep dividing the array until you reach base case (individual numbers)
-    // Then, reform bigger and bigger, sorted blocks by merging them, until you merge
-    // the last 2 (2 halves of the original array)
-    if (st >= ed) {
-        return; // 1 element or invalid range
+void heap_sort(int* array, int count) {
+    // Build a max-heap bottom-up in O(n), then repeatedly move the max to the end.
+    for (int i = count / 2 - 1; i >= 0; i--) {
+        sift_down(array, i, count);
+    }
+    for (int end = count - 1; end > 0; end--) {
+        SORT_MOVED(3);
+        int tmp = array[0];
+        array[0] = array[end];
+        array[end] = tmp;
+        sift_down(array, 0, end);
     }
-    int mid = (st+ed)/2; // C rounds down
-    merge_sort_step(array, st, mid);
-    merge_sort_step(array, mid+1, ed);
-    merge(array, st, mid, ed);
 }
 
-void merge_sort(int* array, int count) {
-    // Wrapper to match signature
-    merge_sort_step(array, 0, count-1);
+int median_of_three(int* array, int a, int b, int c) {
+    // Returns the index holding the median of the three values.
+    if (SORT_CMP(array[a] < array[b])) {
+        if (SORT_CMP(array[b] < array[c])) return b;
+        return SORT_CMP(array[a] < array[c]) ? c : a;
+    }
+    if (SORT_CMP(array[a] < array[c])) return a;
+    return SORT_CMP(array[b] < array[c]) ? c : b;
 }
 
-int partition(int* array, int st, int ed) {
-    int pivot = array[ed];
+int choose_pivot(int* array, int st, int ed) {
+    int mid = st + (ed - st) / 2;
+    if (ed - st + 1 < NINTHER_THRESHOLD) {
+        return median_of_three(array, st, mid, ed);
+    }
+    // Tukey's ninther: robust against sorted, reverse and organ-pipe inputs.
+    int step = (ed - st + 1) / 8;
+    int lo = median_of_three(array, st, st + step, st + 2 * step);
+    int md = median_of_three(array, mid - step, mid, mid + step);
+    int hi = median_of_three(array, ed - 2 * step, ed - step, ed);
+    return median_of_three(array, lo, md, hi);
+}
+
+int partition_around(int* array, int st, int ed, int pivot_idx) {
+    // Hoare partition. Moves the pivot to st, then walks two pointers inwards
+    // swapping out-of-place pairs. Elements equal to the pivot stop both pointers,
+    // so all-equal input splits down the middle instead of degrading to O(n^2).
+    // Returns j such that array[st..j] <= pivot <= array[j+1..ed], with st <= j < ed.
+    int pivot = array[pivot_idx];
+    array[pivot_idx] = array[st];
+    array[st] = pivot;
+    SORT_MOVED(3);
+
     int i = st - 1;
-    
-    for (int j = st; j < ed; j++) {
-        if (array[j] <= pivot) {
+    int j = ed + 1;
+    while (1) {
+        do {
             i++;
-            int tmp = array[i];
-            array[i] = array[j];
-            array[j] = tmp;
+        } while (SORT_CMP(array[i] < pivot));
+        do {
+            j--;
+        } while (SORT_CMP(array[j] > pivot));
+        if (i >= j) {
+            return j;
         }
+        SORT_MOVED(3);
+        int tmp = array[i];
+        array[i] = array[j];
+        array[j] = tmp;
     }
-    
-    int tmp = array[i + 1];
-    array[i + 1] = array[ed];
-    array[ed] = tmp;
-    
-    return i + 1;
+}
 
+int partition(int* array, int st, int ed) {
+    return partition_around(array, st, ed, choose_pivot(array, st, ed));
 }
 
-void quick_sort_step(int* array, int st, int ed) {
-    // Divide and conquer
-    if (st >= ed) {
-        // Base case
+// === SIMD KERNELS ===
+// AVX2 bitonic sorting networks for up to 64 ints and a vectorized partition.
+// Compiled with target attributes and picked at runtime, so the library still
+// runs on CPUs without AVX2. Build with -DSORTING_NO_SIMD to compile them out.
+
+// With AVX2, quick_sort hands partitions of this size or smaller to the network.
+#define NETWORK_SORT_MAX 64
+
+#ifdef SORTING_HAVE_X86_SIMD
+
+// Compare-exchange every lane with lane perm[i]; lanes set in mask keep the max.
+#define SIMD_EXCHANGE(v, perm, mask) \
+    _mm256_blend_epi32(_mm256_min_epi32((v), _mm256_permutevar8x32_epi32((v), (perm))), \
+                       _mm256_max_epi32((v), _mm256_permutevar8x32_epi32((v), (perm))), (mask))
+
+__attribute__((target("avx2")))
+__m256i simd_sort8(__m256i v) {
+    // Full bitonic sort of one register: 6 compare-exchange stages.
+    __m256i p1 = _mm256_setr_epi32(1, 0, 3, 2, 5, 4, 7, 6);
+    __m256i p2 = _mm256_setr_epi32(2, 3, 0, 1, 6, 7, 4, 5);
+    __m256i p4 = _mm256_setr_epi32(4, 5, 6, 7, 0, 1, 2, 3);
+    SORT_COMPARED(6 * 4);
+    v = SIMD_EXCHANGE(v, p1, 0x66); // Pairs, alternating direction
+    v = SIMD_EXCHANGE(v, p2, 0x3C); // Quads, alternating direction
+    v = SIMD_EXCHANGE(v, p1, 0x5A);
+    v = SIMD_EXCHANGE(v, p4, 0xF0); // Whole register ascending
+    v = SIMD_EXCHANGE(v, p2, 0xCC);
+    v = SIMD_EXCHANGE(v, p1, 0xAA);
+    return v;
+}
+
+__attribute__((target("avx2")))
+__m256i simd_merge8(__m256i v) {
+    // Sorts a register that holds a bitonic sequence.
+    __m256i p1 = _mm256_setr_epi32(1, 0, 3, 2, 5, 4, 7, 6);
+    __m256i p2 = _mm256_setr_epi32(2, 3, 0, 1, 6, 7, 4, 5);
+    __m256i p4 = _mm256_setr_epi32(4, 5, 6, 7, 0, 1, 2, 3);
+    SORT_COMPARED(3 * 4);
+    v = SIMD_EXCHANGE(v, p4, 0xF0);
+    v = SIMD_EXCHANGE(v, p2, 0xCC);
+    v = SIMD_EXCHANGE(v, p1, 0xAA);
+    return v;
+}
+
+__attribute__((target("avx2")))
+void simd_sort_registers(__m256i* v, int regs) {
+    // Sort each register, then bitonic-merge blocks of 1, 2, 4 registers.
+    __m256i reverse = _mm256_setr_epi32(7, 6, 5, 4, 3, 2, 1, 0);
+    for (int r = 0; r < regs; r++) {
+        v[r] = simd_sort8(v[r]);
+    }
+    for (int w = 1; w < regs; w *= 2) {
+        for (int b = 0; b < regs; b += 2 * w) {
+            // Sorted block A = v[b, b+w), sorted block B = v[b+w, b+2w).
+            // Compare A against reversed B: the lows and the highs are each bitonic.
+            __m256i lo[NETWORK_SORT_MAX / 16];
+            __m256i hi[NETWORK_SORT_MAX / 16];
+            for (int i = 0; i < w; i++) {
+                __m256i rb = _mm256_permutevar8x32_epi32(v[b + 2 * w - 1 - i], reverse);
+                lo[i] = _mm256_min_epi32(v[b + i], rb);
+                hi[i] = _mm256_max_epi32(v[b + i], rb);
+                SORT_COMPARED(8);
+            }
+            for (int i = 0; i < w; i++) {
+                v[b + i] = lo[i];
+                v[b + w + i] = hi[i];
+            }
+            // Half-cleaners across registers, then finish inside each register.
+            for (int h = b; h < b + 2 * w; h += w) {
+                for (int d = w / 2; d >= 1; d /= 2) {
+                    for (int i = h; i < h + w; i++) {
+                        if (((i - h) & d) == 0) {
+                            __m256i x = v[i];
+                            v[i] = _mm256_min_epi32(x, v[i + d]);
+                            v[i + d] = _mm256_max_epi32(x, v[i + d]);
+                            SORT_COMPARED(8);
+                        }
+                    }
+                }
+                for (int i = h; i < h + w; i++) {
+                    v[i] = simd_merge8(v[i]);
+                }
+            }
+        }
+    }
+}
+
+__attribute__((target("avx2")))
+void network_sort_avx2(int* array, int count) {
+    // Pad up to a power-of-two number of registers with INT_MAX, which sorts last.
+    int tmp[NETWORK_SORT_MAX];
+    __m256i v[NETWORK_SORT_MAX / 8];
+    int regs = 1;
+    while (regs * 8 < count) {
+        regs *= 2;
+    }
+    memcpy(tmp, array, count * sizeof(int));
+    SORT_MOVED(2 * count); // Into the registers and back out
+    for (int i = count; i < regs * 8; i++) {
+        tmp[i] = INT_MAX;
+    }
+    for (int r = 0; r < regs; r++) {
+        v[r] = _mm256_loadu_si256((const __m256i*)(tmp + 8 * r));
+    }
+    simd_sort_registers(v, regs);
+    for (int r = 0; r < regs; r++) {
+        _mm256_storeu_si256((__m256i*)(tmp + 8 * r), v[r]);
+    }
+    memcpy(array, tmp, count * sizeof(int));
+}
+
+__attribute__((target("avx2,bmi2")))
+__m256i simd_partition_perm(int right_mask) {
+    // Permutation that packs the lanes going left to the front (in order) and the
+    // lanes going right to the back. Built with pdep/pext instead of a 8KB table.
+    const uint64_t identity = 0x0706050403020100ULL;
+    uint64_t left_lanes = _pdep_u64(~right_mask & 0xFF, 0x0101010101010101ULL) * 0xFF;
+    uint64_t right_lanes = _pdep_u64(right_mask, 0x0101010101010101ULL) * 0xFF;
+    int num_left = 8 - __builtin_popcount(right_mask);
+    uint64_t packed = _pext_u64(identity, left_lanes)
+                    | (_pext_u64(identity, right_lanes) << ((num_left * 8) & 63));
+    return _mm256_cvtepu8_epi32(_mm_cvtsi64_si128((long long)packed));
+}
+
+__attribute__((target("avx2,bmi2")))
+int partition_avx2(int* array, int st, int ed, int pivot, int take_equal) {
+    // In-place vectorized partition of array[st..ed]. Elements > pivot (or >= pivot
+    // when take_equal) move to the back. Returns the index of the first of those.
+    // The first and last 8 elements are set aside so each side always has 8 free
+    // slots for full-width stores; we read next from whichever side has less room.
+    int count = ed - st + 1;
+    __m256i pv = _mm256_set1_epi32(pivot);
+    if (count < 16) {
+        int i = st;
+        for (int j = st; j <= ed; j++) {
+            int goes_right = SORT_CMP(take_equal ? (array[j] >= pivot) : (array[j] > pivot));
+            if (!goes_right) {
+                SORT_MOVED(3);
+                int tmp = array[i];
+                array[i] = array[j];
+                array[j] = tmp;
+                i++;
+            }
+        }
+        return i;
+    }
+    int saved[16];
+    memcpy(saved, array + st, 8 * sizeof(int));
+    memcpy(saved + 8, array + ed - 7, 8 * sizeof(int));
+    SORT_MOVED(16);
+    int read_left = st + 8;
+    int read_right = ed + 1 - 8;
+    int write_left = st;
+    int write_right = ed + 1;
+    while (read_right - read_left >= 8) {
+        __m256i v;
+        if (read_left - write_left <= write_right - read_right) {
+            v = _mm256_loadu_si256((const __m256i*)(array + read_left));
+            read_left += 8;
+        }
+        else {
+            read_right -= 8;
+            v = _mm256_loadu_si256((const __m256i*)(array + read_right));
+        }
+        int mask = take_equal
+            ? (~_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(pv, v))) & 0xFF)
+            : _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(v, pv)));
+        __m256i packed = _mm256_permutevar8x32_epi32(v, simd_partition_perm(mask));
+        int num_right = __builtin_popcount(mask);
+        SORT_COMPARED(8);
+        SORT_MOVED(8);
+        _mm256_storeu_si256((__m256i*)(array + write_left), packed);
+        _mm256_storeu_si256((__m256i*)(array + write_right - 8), packed);
+        write_left += 8 - num_right;
+        write_right -= num_right;
+    }
+    // Fewer than 8 unread elements plus the 16 set aside: place them one at a time.
+    int rest[24];
+    int num_rest = read_right - read_left;
+    memcpy(rest, array + read_left, num_rest * sizeof(int));
+    memcpy(rest + num_rest, saved, 16 * sizeof(int));
+    num_rest += 16;
+    SORT_MOVED(num_rest);
+    for (int i = 0; i < num_rest; i++) {
+        SORT_MOVED(1);
+        int goes_right = SORT_CMP(take_equal ? (rest[i] >= pivot) : (rest[i] > pivot));
+        if (goes_right) {
+            array[--write_right] = rest[i];
+        }
+        else {
+            array[write_left++] = rest[i];
+        }
+    }
+    return write_left;
+}
+
+#endif
+
+int sorting_has_simd() {
+#ifdef SORTING_HAVE_X86_SIMD
+    return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("bmi2");
+#else
+    return 0;
+#endif
+}
+
+void quick_sort_step(int* array, int st, int ed, int depth_limit, int use_simd) {
+    // Introsort. Loop on the larger side and recurse only into the smaller one,
+    // so the stack never holds more than log2(n) frames.
+    int leaf_size = use_simd ? NETWORK_SORT_MAX : INSERTION_SORT_THRESHOLD;
+    while (ed - st + 1 > leaf_size) {
+        if (depth_limit == 0) {
+            // Too many bad pivots: heapsort keeps the worst case at O(n log n).
+            heap_sort(array + st, ed - st + 1);
+            return;
+        }
+        depth_limit--;
+#ifdef SORTING_HAVE_X86_SIMD
+        if (use_simd) {
+            int pivot = array[choose_pivot(array, st, ed)];
+            int split = partition_avx2(array, st, ed, pivot, 0);
+            if (split > ed) {
+                // Nothing is bigger than the pivot. Split off the copies of the
+                // pivot instead; they are already in their final place.
+                ed = partition_avx2(array, st, ed, pivot, 1) - 1;
+                continue;
+            }
+            // Left side holds the pivot and right side is non-empty: both shrink.
+            if (split - st < ed - split + 1) {
+                quick_sort_step(array, st, split - 1, depth_limit, use_simd);
+                st = split;
+            }
+            else {
+                quick_sort_step(array, split, ed, depth_limit, use_simd);
+                ed = split - 1;
+            }
+            continue;
+        }
+#endif
+        int split = partition(array, st, ed);
+        if (split - st < ed - split) {
+            quick_sort_step(array, st, split, depth_limit, use_simd);
+            st = split + 1;
+        }
+        else {
+            quick_sort_step(array, split + 1, ed, depth_limit, use_simd);
+            ed = split;
+        }
+    }
+#ifdef SORTING_HAVE_X86_SIMD
+    if (use_simd) {
+        // Small partitions go through the sorting network, branch-free.
+        if (ed >= st) {
+            network_sort_avx2(array + st, ed - st + 1);
+        }
         return;
     }
-    int pivot_idx = partition(array, st, ed);
-    // Knowing the pivot idx, we know where the left and right portions are.
-    // We do not include pivot_idx in either because it already is in its place after
-    // the partition function.
-    quick_sort_step(array, st, pivot_idx -1);
-    quick_sort_step(array, pivot_idx +1, ed);
+#endif
+    // Small partitions: insertion sort beats more partitioning.
+    insertion_sort(array + st, ed - st + 1);
 }
 
 void quick_sort(int* array, int count) {
     // Wrapper to keep the API equal.
-    quick_sort_step(array, 0, count-1);
-}
\ No newline at end of file
+    // Depth limit of 2 * floor(log2(n)) before falling back to heapsort.
+    int depth_limit = 0;
+    for (int n = count; n > 1; n >>= 1) {
+        depth_limit += 2;
+    }
+    quick_sort_step(array, 0, count-1, depth_limit, sorting_has_simd());
+}
+
+
+void network_sort(int* array, int count) {
+#ifdef SORTING_HAVE_X86_SIMD
+    if (count <= NETWORK_SORT_MAX && sorting_has_simd()) {
+        network_sort_avx2(array, count);
+        return;
+    }
+#endif
+    if (count > NETWORK_SORT_MAX) {
+        quick_sort(array, count);
+        return;
+    }
+    insertion_sort(array, count);
+}
+
+// === SELECTION ===
+// Introselect: quickselect on the quick_sort pivots and partitions, switching to
+// median-of-medians pivots after 2*log2(n) rounds so the worst case stays O(n).
+
+int median_of_medians(int* array, int st, int ed, int use_simd);
+void select_step(int* array, int st, int ed, int n, int depth_limit, int use_simd);
+
+void select_partition(int* array, int st, int ed, int pivot_idx, int use_simd, int* left_ed, int* right_st) {
+    // One partition round for selection. Afterwards array[st..left_ed] <= every
+    // element of array[left_ed+1..right_st-1] <= array[right_st..ed], and the
+    // middle block (possibly empty) is already in its sorted position.
+    // Both outer sides are strictly smaller than the range.
+#ifdef SORTING_HAVE_X86_SIMD
+    if (use_simd) {
+        int pivot = array[pivot_idx];
+        int split = partition_avx2(array, st, ed, pivot, 0);
+        if (split <= ed) {
+            *left_ed = split - 1;
+            *right_st = split;
+            return;
+        }
+        // Nothing is bigger than the pivot: split off its copies, which are final.
+        *left_ed = partition_avx2(array, st, ed, pivot, 1) - 1;
+        *right_st = ed + 1;
+        return;
+    }
+#endif
+    (void)use_simd;
+    int split = partition_around(array, st, ed, pivot_idx);
+    *left_ed = split;
+    *right_st = split + 1;
+}
+
+int median_of_medians(int* array, int st, int ed, int use_simd) {
+    // Pivot guaranteed to have at least ~30% of the range on each side: sort
+    // groups of 5, gather their medians at the front, select the median of those.
+    int count = ed - st + 1;
+    if (count <= 5) {
+        insertion_sort(array + st, count);
+        return st + count / 2;
+    }
+    int num_medians = 0;
+    for (int g = st; g + 4 <= ed; g += 5) {
+        insertion_sort(array + g, 5);
+        SORT_MOVED(3);
+        int tmp = array[st + num_medians];
+        array[st + num_medians] = array[g + 2];
+        array[g + 2] = tmp;
+        num_medians++;
+    }
+    int mid = st + num_medians / 2;
+    select_step(array, st, st + num_medians - 1, mid, 0, use_simd);
+    return mid;
+}
+
+void select_step(int* array, int st, int ed, int n, int depth_limit, int use_simd) {
+    // Narrow [st, ed] down to the side holding position n until it is small.
+    while (ed - st + 1 > INSERTION_SORT_THRESHOLD) {
+        int pivot_idx;
+        if (depth_limit == 0) {
+            pivot_idx = median_of_medians(array, st, ed, use_simd);
+        }
+        else {
+            depth_limit--;
+            pivot_idx = choose_pivot(array, st, ed);
+        }
+        int left_ed, right_st;
+        select_partition(array, st, ed, pivot_idx, use_simd, &left_ed, &right_st);
+        if (n <= left_ed) {
+            ed = left_ed;
+        }
+        else if (n >= right_st) {
+            st = right_st;
+        }
+        else {
+            return; // n landed in the block of pivot copies
+        }
+    }
+    insertion_sort(array + st, ed - st + 1);
+}
+
+int select_depth_limit(int count) {
+    // Same budget as quick_sort before switching to the guaranteed pivot.
+    int depth_limit = 0;
+    for (int n = count; n > 1; n >>= 1) {
+        depth_limit += 2;
+    }
+    return depth_limit;
+}
+
+void nth_element(int* array, int count, int n) {
+    if (n < 0 || n >= count) {
+        fprintf(stderr, "ERROR - nth_element index %d out of range for %d elements\n", n, count);
+        return;
+    }
+    select_step(array, 0, count - 1, n, select_depth_limit(count), sorting_has_simd());
+}
+
+void partial_sort(int* array, int count, int k) {
+    // O(n + k log k): select the k-th smallest, then sort only the front.
+    if (k > count) {
+        k = count;
+    }
+    if (k <= 0) {
+        return;
+    }
+    if (k < count) {
+        nth_element(array, count, k - 1);
+    }
+    quick_sort(array, k);
+}
+
+void multi_select_step(int* array, int st, int ed, const int* ranks, int lo, int hi, int depth_limit, int use_simd) {
+    // ranks[lo, hi) are sorted and all fall in [st, ed]. Every partition is
+    // shared by all the ranks in the range, and sides holding no ranks are dropped.
+    while (lo < hi) {
+        if (ed - st + 1 <= INSERTION_SORT_THRESHOLD) {
+            insertion_sort(array + st, ed - st + 1);
+            return;
+        }
+        if (hi - lo == 1) {
+            select_step(array, st, ed, ranks[lo], depth_limit, use_simd);
+            return;
+        }
+        int pivot_idx;
+        if (depth_limit == 0) {
+            pivot_idx = median_of_medians(array, st, ed, use_simd);
+        }
+        else {
+            depth_limit--;
+            pivot_idx = choose_pivot(array, st, ed);
+        }
+        int left_ed, right_st;
+        select_partition(array, st, ed, pivot_idx, use_simd, &left_ed, &right_st);
+        // Ranks up to left_ed go left, ranks from right_st go right; any in
+        // between are already final.
+        int mid = lo;
+        while (mid < hi && ranks[mid] <= left_ed) {
+            mid++;
+        }
+        int right = mid;
+        while (right < hi && ranks[right] < right_st) {
+            right++;
+        }
+        multi_select_step(array, st, left_ed, ranks, lo, mid, depth_limit, use_simd);
+        st = right_st;
+        lo = right;
+    }
+}
+
+void multi_select(int* array, int count, const int* ranks, int num_ranks) {
+    if (num_ranks <= 0) {
+        return;
+    }
+    int* sorted_ranks = malloc(num_ranks * sizeof(int));
+    if (sorted_ranks == NULL) {
+        fprintf(stderr, "Failed to allocate %lu bytes of memory\n", num_ranks * sizeof(int));
+        return;
+    }
+    for (int i = 0; i < num_ranks; i++) {
+        if (ranks[i] < 0 || ranks[i] >= count) {
+            fprintf(stderr, "ERROR - multi_select rank %d out of range for %d elements\n", ranks[i], count);
+            free(sorted_ranks);
+            return;
+        }
+        sorted_ranks[i] = ranks[i];
+    }
+    quick_sort(sorted_ranks, num_ranks);
+    multi_select_step(array, 0, count - 1, sorted_ranks, 0, num_ranks, select_depth_limit(count), sorting_has_simd());
+    free(sorted_ranks);
+}
+
+
+// Radix sorts use 8-bit digits: 256 buckets keep the histograms in L1.
+#define RADIX_BITS 8
+#define RADIX_BUCKETS (1 << RADIX_BITS)
+// American flag sort hands buckets this small to insertion sort.
+#define RADIX_INSERTION_THRESHOLD 64
+
+unsigned int radix_key(int val) {
+    // Flipping the sign bit makes signed order match unsigned order:
+    // INT_MIN -> 0x00000000, -1 -> 0x7FFFFFFF, 0 -> 0x80000000.
+    return (unsigned int)val ^ 0x80000000u;
+}
+
+unsigned long long radix_key64(long long val) {
+    return (unsigned long long)val ^ 0x8000000000000000ull;
+}
+
+void radix_sort_with_buffer(int* array, int count, int* buffer) {
+    // LSD radix sort, 4 passes of 8 bits. All four histograms are built in a
+    // single read of the input; a pass whose digit is the same for every key
+    // (e.g. the high bytes of small IDs) is skipped entirely.
+    if (count < 2) {
+        return;
+    }
+    int* owned = NULL;
+    if (buffer == NULL) {
+        owned = malloc(count * sizeof(int));
+        if (owned == NULL) {
+            fprintf(stderr, "Failed to allocate %lu bytes of memory\n", count * sizeof(int));
+            return;
+        }
+        buffer = owned;
+    }
+    int passes = sizeof(int);
+    int histogram[sizeof(int)][RADIX_BUCKETS] = {{0}};
+    for (int i = 0; i < count; i++) {
+        unsigned int key = radix_key(array[i]);
+        for (int p = 0; p < passes; p++) {
+            histogram[p][(key >> (p * RADIX_BITS)) & (RADIX_BUCKETS - 1)]++;
+        }
+    }
+    int* src = array;
+    int* dst = buffer;
+    for (int p = 0; p < passes; p++) {
+        int shift = p * RADIX_BITS;
+        if (histogram[p][(radix_key(src[0]) >> shift) & (RADIX_BUCKETS - 1)] == count) {
+            continue; // Trivial pass: every key has the same digit here.
+        }
+        // Turn counts into starting offsets.
+        int offsets[RADIX_BUCKETS];
+        int sum = 0;
+        for (int b = 0; b < RADIX_BUCKETS; b++) {
+            offsets[b] = sum;
+            sum += histogram[p][b];
+        }
+        for (int i = 0; i < count; i++) {
+            dst[offsets[(radix_key(src[i]) >> shift) & (RADIX_BUCKETS - 1)]++] = src[i];
+        }
+        SORT_MOVED(count);
+        int* tmp = src;
+        src = dst;
+        dst = tmp;
+    }
+    if (src != array) {
+        // Odd number of real passes: the result is sitting in the buffer.
+        memcpy(array, src, count * sizeof(int));
+        SORT_MOVED(count);
+    }
+    free(owned);
+}
+
+void radix_sort(int* array, int count) {
+    radix_sort_with_buffer(array, count, NULL);
+}
+
+void radix_sort64(long long* array, int count) {
+    // Same as radix_sort, with 8 passes over 64-bit keys.
+    if (count < 2) {
+        return;
+    }
+    long long* buffer = malloc(count * sizeof(long long));
+    if (buffer == NULL) {
+        fprintf(stderr, "Failed to allocate %lu bytes of memory\n", count * sizeof(long long));
+        return;
+    }
+    int passes = sizeof(long long);
+    int (*histogram)[RADIX_BUCKETS] = calloc(passes, sizeof(*histogram));
+    if (histogram == NULL) {
+        fprintf(stderr, "Failed to allocate %lu bytes of memory\n", passes * sizeof(*histogram));
+        free(buffer);
+        return;
+    }
+    for (int i = 0; i < count; i++) {
+        unsigned long long key = radix_key64(array[i]);
+        for (int p = 0; p < passes; p++) {
+            histogram[p][(key >> (p * RADIX_BITS)) & (RADIX_BUCKETS - 1)]++;
+        }
+    }
+    long long* src = array;
+    long long* dst = buffer;
+    for (int p = 0; p < passes; p++) {
+        int shift = p * RADIX_BITS;
+        if (histogram[p][(radix_key64(src[0]) >> shift) & (RADIX_BUCKETS - 1)] == count) {
+            continue;
+        }
+        int offsets[RADIX_BUCKETS];
+        int sum = 0;
+        for (int b = 0; b < RADIX_BUCKETS; b++) {
+            offsets[b] = sum;
+            sum += histogram[p][b];
+        }
+        for (int i = 0; i < count; i++) {
+            dst[offsets[(radix_key64(src[i]) >> shift) & (RADIX_BUCKETS - 1)]++] = src[i];
+        }
+        SORT_MOVED(count);
+        long long* tmp = src;
+        src = dst;
+        dst = tmp;
+    }
+    if (src != array) {
+        memcpy(array, src, count * sizeof(long long));
+        SORT_MOVED(count);
+    }
+    free(histogram);
+    free(buffer);
+}
+
+void american_flag_step(int* array, int count, int shift) {
+    // One MSD level: count the digit, then permute in place by cycling each
+    // misplaced element to the next free slot of its bucket.
+    if (count <= RADIX_INSERTION_THRESHOLD) {
+        insertion_sort(array, count);
+        return;
+    }
+    int counts[RADIX_BUCKETS] = {0};
+    for (int i = 0; i < count; i++) {
+        counts[(radix_key(array[i]) >> shift) & (RADIX_BUCKETS - 1)]++;
+    }
+    int next[RADIX_BUCKETS];  // Next unfilled slot of each bucket
+    int ends[RADIX_BUCKETS];  // One past the end of each bucket
+    int sum = 0;
+    for (int b = 0; b < RADIX_BUCKETS; b++) {
+        next[b] = sum;
+        sum += counts[b];
+        ends[b] = sum;
+    }
+    for (int b = 0; b < RADIX_BUCKETS; b++) {
+        while (next[b] < ends[b]) {
+            int val = array[next[b]];
+            int digit = (radix_key(val) >> shift) & (RADIX_BUCKETS - 1);
+            // Keep swapping until something that belongs in bucket b lands here.
+            while (digit != b) {
+                int tmp = array[next[digit]];
+                array[next[digit]++] = val;
+                val = tmp;
+                SORT_MOVED(3);
+                digit = (radix_key(val) >> shift) & (RADIX_BUCKETS - 1);
+            }
+            array[next[b]++] = val;
+            SORT_MOVED(2);
+        }
+    }
+    if (shift == 0) {
+        return; // Last digit done, buckets are fully sorted.
+    }
+    int st = 0;
+    for (int b = 0; b < RADIX_BUCKETS; b++) {
+        if (counts[b] > 1) {
+            american_flag_step(array + st, counts[b], shift - RADIX_BITS);
+        }
+        st += counts[b];
+    }
+}
+
+void radix_sort_inplace(int* array, int count) {
+    // MSD radix sort (American flag sort): no scratch buffer, recursion depth <= 4.
+    american_flag_step(array, count, (sizeof(int) - 1) * RADIX_BITS);
+}
+
+
+// Natural runs shorter than this are extended with binary insertion sort.
+#define POWER_MIN_RUN 32
+// Consecutive wins from one side before a merge switches to galloping.
+#define POWER_MIN_GALLOP 7
+
+typedef struct PowerRun {
+    int start;
+    int len;
+    int power; // Power of the boundary between this run and the next one
+} PowerRun;
+
+int gallop_upper(const int* array, int count, int key) {
+    // Number of leading elements <= key. Exponential probe from the front
+    // (1, 3, 7, ...), then binary search inside the last gap.
+    if (count == 0 || SORT_CMP(array[0] > key)) {
+        return 0;
+    }
+    int lo = 0;      // array[lo] <= key
+    int hi = 1;
+    while (hi < count && SORT_CMP(array[hi] <= key)) {
+        lo = hi;
+        hi = 2 * hi + 1;
+    }
+    if (hi > count) {
+        hi = count;
+    }
+    lo++;
+    while (lo < hi) {
+        int mid = lo + (hi - lo) / 2;
+        if (SORT_CMP(array[mid] <= key)) lo = mid + 1;
+        else hi = mid;
+    }
+    return lo;
+}
+
+int gallop_lower(const int* array, int count, int key) {
+    // Number of leading elements < key, probing from the front.
+    if (count == 0 || SORT_CMP(array[0] >= key)) {
+        return 0;
+    }
+    int lo = 0;
+    int hi = 1;
+    while (hi < count && SORT_CMP(array[hi] < key)) {
+        lo = hi;
+        hi = 2 * hi + 1;
+    }
+    if (hi > count) {
+        hi = count;
+    }
+    lo++;
+    while (lo < hi) {
+        int mid = lo + (hi - lo) / 2;
+        if (SORT_CMP(array[mid] < key)) lo = mid + 1;
+        else hi = mid;
+    }
+    return lo;
+}
+
+int gallop_upper_from_end(const int* array, int count, int key) {
+    // Same result as gallop_upper, but probes from the back.
+    if (count == 0 || SORT_CMP(array[count - 1] <= key)) {
+        return count;
+    }
+    int hi = count - 1; // array[hi] > key
+    int step = 1;
+    int lo = hi - step;
+    while (lo >= 0 && SORT_CMP(array[lo] > key)) {
+        hi = lo;
+        step = 2 * step + 1;
+        lo = hi - step;
+    }
+    if (lo < 0) {
+        lo = -1;
+    }
+    // Answer is in (lo, hi].
+    lo++;
+    while (lo < hi) {
+        int mid = lo + (hi - lo) / 2;
+        if (SORT_CMP(array[mid] <= key)) lo = mid + 1;
+        else hi = mid;
+    }
+    return lo;
+}
+
+int gallop_lower_from_end(const int* array, int count, int key) {
+    // Same result as gallop_lower, but probes from the back.
+    if (count == 0 || SORT_CMP(array[count - 1] < key)) {
+        return count;
+    }
+    int hi = count - 1; // array[hi] >= key
+    int step = 1;
+    int lo = hi - step;
+    while (lo >= 0 && SORT_CMP(array[lo] >= key)) {
+        hi = lo;
+        step = 2 * step + 1;
+        lo = hi - step;
+    }
+    if (lo < 0) {
+        lo = -1;
+    }
+    lo++;
+    while (lo < hi) {
+        int mid = lo + (hi - lo) / 2;
+        if (SORT_CMP(array[mid] < key)) lo = mid + 1;
+        else hi = mid;
+    }
+    return lo;
+}
+
+void power_merge_lo(int* array, int st, int mid, int ed, int* buffer) {
+    // Left run is the shorter one: move it to the buffer and merge front to back.
+    int len_a = mid - st;
+    memcpy(buffer, array + st, len_a * sizeof(int));
+    SORT_MOVED(len_a);
+    int i = 0;   // Next in the buffered left run
+    int j = mid; // Next in the right run
+    int k = st;  // Next output slot, never passes j
+    int a_wins = 0;
+    int b_wins = 0;
+    while (i < len_a && j < ed) {
+        SORT_MOVED(1);
+        if (SORT_CMP(array[j] < buffer[i])) {
+            array[k++] = array[j++];
+            b_wins++;
+            a_wins = 0;
+            if (b_wins >= POWER_MIN_GALLOP) {
+                // Right run keeps winning: move every element < buffer[i] in one go.
+                int run = gallop_lower(array + j, ed - j, buffer[i]);
+                memmove(array + k, array + j, run * sizeof(int));
+                SORT_MOVED(run);
+                k += run;
+                j += run;
+                b_wins = 0;
+            }
+        }
+        else {
+            // Ties take from the left run, which keeps the sort stable.
+            array[k++] = buffer[i++];
+            a_wins++;
+            b_wins = 0;
+            if (a_wins >= POWER_MIN_GALLOP && j < ed) {
+                int run = gallop_upper(buffer + i, len_a - i, array[j]);
+                memcpy(array + k, buffer + i, run * sizeof(int));
+                SORT_MOVED(run);
+                k += run;
+                i += run;
+                a_wins = 0;
+            }
+        }
+    }
+    // Whatever is left of the right run is already in place.
+    memcpy(array + k, buffer + i, (len_a - i) * sizeof(int));
+    SORT_MOVED(len_a - i);
+}
+
+void power_merge_hi(int* array, int st, int mid, int ed, int* buffer) {
+    // Right run is the shorter one: move it to the buffer and merge back to front.
+    int len_b = ed - mid;
+    memcpy(buffer, array + mid, len_b * sizeof(int));
+    SORT_MOVED(len_b);
+    int i = mid - 1;   // Last unmerged element of the left run
+    int j = len_b - 1; // Last unmerged element of the buffered right run
+    int k = ed - 1;    // Next output slot, from the back
+    int a_wins = 0;
+    int b_wins = 0;
+    while (i >= st && j >= 0) {
+        SORT_MOVED(1);
+        if (SORT_CMP(array[i] > buffer[j])) {
+            array[k--] = array[i--];
+            a_wins++;
+            b_wins = 0;
+            if (a_wins >= POWER_MIN_GALLOP && i >= st) {
+                // Move every left element > buffer[j] in one go.
+                int len = i - st + 1;
+                int run = len - gallop_upper_from_end(array + st, len, buffer[j]);
+                memmove(array + k - run + 1, array + i - run + 1, run * sizeof(int));
+                SORT_MOVED(run);
+                k -= run;
+                i -= run;
+                a_wins = 0;
+            }
+        }
+        else {
+            // Ties take from the right run first when filling from the back.
+            array[k--] = buffer[j--];
+            b_wins++;
+            a_wins = 0;
+            if (b_wins >= POWER_MIN_GALLOP && j >= 0) {
+                int run = (j + 1) - gallop_lower_from_end(buffer, j + 1, array[i]);
+                memcpy(array + k - run + 1, buffer + j - run + 1, run * sizeof(int));
+                SORT_MOVED(run);
+                k -= run;
+                j -= run;
+                b_wins = 0;
+            }
+        }
+    }
+    // Whatever is left of the left run is already in place.
+    memcpy(array + st, buffer, (j + 1) * sizeof(int));
+    SORT_MOVED(j + 1);
+}
+
+void power_merge(int* array, int st, int mid, int ed, int* buffer) {
+    // Trim the parts that are already in place before touching the buffer:
+    // left elements <= the first right element, right elements >= the last left one.
+    st += gallop_upper(array + st, mid - st, array[mid]);
+    if (st == mid) {
+        return;
+    }
+    ed = mid + gallop_lower(array + mid, ed - mid, array[mid - 1]);
+    if (mid - st <= ed - mid) {
+        power_merge_lo(array, st, mid, ed, buffer);
+    }
+    else {
+        power_merge_hi(array, st, mid, ed, buffer);
+    }
+}
+
+int power_count_run(int* array, int st, int count) {
+    // Length of the natural run starting at st. Strictly descending runs are
+    // reversed in place (strict, so equal elements never swap order).
+    int ed = st + 1;
+    if (ed == count) {
+        return 1;
+    }
+    if (SORT_CMP(array[ed] < array[st])) {
+        while (ed + 1 < count && SORT_CMP(array[ed + 1] < array[ed])) {
+            ed++;
+        }
+        for (int lo = st, hi = ed; lo < hi; lo++, hi--) {
+            SORT_MOVED(3);
+            int tmp = array[lo];
+            array[lo] = array[hi];
+            array[hi] = tmp;
+        }
+    }
+    else {
+        while (ed + 1 < count && SORT_CMP(array[ed + 1] >= array[ed])) {
+            ed++;
+        }
+    }
+    return ed - st + 1;
+}
+
+void binary_insertion_sort(int* array, int count, int sorted) {
+    // array[0, sorted) is already sorted; insert the rest after any equal keys.
+    for (int i = sorted; i < count; i++) {
+        int key = array[i];
+        int pos = gallop_upper(array, i, key);
+        memmove(array + pos + 1, array + pos, (i - pos) * sizeof(int));
+        array[pos] = key;
+        SORT_MOVED(i - pos + 2);
+    }
+}
+
+int power_of_boundary(int st1, int len1, int len2, int count) {
+    // Powersort node power: depth at which the midpoints of two adjacent runs
+    // fall into different halves of [0, count), i.e. the first differing bit of
+    // mid1/count and mid2/count. Everything is scaled by 2 to stay integral.
+    int power = 0;
+    long long a = 2LL * st1 + len1;
+    long long b = a + len1 + len2;
+    while (1) {
+        power++;
+        if (a >= count) {
+            a -= count;
+            b -= count;
+        }
+        else if (b >= count) {
+            break;
+        }
+        a <<= 1;
+        b <<= 1;
+    }
+    return power;
+}
+
+void power_sort(int* array, int count) {
+    // Stable natural merge sort with the powersort merge policy: runs are merged
+    // as soon as the boundary to their right is shallower than the one to their
+    // left, which gives near-optimal merge costs for any run length profile.
+    if (count < 2) {
+        return;
+    }
+    int* buffer = malloc((count / 2 + 1) * sizeof(int));
+    if (buffer == NULL) {
+        fprintf(stderr, "Failed to allocate %lu bytes of memory\n", (count / 2 + 1) * sizeof(int));
+        return;
+    }
+    // Powers are strictly increasing up the stack, so the depth is at most ~log2(n).
+    PowerRun stack[64];
+    int size = 0;
+    int st = 0;
+    while (st < count) {
+        int len = power_count_run(array, st, count);
+        if (len < POWER_MIN_RUN) {
+            int forced = (count - st < POWER_MIN_RUN) ? count - st : POWER_MIN_RUN;
+            binary_insertion_sort(array + st, forced, len);
+            len = forced;
+        }
+        if (size > 0) {
+            int power = power_of_boundary(stack[size - 1].start, stack[size - 1].len, len, count);
+            while (size > 1 && stack[size - 2].power > power) {
+                PowerRun* left = &stack[size - 2];
+                PowerRun* right = &stack[size - 1];
+                power_merge(array, left->start, right->start, right->start + right->len, buffer);
+                left->len += right->len;
+                size--;
+            }
+            stack[size - 1].power = power;
+        }
+        stack[size].start = st;
+        stack[size].len = len;
+        stack[size].power = 0;
+        size++;
+        st += len;
+    }
+    // Collapse whatever is left, right to left.
+    while (size > 1) {
+        PowerRun* left = &stack[size - 2];
+        PowerRun* right = &stack[size - 1];
+        power_merge(array, left->start, right->start, right->start + right->len, buffer);
+        left->len += right->len;
+        size--;
+    }
+    free(buffer);
+}
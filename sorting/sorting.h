@@ -5,6 +5,39 @@ void bubble_sort(int* array, int count);
 void selection_sort(int* array, int count);
 void insertion_sort(int* array, int count);
 void merge_sort(int* array, int count);
+// Same as merge_sort but uses the caller's scratch buffer of at least count ints
+// (pass NULL to have one allocated). Lets repeated sorts reuse a single buffer.
+void merge_sort_with_buffer(int* array, int count, int* buffer);
+// Stable adaptive merge sort (natural runs, powersort policy, galloping merges).
+// O(n) on sorted or reverse-sorted input, O(n log n) worst case.
+void power_sort(int* array, int count);
 void quick_sort(int* array, int count);
+void heap_sort(int* array, int count);
+// Sorts small arrays (up to 64 ints) with an AVX2 bitonic network when the CPU
+// supports it, insertion sort otherwise. Larger inputs go to quick_sort.
+void network_sort(int* array, int count);
+// Non-comparison sorts for integer keys (signed order).
+void radix_sort(int* array, int count);             // LSD, 8-bit digits, O(n) scratch
+void radix_sort64(long long* array, int count);     // LSD over 64-bit keys
+void radix_sort_inplace(int* array, int count);     // MSD American flag sort, in place
+// Same as radix_sort but uses the caller's scratch buffer of at least count ints
+// (pass NULL to have one allocated). With a buffer it cannot fail.
+void radix_sort_with_buffer(int* array, int count, int* buffer);
+// Selection (introselect, median-of-medians fallback, O(n) worst case).
+// Moves the element that sorting would put at index n there, with nothing
+// larger before it and nothing smaller after it.
+void nth_element(int* array, int count, int n);
+// Puts the k smallest elements, sorted, at the front. The rest are left in any order.
+void partial_sort(int* array, int count, int k);
+// nth_element for several ranks at once (any order, duplicates allowed); the
+// partitions are shared, so p50/p90/p99 cost little more than one of them.
+void multi_select(int* array, int count, const int* ranks, int num_ranks);
+
+#ifdef SORT_COUNT
+// Element comparisons and moves made by the sorts above, when sorting.c is
+// built with -DSORT_COUNT. They only grow; reset them between measurements.
+extern long long sort_comparisons;
+extern long long sort_moves;
+#endif
 
 #endif
\ No newline at end of file
@@ -0,0 +1,198 @@
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <assert.h>
+#include <string.h>
+#include <dirent.h>
+#include <unistd.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include "external_sort.h"
+
+// Scratch directory for the test files and spilled runs.
+char work_dir[] = "/tmp/test_external_sort_XXXXXX";
+
+void make_path(char* path, size_t size, const char* name) {
+    snprintf(path, size, "%s/%s", work_dir, name);
+}
+
+// Writes count pseudo-random ints (full range, with duplicates) and returns their sum.
+long long write_random_file(const char* path, long long count, unsigned int seed) {
+    FILE* file = fopen(path, "wb");
+    assert(file != NULL);
+    int block[4096];
+    long long sum = 0;
+    for (long long written = 0; written < count; ) {
+        int n = (count - written < 4096) ? (int)(count - written) : 4096;
+        for (int i = 0; i < n; i++) {
+            block[i] = (int)(((unsigned)rand_r(&seed) << 16) ^ (unsigned)rand_r(&seed));
+            if (i % 7 == 0) block[i] = block[i] % 100; // Plenty of duplicates
+            sum += block[i];
+        }
+        assert(fwrite(block, sizeof(int), n, file) == (size_t)n);
+        written += n;
+    }
+    fclose(file);
+    return sum;
+}
+
+// Streams a file and checks it is sorted with the expected length and sum.
+int file_sorted(const char* path, long long count, long long sum) {
+    FILE* file = fopen(path, "rb");
+    if (file == NULL) return 0;
+    int block[4096];
+    long long seen = 0;
+    long long total = 0;
+    int prev = 0;
+    int ok = 1;
+    size_t n;
+    while ((n = fread(block, sizeof(int), 4096, file)) > 0) {
+        for (size_t i = 0; i < n; i++) {
+            if (seen > 0 && block[i] < prev) ok = 0;
+            prev = block[i];
+            total += block[i];
+            seen++;
+        }
+    }
+    fclose(file);
+    return ok && seen == count && total == sum;
+}
+
+// Number of leftover files in work_dir other than the named test files.
+int count_temp_files() {
+    DIR* dir = opendir(work_dir);
+    assert(dir != NULL);
+    int count = 0;
+    struct dirent* entry;
+    while ((entry = readdir(dir)) != NULL) {
+        if (strncmp(entry->d_name, "extsort_", 8) == 0) count++;
+    }
+    closedir(dir);
+    return count;
+}
+
+void test_external_sort_small() {
+    char in[256], out[256];
+    make_path(in, sizeof(in), "small.bin");
+    make_path(out, sizeof(out), "small.out");
+    ExternalSortConfig config = {1 << 20, work_dir, 0};
+
+    // Fits in one chunk: sorted in memory, no runs spilled.
+    long long sum = write_random_file(in, 1000, 1);
+    assert(external_sort(in, out, &config) == 0);
+    assert(file_sorted(out, 1000, sum));
+
+    // Empty input.
+    write_random_file(in, 0, 1);
+    assert(external_sort(in, out, &config) == 0);
+    assert(file_sorted(out, 0, 0));
+
+    // Sorting a file onto itself.
+    sum = write_random_file(in, 5000, 2);
+    assert(external_sort(in, in, &config) == 0);
+    assert(file_sorted(in, 5000, sum));
+    assert(count_temp_files() == 0);
+    printf("SUCCESS - test_external_sort_small passed\n");
+}
+
+void test_external_sort_multi_pass() {
+    // 4M ints (16 MB) through a 256 KB budget: 128 runs of 32K ints. With the
+    // fan-in capped at 4 that is four merge passes, so intermediate runs are
+    // exercised as well as the final merge.
+    char in[256], out[256];
+    make_path(in, sizeof(in), "multi.bin");
+    make_path(out, sizeof(out), "multi.out");
+    long long count = 1 << 22;
+    long long sum = write_random_file(in, count, 3);
+
+    ExternalSortConfig config = {256 << 10, work_dir, 4};
+    assert(external_sort(in, out, &config) == 0);
+    assert(file_sorted(out, count, sum));
+
+    // Same input with the default fan-in (a single merge of all runs).
+    config.max_fan_in = 0;
+    assert(external_sort(in, out, &config) == 0);
+    assert(file_sorted(out, count, sum));
+    assert(count_temp_files() == 0);
+    printf("SUCCESS - test_external_sort_multi_pass passed\n");
+}
+
+void test_external_sort_memory_cap() {
+    // A child process with its address space capped well below the file size
+    // sorts a 64 MB file with a 4 MB budget. Sanitizer builds reserve huge
+    // shadow mappings, so the cap is skipped there.
+    char in[256], out[256];
+    make_path(in, sizeof(in), "big.bin");
+    make_path(out, sizeof(out), "big.out");
+    long long count = 1 << 24;
+    long long sum = write_random_file(in, count, 4);
+
+    pid_t pid = fork();
+    assert(pid >= 0);
+    if (pid == 0) {
+#if !defined(__SANITIZE_ADDRESS__) && !defined(__SANITIZE_THREAD__)
+        struct rlimit limit = {32 << 20, 32 << 20};
+        if (setrlimit(RLIMIT_AS, &limit) != 0) _exit(2);
+#endif
+        ExternalSortConfig config = {4 << 20, work_dir, 0};
+        _exit(external_sort(in, out, &config) == 0 ? 0 : 1);
+    }
+    int status = 0;
+    waitpid(pid, &status, 0);
+    assert(WIFEXITED(status) && WEXITSTATUS(status) == 0);
+    assert(file_sorted(out, count, sum));
+    assert(count_temp_files() == 0);
+    printf("SUCCESS - test_external_sort_memory_cap passed\n");
+}
+
+void test_external_sort_errors() {
+    char in[256], out[256];
+    make_path(in, sizeof(in), "odd.bin");
+    make_path(out, sizeof(out), "odd.out");
+    ExternalSortConfig config = {1 << 20, work_dir, 0};
+
+    // Missing input.
+    make_path(in, sizeof(in), "missing.bin");
+    assert(external_sort(in, out, &config) == -1);
+
+    // Size that is not a whole number of ints.
+    make_path(in, sizeof(in), "odd.bin");
+    FILE* file = fopen(in, "wb");
+    fwrite("abcdefg", 1, 7, file);
+    fclose(file);
+    assert(external_sort(in, out, &config) == -1);
+
+    // Budget too small to merge anything.
+    config.memory_budget = 1024;
+    assert(external_sort(in, out, &config) == -1);
+    assert(external_sort(NULL, out, NULL) == -1);
+    assert(count_temp_files() == 0);
+    printf("SUCCESS - test_external_sort_errors passed\n");
+}
+
+void remove_work_dir() {
+    DIR* dir = opendir(work_dir);
+    struct dirent* entry;
+    char path[512];
+    while ((entry = readdir(dir)) != NULL) {
+        if (entry->d_name[0] == '.') continue;
+        snprintf(path, sizeof(path), "%s/%s", work_dir, entry->d_name);
+        remove(path);
+    }
+    closedir(dir);
+    rmdir(work_dir);
+}
+
+int main() {
+    printf("Running external sort tests...\n\n");
+    assert(mkdtemp(work_dir) != NULL);
+
+    test_external_sort_small();
+    test_external_sort_multi_pass();
+    test_external_sort_memory_cap();
+    test_external_sort_errors();
+
+    remove_work_dir();
+    printf("\nSUCCESS - All external sort tests passed!\n");
+    return 0;
+}
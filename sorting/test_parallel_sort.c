@@ -0,0 +1,84 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <assert.h>
+#include <string.h>
+#include "sorting.h"
+#include "parallel_sort.h"
+
+int compare_ints(const void* a, const void* b) {
+    int x = *(const int*)a;
+    int y = *(const int*)b;
+    return (x > y) - (x < y);
+}
+
+// Sorts a copy with qsort and checks the parallel result matches it exactly.
+int matches_qsort(int* input, int* result, int count) {
+    int* reference = malloc(count * sizeof(int));
+    memcpy(reference, input, count * sizeof(int));
+    qsort(reference, count, sizeof(int), compare_ints);
+    int ok = memcmp(reference, result, count * sizeof(int)) == 0;
+    free(reference);
+    return ok;
+}
+
+void check_all_variants(int* input, int count, int nthreads) {
+    void (*fns[])(int*, int, int) = {parallel_sort, parallel_merge_sort, parallel_sample_sort};
+    int* work = malloc(count * sizeof(int));
+    for (int f = 0; f < 3; f++) {
+        memcpy(work, input, count * sizeof(int));
+        fns[f](work, count, nthreads);
+        assert(matches_qsort(input, work, count));
+    }
+    free(work);
+}
+
+void test_parallel_sort_small() {
+    int array[] = {5, 2, 8, 1, 9, -3, 0};
+    check_all_variants(array, 7, 4);
+    check_all_variants(array, 0, 4);
+    check_all_variants(array, 1, 4);
+    printf("SUCCESS - test_parallel_sort_small passed\n");
+}
+
+void test_parallel_sort_random() {
+    int count = 1000000;
+    int* input = malloc(count * sizeof(int));
+    srand(3);
+    for (int i = 0; i < count; i++) input[i] = rand() - RAND_MAX / 2;
+    for (int nthreads = 1; nthreads <= 8; nthreads *= 2) {
+        check_all_variants(input, count, nthreads);
+    }
+    free(input);
+    printf("SUCCESS - test_parallel_sort_random passed\n");
+}
+
+void test_parallel_sort_patterns() {
+    int count = 300001; // Odd size, so halves and blocks are uneven
+    int* input = malloc(count * sizeof(int));
+
+    for (int i = 0; i < count; i++) input[i] = i;
+    check_all_variants(input, count, 4);
+
+    for (int i = 0; i < count; i++) input[i] = count - i;
+    check_all_variants(input, count, 4);
+
+    for (int i = 0; i < count; i++) input[i] = 9; // One bucket gets everything
+    check_all_variants(input, count, 4);
+
+    for (int i = 0; i < count; i++) input[i] = i % 3; // Few unique keys
+    check_all_variants(input, count, 4);
+
+    free(input);
+    printf("SUCCESS - test_parallel_sort_patterns passed\n");
+}
+
+int main() {
+    printf("Running parallel sort tests...\n\n");
+
+    test_parallel_sort_small();
+    test_parallel_sort_random();
+    test_parallel_sort_patterns();
+
+    printf("\nSUCCESS - All parallel sort tests passed!\n");
+    return 0;
+}
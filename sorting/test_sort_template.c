@@ -0,0 +1,164 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <assert.h>
+#include <string.h>
+#include <limits.h>
+#include "sort_template.h"
+
+typedef struct Record {
+    int key;
+    int seq;           // Original position, to check stability
+    long long payload; // Pads the record to 16 bytes
+} Record;
+
+#define RECORD_LESS(a, b) ((a)->key < (b)->key)
+#define RECORD_KEY(r) ((r)->key)
+
+SORT_DEFINE(record, Record, RECORD_LESS)
+SORT_DEFINE_RADIX(record_by_key, Record, int, RECORD_KEY)
+
+// A function works as well as a macro for less.
+int double_less(const double* a, const double* b) {
+    return *a < *b;
+}
+
+SORT_DEFINE(dbl, double, double_less)
+
+typedef struct Wide {
+    unsigned long long id;
+    char tag;
+} Wide;
+
+#define WIDE_KEY(w) ((w)->id)
+#define BYTE_KEY(w) ((w)->tag)
+
+SORT_DEFINE_RADIX(wide_by_id, Wide, unsigned long long, WIDE_KEY)
+SORT_DEFINE_RADIX(wide_by_tag, Wide, signed char, BYTE_KEY)
+
+void fill_records(Record* records, int count, int key_range, unsigned int seed) {
+    srand(seed);
+    for (int i = 0; i < count; i++) {
+        records[i].key = (int)(rand() % key_range) - key_range / 2;
+        records[i].seq = i;
+        records[i].payload = (long long)records[i].key * 3;
+    }
+}
+
+int records_sorted(const Record* records, int count) {
+    for (int i = 1; i < count; i++) {
+        if (records[i].key < records[i-1].key) return 0;
+    }
+    for (int i = 0; i < count; i++) {
+        // Payload travels with its key.
+        if (records[i].payload != (long long)records[i].key * 3) return 0;
+    }
+    return 1;
+}
+
+int records_stable(const Record* records, int count) {
+    for (int i = 1; i < count; i++) {
+        if (records[i].key == records[i-1].key && records[i].seq < records[i-1].seq) return 0;
+    }
+    return 1;
+}
+
+void test_record_sorts() {
+    void (*fns[])(Record*, int) = {record_quick_sort, record_merge_sort, record_heap_sort, record_by_key_radix_sort};
+    int num_fns = sizeof(fns) / sizeof(fns[0]);
+    int sizes[] = {0, 1, 2, 15, 17, 100, 1000, 100000};
+    for (int s = 0; s < 8; s++) {
+        int count = sizes[s];
+        Record* records = malloc((count + 1) * sizeof(Record));
+        for (int f = 0; f < num_fns; f++) {
+            fill_records(records, count, 1000, 17);
+            fns[f](records, count);
+            assert(records_sorted(records, count));
+        }
+        free(records);
+    }
+    printf("SUCCESS - test_record_sorts passed\n");
+}
+
+void test_stable_sorts() {
+    int count = 50000;
+    Record* records = malloc(count * sizeof(Record));
+    // Few distinct keys, so there are long runs of equal keys.
+    fill_records(records, count, 10, 3);
+    record_merge_sort(records, count);
+    assert(records_sorted(records, count) && records_stable(records, count));
+
+    fill_records(records, count, 10, 3);
+    record_by_key_radix_sort(records, count);
+    assert(records_sorted(records, count) && records_stable(records, count));
+
+    // Caller-provided buffer.
+    Record* buffer = malloc(count * sizeof(Record));
+    fill_records(records, count, 100, 4);
+    record_merge_sort_with_buffer(records, count, buffer);
+    assert(records_sorted(records, count) && records_stable(records, count));
+    free(buffer);
+    free(records);
+    printf("SUCCESS - test_stable_sorts passed\n");
+}
+
+void test_quick_sort_patterns() {
+    // Sorted, reverse and all-equal inputs go through the ninther and Hoare paths.
+    int count = 100000;
+    Record* records = malloc(count * sizeof(Record));
+    for (int pattern = 0; pattern < 3; pattern++) {
+        for (int i = 0; i < count; i++) {
+            records[i].key = (pattern == 0) ? i : (pattern == 1) ? count - i : 7;
+            records[i].seq = i;
+            records[i].payload = (long long)records[i].key * 3;
+        }
+        record_quick_sort(records, count);
+        assert(records_sorted(records, count));
+    }
+    free(records);
+    printf("SUCCESS - test_quick_sort_patterns passed\n");
+}
+
+void test_radix_key_types() {
+    // Signed 32-bit extremes.
+    Record records[6] = {{INT_MAX, 0, 0}, {-1, 1, 0}, {INT_MIN, 2, 0}, {0, 3, 0}, {1, 4, 0}, {-1, 5, 0}};
+    for (int i = 0; i < 6; i++) records[i].payload = (long long)records[i].key * 3;
+    record_by_key_radix_sort(records, 6);
+    assert(records[0].key == INT_MIN && records[5].key == INT_MAX);
+    assert(records_sorted(records, 6) && records_stable(records, 6));
+
+    // Full-width unsigned 64-bit keys.
+    Wide wide[5] = {{~0ull, 'a'}, {0, 'b'}, {1ull << 63, 'c'}, {42, 'd'}, {(1ull << 63) - 1, 'e'}};
+    wide_by_id_radix_sort(wide, 5);
+    assert(wide[0].id == 0 && wide[1].id == 42 && wide[2].id == (1ull << 63) - 1);
+    assert(wide[3].id == 1ull << 63 && wide[4].id == ~0ull);
+
+    // Signed 8-bit keys.
+    Wide tags[4] = {{0, 5}, {1, -128}, {2, 127}, {3, -1}};
+    wide_by_tag_radix_sort(tags, 4);
+    assert(tags[0].tag == -128 && tags[1].tag == -1 && tags[2].tag == 5 && tags[3].tag == 127);
+    printf("SUCCESS - test_radix_key_types passed\n");
+}
+
+void test_function_comparator() {
+    double values[] = {3.5, -1.25, 2.0, 1e9, -1e9, 0.0, 2.0};
+    dbl_quick_sort(values, 7);
+    for (int i = 1; i < 7; i++) {
+        assert(values[i-1] <= values[i]);
+    }
+    dbl_insertion_sort(values, 7);
+    assert(values[0] == -1e9 && values[6] == 1e9);
+    printf("SUCCESS - test_function_comparator passed\n");
+}
+
+int main() {
+    printf("Running sort template tests...\n\n");
+
+    test_record_sorts();
+    test_stable_sorts();
+    test_quick_sort_patterns();
+    test_radix_key_types();
+    test_function_comparator();
+
+    printf("\nSUCCESS - All sort template tests passed!\n");
+    return 0;
+}
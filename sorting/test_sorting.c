@@ -1,6 +1,8 @@
 #include <stdio.h>
+#include <stdlib.h>
 #include <assert.h>
 #include <string.h>
+#include <limits.h>
 #include "sorting.h"
 
 void print_array(int* array, int count) {
@@ -19,6 +21,22 @@ int arrays_equal(int* arr1, int* arr2, int count) {
     return 1;
 }
 
+int is_sorted(int* array, int count) {
+    for (int i = 1; i < count; i++) {
+        if (array[i-1] > array[i]) return 0;
+    }
+    return 1;
+}
+
+long long array_sum(int* array, int count) {
+    // Cheap check that a sort did not lose or invent elements.
+    long long sum = 0;
+    for (int i = 0; i < count; i++) {
+        sum += array[i];
+    }
+    return sum;
+}
+
 void test_bubble_sort_basic() {
     int array[] = {5, 2, 8, 1, 9};
     int expected[] = {1, 2, 5, 8, 9};
@@ -229,6 +247,105 @@ void test_quick_sort_negative_numbers() {
     printf("SUCCESS - test_quick_sort_negative_numbers passed\n");
 }
 
+void test_quick_sort_large_patterns() {
+    // Inputs that used to be O(n^2) / overflow the stack with the Lomuto partition.
+    int count = 200000;
+    int* array = malloc(count * sizeof(int));
+
+    for (int i = 0; i < count; i++) array[i] = i;
+    quick_sort(array, count);
+    assert(is_sorted(array, count));
+
+    for (int i = 0; i < count; i++) array[i] = count - i;
+    quick_sort(array, count);
+    assert(is_sorted(array, count));
+
+    for (int i = 0; i < count; i++) array[i] = (i < count / 2) ? i : count - i; // organ pipe
+    long long sum = array_sum(array, count);
+    quick_sort(array, count);
+    assert(is_sorted(array, count));
+    assert(array_sum(array, count) == sum);
+
+    for (int i = 0; i < count; i++) array[i] = 7;
+    quick_sort(array, count);
+    assert(is_sorted(array, count));
+
+    srand(42);
+    for (int i = 0; i < count; i++) array[i] = rand() - RAND_MAX / 2;
+    sum = array_sum(array, count);
+    quick_sort(array, count);
+    assert(is_sorted(array, count));
+    assert(array_sum(array, count) == sum);
+
+    free(array);
+    printf("SUCCESS - test_quick_sort_large_patterns passed\n");
+}
+
+void test_network_sort_all_sizes() {
+    // Every size the network handles, with duplicates and the extreme values
+    // (INT_MAX is also the padding value).
+    int array[80];
+    srand(5);
+    for (int count = 0; count <= 80; count++) {
+        for (int i = 0; i < count; i++) array[i] = rand() % 21 - 10;
+        if (count > 2) {
+            array[0] = INT_MAX;
+            array[count / 2] = INT_MIN;
+        }
+        long long sum = array_sum(array, count);
+        network_sort(array, count);
+        assert(is_sorted(array, count));
+        assert(array_sum(array, count) == sum);
+    }
+    printf("SUCCESS - test_network_sort_all_sizes passed\n");
+}
+
+void test_quick_sort_small_batches() {
+    // Many small arrays (the SIMD base case) and a few-unique large array
+    // (exercises the all-equal split of the vectorized partition).
+    int array[300];
+    srand(9);
+    for (int count = 1; count <= 300; count++) {
+        for (int i = 0; i < count; i++) array[i] = rand() % 5;
+        long long sum = array_sum(array, count);
+        quick_sort(array, count);
+        assert(is_sorted(array, count));
+        assert(array_sum(array, count) == sum);
+    }
+    int large = 100000;
+    int* few = malloc(large * sizeof(int));
+    for (int i = 0; i < large; i++) few[i] = (i % 3 == 0) ? INT_MAX : i % 4;
+    quick_sort(few, large);
+    assert(is_sorted(few, large));
+    free(few);
+    printf("SUCCESS - test_quick_sort_small_batches passed\n");
+}
+
+// Heap sort tests
+void test_heap_sort_basic() {
+    int array[] = {3, 1, 4, 1, 5, 9, 2, 6, 5};
+    int expected[] = {1, 1, 2, 3, 4, 5, 5, 6, 9};
+    int count = 9;
+    
+    heap_sort(array, count);
+    assert(arrays_equal(array, expected, count));
+    printf("SUCCESS - test_heap_sort_basic passed\n");
+}
+
+void test_heap_sort_edge_cases() {
+    int single[] = {42};
+    heap_sort(single, 1);
+    assert(single[0] == 42);
+
+    heap_sort(NULL, 0); // Empty input is a no-op
+
+    int negatives[] = {-3, 1, -4, 1, 5, -9, 2};
+    int expected[] = {-9, -4, -3, 1, 1, 2, 5};
+    heap_sort(negatives, 7);
+    assert(arrays_equal(negatives, expected, 7));
+    printf("SUCCESS - test_heap_sort_edge_cases passed\n");
+}
+
 // Merge sort tests
 void test_merge_sort_basic() {
     int array[] = {5, 2, 8, 1, 9};
@@ -280,6 +397,332 @@ void test_merge_sort_duplicates() {
     printf("SUCCESS - test_merge_sort_duplicates passed\n");
 }
 
+void test_merge_sort_sizes() {
+    // Every size around the run and pass boundaries, so both run sizes
+    // and odd leftover runs are exercised.
+    int array[300];
+    for (int count = 0; count <= 300; count++) {
+        for (int i = 0; i < count; i++) array[i] = (i * 7919) % 101 - 50;
+        long long sum = array_sum(array, count);
+        merge_sort(array, count);
+        assert(is_sorted(array, count));
+        assert(array_sum(array, count) == sum);
+    }
+    printf("SUCCESS - test_merge_sort_sizes passed\n");
+}
+
+void test_merge_sort_with_buffer() {
+    int count = 100000;
+    int* array = malloc(count * sizeof(int));
+    int* buffer = malloc(count * sizeof(int));
+
+    // Reuse the same buffer for several sorts.
+    srand(7);
+    for (int round = 0; round < 3; round++) {
+        for (int i = 0; i < count; i++) array[i] = rand() - RAND_MAX / 2;
+        long long sum = array_sum(array, count);
+        merge_sort_with_buffer(array, count, buffer);
+        assert(is_sorted(array, count));
+        assert(array_sum(array, count) == sum);
+    }
+
+    // Already sorted and reverse inputs.
+    for (int i = 0; i < count; i++) array[i] = i;
+    merge_sort_with_buffer(array, count, buffer);
+    assert(is_sorted(array, count));
+    for (int i = 0; i < count; i++) array[i] = count - i;
+    merge_sort_with_buffer(array, count, NULL);
+    assert(is_sorted(array, count));
+
+    free(array);
+    free(buffer);
+    printf("SUCCESS - test_merge_sort_with_buffer passed\n");
+}
+
+// Radix sort tests
+void test_radix_sort_basic() {
+    int array[] = {-3, 1, -4, 1, 5, -9, 2, INT_MAX, INT_MIN, 0};
+    int expected[] = {INT_MIN, -9, -4, -3, 0, 1, 1, 2, 5, INT_MAX};
+    int copy[10];
+
+    memcpy(copy, array, sizeof(array));
+    radix_sort(copy, 10);
+    assert(arrays_equal(copy, expected, 10));
+
+    memcpy(copy, array, sizeof(array));
+    radix_sort_inplace(copy, 10);
+    assert(arrays_equal(copy, expected, 10));
+    printf("SUCCESS - test_radix_sort_basic passed\n");
+}
+
+void test_radix_sort_large() {
+    int count = 200000;
+    int* array = malloc(count * sizeof(int));
+    int* reference = malloc(count * sizeof(int));
+
+    // Full 32-bit range, both variants checked against quick_sort.
+    srand(11);
+    for (int i = 0; i < count; i++) reference[i] = (int)(((unsigned)rand() << 16) ^ (unsigned)rand());
+    quick_sort(reference, count);
+    int* buffer = malloc(count * sizeof(int));
+    for (int v = 0; v < 3; v++) {
+        srand(11);
+        for (int i = 0; i < count; i++) array[i] = (int)(((unsigned)rand() << 16) ^ (unsigned)rand());
+        if (v == 0) radix_sort(array, count);
+        else if (v == 1) radix_sort_inplace(array, count);
+        else radix_sort_with_buffer(array, count, buffer);
+        assert(arrays_equal(array, reference, count));
+    }
+
+    // One real pass: the result is copied back out of the caller's buffer.
+    for (int i = 0; i < count; i++) array[i] = (i * 7919) % 256;
+    radix_sort_with_buffer(array, count, buffer);
+    assert(is_sorted(array, count));
+    free(buffer);
+
+    // Small IDs: the upper byte passes are skipped.
+    for (int i = 0; i < count; i++) array[i] = (i * 7919) % 1000;
+    radix_sort(array, count);
+    assert(is_sorted(array, count));
+
+    // All equal: every pass is trivial.
+    for (int i = 0; i < count; i++) array[i] = -5;
+    radix_sort(array, count);
+    radix_sort_inplace(array, count);
+    assert(array[0] == -5 && array[count-1] == -5);
+
+    free(array);
+    free(reference);
+    printf("SUCCESS - test_radix_sort_large passed\n");
+}
+
+void test_radix_sort64() {
+    long long array[] = {5000000000LL, -3, LLONG_MIN, 0, LLONG_MAX, -5000000000LL, 7};
+    long long expected[] = {LLONG_MIN, -5000000000LL, -3, 0, 7, 5000000000LL, LLONG_MAX};
+    radix_sort64(array, 7);
+    for (int i = 0; i < 7; i++) {
+        assert(array[i] == expected[i]);
+    }
+    printf("SUCCESS - test_radix_sort64 passed\n");
+}
+
+// Power sort tests
+void test_power_sort_basic() {
+    int array[] = {64, 34, 25, 12, 22, 11, 90, -5, 22, 0};
+    int expected[] = {-5, 0, 11, 12, 22, 22, 25, 34, 64, 90};
+    power_sort(array, 10);
+    assert(arrays_equal(array, expected, 10));
+
+    int one[] = {3};
+    power_sort(one, 1);
+    power_sort(NULL, 0);
+    assert(one[0] == 3);
+    printf("SUCCESS - test_power_sort_basic passed\n");
+}
+
+void test_power_sort_patterns() {
+    // Inputs with structure the run detection and galloping should pick up,
+    // all checked against quick_sort.
+    int count = 100000;
+    int* array = malloc(count * sizeof(int));
+    int* reference = malloc(count * sizeof(int));
+    srand(5);
+    for (int pattern = 0; pattern < 7; pattern++) {
+        for (int i = 0; i < count; i++) {
+            switch (pattern) {
+                case 0: array[i] = rand(); break;                                  // Random
+                case 1: array[i] = i; break;                                       // Sorted
+                case 2: array[i] = count - i; break;                               // Reverse
+                case 3: array[i] = (i < count / 2) ? i : count - i; break;         // Organ pipe
+                case 4: array[i] = i % 1000; break;                                // Sawtooth: 100 runs
+                case 5: array[i] = (i < count - 100) ? 2 * i : rand() % count; break; // Sorted + random tail
+                default: array[i] = rand() % 4; break;                             // Few distinct keys
+            }
+        }
+        if (pattern == 1) {
+            // Sprinkle a few swaps into the sorted input.
+            for (int s = 0; s < 50; s++) {
+                int a = rand() % count;
+                int b = rand() % count;
+                int tmp = array[a];
+                array[a] = array[b];
+                array[b] = tmp;
+            }
+        }
+        memcpy(reference, array, count * sizeof(int));
+        quick_sort(reference, count);
+        power_sort(array, count);
+        assert(arrays_equal(array, reference, count));
+    }
+    free(array);
+    free(reference);
+    printf("SUCCESS - test_power_sort_patterns passed\n");
+}
+
+void test_power_sort_sizes() {
+    // Sizes around the minimum run length and its multiples, with interleaved
+    // runs so the merges alternate sides and both galloping modes trigger.
+    int array[600];
+    for (int count = 0; count <= 600; count++) {
+        for (int i = 0; i < count; i++) {
+            array[i] = (i % 3 == 0) ? i / 3 : ((i / 37) % 2 ? -i : (i * 7919) % 97);
+        }
+        long long sum = array_sum(array, count);
+        power_sort(array, count);
+        assert(is_sorted(array, count));
+        assert(array_sum(array, count) == sum);
+    }
+    printf("SUCCESS - test_power_sort_sizes passed\n");
+}
+
+// Selection tests
+int compare_ints(const void* a, const void* b) {
+    int x = *(const int*)a;
+    int y = *(const int*)b;
+    return (x > y) - (x < y);
+}
+
+// Checks array[n] is the sorted value and the partition property around it.
+int selected_at(int* array, int count, int n, const int* sorted) {
+    if (array[n] != sorted[n]) return 0;
+    for (int i = 0; i < n; i++) {
+        if (array[i] > array[n]) return 0;
+    }
+    for (int i = n + 1; i < count; i++) {
+        if (array[i] < array[n]) return 0;
+    }
+    return 1;
+}
+
+void fill_pattern(int* array, int count, int pattern) {
+    for (int i = 0; i < count; i++) {
+        switch (pattern) {
+            case 0: array[i] = rand() - RAND_MAX / 2; break;          // Random
+            case 1: array[i] = i; break;                              // Sorted
+            case 2: array[i] = count - i; break;                      // Reverse
+            case 3: array[i] = (i < count / 2) ? i : count - i; break; // Organ pipe
+            case 4: array[i] = rand() % 3; break;                     // Few unique
+            default: array[i] = 9; break;                             // All equal
+        }
+    }
+}
+
+void test_nth_element() {
+    int count = 20001;
+    int* array = malloc(count * sizeof(int));
+    int* input = malloc(count * sizeof(int));
+    int* sorted = malloc(count * sizeof(int));
+    srand(21);
+    for (int pattern = 0; pattern < 6; pattern++) {
+        fill_pattern(input, count, pattern);
+        memcpy(sorted, input, count * sizeof(int));
+        qsort(sorted, count, sizeof(int), compare_ints);
+        int positions[] = {0, 1, count / 4, count / 2, count - 2, count - 1};
+        for (int p = 0; p < 6; p++) {
+            memcpy(array, input, count * sizeof(int));
+            nth_element(array, count, positions[p]);
+            assert(selected_at(array, count, positions[p], sorted));
+        }
+    }
+    // Every position of a small array.
+    int small[17];
+    int small_sorted[17];
+    for (int n = 0; n < 17; n++) {
+        for (int i = 0; i < 17; i++) small[i] = (i * 7) % 17 - 8;
+        memcpy(small_sorted, small, sizeof(small));
+        qsort(small_sorted, 17, sizeof(int), compare_ints);
+        nth_element(small, 17, n);
+        assert(selected_at(small, 17, n, small_sorted));
+    }
+    free(array);
+    free(input);
+    free(sorted);
+    printf("SUCCESS - test_nth_element passed\n");
+}
+
+void test_partial_sort() {
+    int count = 10000;
+    int* array = malloc(count * sizeof(int));
+    int* sorted = malloc(count * sizeof(int));
+    srand(22);
+    int ks[] = {0, 1, 10, 5000, 9999, 10000, 20000};
+    for (int t = 0; t < 7; t++) {
+        fill_pattern(array, count, t % 5);
+        memcpy(sorted, array, count * sizeof(int));
+        qsort(sorted, count, sizeof(int), compare_ints);
+        long long sum = array_sum(array, count);
+        partial_sort(array, count, ks[t]);
+        int k = (ks[t] < count) ? ks[t] : count;
+        assert(arrays_equal(array, sorted, k));
+        assert(array_sum(array, count) == sum);
+    }
+    free(array);
+    free(sorted);
+    printf("SUCCESS - test_partial_sort passed\n");
+}
+
+void test_multi_select() {
+    int count = 100000;
+    int* array = malloc(count * sizeof(int));
+    int* input = malloc(count * sizeof(int));
+    int* sorted = malloc(count * sizeof(int));
+    srand(23);
+    // Unsorted ranks with a duplicate and both ends.
+    int ranks[] = {count * 99 / 100, count / 2, 0, count * 9 / 10, count / 2, count - 1, count * 999 / 1000};
+    int num_ranks = sizeof(ranks) / sizeof(ranks[0]);
+    for (int pattern = 0; pattern < 6; pattern++) {
+        fill_pattern(input, count, pattern);
+        memcpy(sorted, input, count * sizeof(int));
+        qsort(sorted, count, sizeof(int), compare_ints);
+        memcpy(array, input, count * sizeof(int));
+        multi_select(array, count, ranks, num_ranks);
+        for (int r = 0; r < num_ranks; r++) {
+            assert(selected_at(array, count, ranks[r], sorted));
+        }
+    }
+    free(array);
+    free(input);
+    free(sorted);
+    printf("SUCCESS - test_multi_select passed\n");
+}
+
+#ifdef SORT_COUNT
+// Counting hooks (-DSORT_COUNT): exact counts where the algorithm fixes them.
+void test_sort_counts() {
+    int array[100];
+    for (int i = 0; i < 100; i++) array[i] = 100 - i;
+    sort_comparisons = 0;
+    sort_moves = 0;
+    insertion_sort(array, 100);
+    // Reverse input: every pair is compared and shifted once.
+    assert(sort_comparisons == 100 * 99 / 2);
+    assert(sort_moves == 100 * 99 / 2 + 2 * 99);
+
+    sort_comparisons = 0;
+    sort_moves = 0;
+    insertion_sort(array, 100);
+    assert(sort_comparisons == 99);
+
+    // Sorted input is one natural run: n - 1 comparisons and nothing moved.
+    sort_comparisons = 0;
+    sort_moves = 0;
+    power_sort(array, 100);
+    assert(sort_comparisons == 99 && sort_moves == 0);
+
+    // Radix sort never compares two elements.
+    for (int i = 0; i < 100; i++) array[i] = (i * 37) % 100 - 50;
+    sort_comparisons = 0;
+    radix_sort(array, 100);
+    assert(sort_comparisons == 0 && sort_moves > 0);
+
+    for (int i = 0; i < 100; i++) array[i] = (i * 37) % 100;
+    sort_comparisons = 0;
+    quick_sort(array, 100);
+    assert(sort_comparisons > 0 && is_sorted(array, 100));
+    printf("SUCCESS - test_sort_counts passed\n");
+}
+#endif
+
 int main() {
     printf("Running sorting algorithm tests...\n\n");
     
@@ -310,6 +753,13 @@ int main() {
     test_quick_sort_duplicates();
     test_quick_sort_two_elements();
     test_quick_sort_negative_numbers();
+    test_quick_sort_large_patterns();
+    test_quick_sort_small_batches();
+    test_network_sort_all_sizes();
+    
+    printf("\n=== Heap Sort Tests ===\n");
+    test_heap_sort_basic();
+    test_heap_sort_edge_cases();
     
     printf("\n=== Merge Sort Tests ===\n");
     test_merge_sort_basic();
@@ -317,6 +767,26 @@ int main() {
     test_merge_sort_reverse_sorted();
     test_merge_sort_single_element();
     test_merge_sort_duplicates();
+    test_merge_sort_sizes();
+    test_merge_sort_with_buffer();
+    
+    printf("\n=== Power Sort Tests ===\n");
+    test_power_sort_basic();
+    test_power_sort_patterns();
+    test_power_sort_sizes();
+    
+    printf("\n=== Radix Sort Tests ===\n");
+    test_radix_sort_basic();
+    test_radix_sort_large();
+    test_radix_sort64();
+    
+    printf("\n=== Selection Tests ===\n");
+    test_nth_element();
+    test_partial_sort();
+    test_multi_select();
+#ifdef SORT_COUNT
+    test_sort_counts();
+#endif
     
     printf("\nSUCCESS - All sorting tests passed!\n");
     return 0;
@@ -0,0 +1,623 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "art.h"
+
+#if defined(__SSE2__) && !defined(ART_NO_SIMD)
+#include <emmintrin.h>
+#define ART_HAVE_SSE2 1
+#endif
+
+#define ART_IS_LEAF(p) ((uintptr_t)(p) & 1)
+#define ART_LEAF(p) ((ArtLeaf*)((uintptr_t)(p) & ~(uintptr_t)1))
+#define ART_TAG_LEAF(l) ((ArtNode*)((uintptr_t)(l) | 1))
+
+// Child counts at which a node is replaced by the next smaller type. Below
+// the next type's capacity, so a node at the boundary doesn't flip back and
+// forth on alternating inserts and deletes.
+#define ART_SHRINK_256 37
+#define ART_SHRINK_48 12
+#define ART_SHRINK_16 3
+
+// === MEMORY MANAGEMENT ===
+
+size_t art_node_bytes(uint8_t type) {
+    switch (type) {
+        case ART_NODE4: return sizeof(ArtNode4);
+        case ART_NODE16: return sizeof(ArtNode16);
+        case ART_NODE48: return sizeof(ArtNode48);
+        default: return sizeof(ArtNode256);
+    }
+}
+
+ArtNode* art_alloc_node(ArtTree* tree, uint8_t type) {
+    size_t bytes = art_node_bytes(type);
+    ArtNode* node = calloc(1, bytes);
+    if (node == NULL) {
+        fprintf(stderr, "Failed to allocate %lu bytes of memory", bytes);
+        return NULL;
+    }
+    node->type = type;
+    tree->bytes += bytes;
+    return node;
+}
+
+void art_free_node(ArtTree* tree, ArtNode* node) {
+    tree->bytes -= art_node_bytes(node->type);
+    free(node);
+}
+
+ArtLeaf* art_alloc_leaf(ArtTree* tree, const unsigned char* key, size_t len) {
+    size_t bytes = sizeof(ArtLeaf) + len;
+    ArtLeaf* leaf = malloc(bytes);
+    if (leaf == NULL) {
+        fprintf(stderr, "Failed to allocate %lu bytes of memory", bytes);
+        return NULL;
+    }
+    leaf->len = (uint32_t)len;
+    memcpy(leaf->key, key, len);
+    tree->bytes += bytes;
+    return leaf;
+}
+
+void art_free_leaf(ArtTree* tree, ArtLeaf* leaf) {
+    tree->bytes -= sizeof(ArtLeaf) + leaf->len;
+    free(leaf);
+}
+
+ArtTree* create_art() {
+    ArtTree* tree = malloc(sizeof(ArtTree));
+    if (tree == NULL) {
+        fprintf(stderr, "Failed to allocate %lu bytes of memory", sizeof(ArtTree));
+        return NULL;
+    }
+    tree->root = NULL;
+    tree->size = 0;
+    tree->bytes = 0;
+    return tree;
+}
+
+void art_destroy_node(ArtTree* tree, ArtNode* node) {
+    if (node == NULL) {
+        return;
+    }
+    if (ART_IS_LEAF(node)) {
+        art_free_leaf(tree, ART_LEAF(node));
+        return;
+    }
+    switch (node->type) {
+        case ART_NODE4:
+            for (int i = 0; i < node->num_children; i++) {
+                art_destroy_node(tree, ((ArtNode4*)node)->children[i]);
+            }
+            break;
+        case ART_NODE16:
+            for (int i = 0; i < node->num_children; i++) {
+                art_destroy_node(tree, ((ArtNode16*)node)->children[i]);
+            }
+            break;
+        case ART_NODE48:
+            for (int i = 0; i < 48; i++) {
+                art_destroy_node(tree, ((ArtNode48*)node)->children[i]);
+            }
+            break;
+        default:
+            for (int i = 0; i < 256; i++) {
+                art_destroy_node(tree, ((ArtNode256*)node)->children[i]);
+            }
+            break;
+    }
+    art_free_node(tree, node);
+}
+
+void delete_art(ArtTree* tree) {
+    if (tree == NULL) {
+        fprintf(stderr, "ERROR - Must pass a valid ArtTree*.");
+        return;
+    }
+    art_destroy_node(tree, tree->root);
+    free(tree);
+}
+
+// === NODE ACCESS ===
+
+// Slot holding the child for byte c, or NULL if there is none.
+ArtNode** art_find_child(ArtNode* node, unsigned char c) {
+    switch (node->type) {
+        case ART_NODE4: {
+            ArtNode4* n = (ArtNode4*)node;
+            for (int i = 0; i < node->num_children; i++) {
+                if (n->keys[i] == c) {
+                    return &n->children[i];
+                }
+            }
+            return NULL;
+        }
+        case ART_NODE16: {
+            ArtNode16* n = (ArtNode16*)node;
+#ifdef ART_HAVE_SSE2
+            // All 16 keys compared at once; the mask drops unused slots.
+            __m128i cmp = _mm_cmpeq_epi8(_mm_set1_epi8((char)c), _mm_loadu_si128((const __m128i*)n->keys));
+            int mask = _mm_movemask_epi8(cmp) & ((1 << node->num_children) - 1);
+            return mask ? &n->children[__builtin_ctz(mask)] : NULL;
+#else
+            for (int i = 0; i < node->num_children; i++) {
+                if (n->keys[i] == c) {
+                    return &n->children[i];
+                }
+            }
+            return NULL;
+#endif
+        }
+        case ART_NODE48: {
+            ArtNode48* n = (ArtNode48*)node;
+            int slot = n->child_index[c];
+            return slot ? &n->children[slot - 1] : NULL;
+        }
+        default: {
+            ArtNode256* n = (ArtNode256*)node;
+            return n->children[c] ? &n->children[c] : NULL;
+        }
+    }
+}
+
+// Leaf with the smallest key below node, used to recover prefix bytes
+// beyond ART_MAX_PREFIX. Every key below shares the node's prefix.
+ArtLeaf* art_minimum(ArtNode* node) {
+    while (!ART_IS_LEAF(node)) {
+        switch (node->type) {
+            case ART_NODE4:
+                node = ((ArtNode4*)node)->children[0];
+                break;
+            case ART_NODE16:
+                node = ((ArtNode16*)node)->children[0];
+                break;
+            case ART_NODE48: {
+                ArtNode48* n = (ArtNode48*)node;
+                int c = 0;
+                while (n->child_index[c] == 0) {
+                    c++;
+                }
+                node = n->children[n->child_index[c] - 1];
+                break;
+            }
+            default: {
+                ArtNode256* n = (ArtNode256*)node;
+                int c = 0;
+                while (n->children[c] == NULL) {
+                    c++;
+                }
+                node = n->children[c];
+                break;
+            }
+        }
+    }
+    return ART_LEAF(node);
+}
+
+int art_leaf_matches(const ArtLeaf* leaf, const unsigned char* key, size_t len) {
+    return leaf->len == len && memcmp(leaf->key, key, len) == 0;
+}
+
+// Length of the match between node's full prefix and key at depth.
+size_t art_prefix_mismatch(ArtNode* node, const unsigned char* key, size_t len, size_t depth) {
+    size_t stored = node->prefix_len < ART_MAX_PREFIX ? node->prefix_len : ART_MAX_PREFIX;
+    size_t i = 0;
+    for (; i < stored && depth + i < len; i++) {
+        if (node->prefix[i] != key[depth + i]) {
+            return i;
+        }
+    }
+    if (node->prefix_len > ART_MAX_PREFIX) {
+        ArtLeaf* leaf = art_minimum(node);
+        for (; i < node->prefix_len && depth + i < len; i++) {
+            if (leaf->key[depth + i] != key[depth + i]) {
+                return i;
+            }
+        }
+    }
+    return i;
+}
+
+// === GROWING AND SHRINKING ===
+
+void art_copy_header(ArtNode* to, const ArtNode* from) {
+    to->num_children = from->num_children;
+    to->prefix_len = from->prefix_len;
+    memcpy(to->prefix, from->prefix, ART_MAX_PREFIX);
+}
+
+// Adds child under byte c to the node at *ref, replacing it with the next
+// larger type when full.
+// @return: 1, or -1 if growing failed (nothing changed)
+int art_add_child(ArtTree* tree, ArtNode** ref, unsigned char c, ArtNode* child) {
+    ArtNode* node = *ref;
+    switch (node->type) {
+        case ART_NODE4: {
+            ArtNode4* n = (ArtNode4*)node;
+            if (node->num_children < 4) {
+                int i = 0;
+                while (i < node->num_children && n->keys[i] < c) {
+                    i++;
+                }
+                memmove(n->keys + i + 1, n->keys + i, node->num_children - i);
+                memmove(n->children + i + 1, n->children + i, (node->num_children - i) * sizeof(ArtNode*));
+                n->keys[i] = c;
+                n->children[i] = child;
+                node->num_children++;
+                return 1;
+            }
+            ArtNode16* grown = (ArtNode16*)art_alloc_node(tree, ART_NODE16);
+            if (grown == NULL) {
+                return -1;
+            }
+            art_copy_header(&grown->n, node);
+            memcpy(grown->keys, n->keys, 4);
+            memcpy(grown->children, n->children, 4 * sizeof(ArtNode*));
+            art_free_node(tree, node);
+            *ref = &grown->n;
+            return art_add_child(tree, ref, c, child);
+        }
+        case ART_NODE16: {
+            ArtNode16* n = (ArtNode16*)node;
+            if (node->num_children < 16) {
+                int i = 0;
+                while (i < node->num_children && n->keys[i] < c) {
+                    i++;
+                }
+                memmove(n->keys + i + 1, n->keys + i, node->num_children - i);
+                memmove(n->children + i + 1, n->children + i, (node->num_children - i) * sizeof(ArtNode*));
+                n->keys[i] = c;
+                n->children[i] = child;
+                node->num_children++;
+                return 1;
+            }
+            ArtNode48* grown = (ArtNode48*)art_alloc_node(tree, ART_NODE48);
+            if (grown == NULL) {
+                return -1;
+            }
+            art_copy_header(&grown->n, node);
+            for (int i = 0; i < 16; i++) {
+                grown->child_index[n->keys[i]] = (unsigned char)(i + 1);
+                grown->children[i] = n->children[i];
+            }
+            art_free_node(tree, node);
+            *ref = &grown->n;
+            return art_add_child(tree, ref, c, child);
+        }
+        case ART_NODE48: {
+            ArtNode48* n = (ArtNode48*)node;
+            if (node->num_children < 48) {
+                int slot = 0;
+                while (n->children[slot] != NULL) {
+                    slot++;
+                }
+                n->children[slot] = child;
+                n->child_index[c] = (unsigned char)(slot + 1);
+                node->num_children++;
+                return 1;
+            }
+            ArtNode256* grown = (ArtNode256*)art_alloc_node(tree, ART_NODE256);
+            if (grown == NULL) {
+                return -1;
+            }
+            art_copy_header(&grown->n, node);
+            for (int b = 0; b < 256; b++) {
+                if (n->child_index[b]) {
+                    grown->children[b] = n->children[n->child_index[b] - 1];
+                }
+            }
+            art_free_node(tree, node);
+            *ref = &grown->n;
+            return art_add_child(tree, ref, c, child);
+        }
+        default: {
+            ((ArtNode256*)node)->children[c] = child;
+            node->num_children++;
+            return 1;
+        }
+    }
+}
+
+// A Node4 left with one child is replaced by that child, with the node's
+// prefix and the child's key byte prepended to the child's prefix. A leaf
+// child needs nothing: it holds its whole key.
+void art_collapse_node4(ArtTree* tree, ArtNode** ref) {
+    ArtNode4* n = (ArtNode4*)*ref;
+    ArtNode* child = n->children[0];
+    if (!ART_IS_LEAF(child)) {
+        unsigned char prefix[ART_MAX_PREFIX];
+        size_t stored = 0;
+        for (size_t i = 0; i < n->n.prefix_len && stored < ART_MAX_PREFIX; i++) {
+            prefix[stored++] = n->n.prefix[i];
+        }
+        if (stored < ART_MAX_PREFIX) {
+            prefix[stored++] = n->keys[0];
+        }
+        for (size_t i = 0; i < child->prefix_len && stored < ART_MAX_PREFIX; i++) {
+            prefix[stored++] = child->prefix[i];
+        }
+        memcpy(child->prefix, prefix, stored);
+        child->prefix_len += n->n.prefix_len + 1;
+    }
+    *ref = child;
+    art_free_node(tree, &n->n);
+}
+
+// Removes the child under byte c, then shrinks the node if it has become
+// sparse enough. A failed shrink allocation keeps the larger node.
+void art_remove_child(ArtTree* tree, ArtNode** ref, unsigned char c) {
+    ArtNode* node = *ref;
+    switch (node->type) {
+        case ART_NODE4: {
+            ArtNode4* n = (ArtNode4*)node;
+            int i = 0;
+            while (n->keys[i] != c) {
+                i++;
+            }
+            memmove(n->keys + i, n->keys + i + 1, node->num_children - i - 1);
+            memmove(n->children + i, n->children + i + 1, (node->num_children - i - 1) * sizeof(ArtNode*));
+            node->num_children--;
+            if (node->num_children == 1) {
+                art_collapse_node4(tree, ref);
+            }
+            return;
+        }
+        case ART_NODE16: {
+            ArtNode16* n = (ArtNode16*)node;
+            int i = 0;
+            while (n->keys[i] != c) {
+                i++;
+            }
+            memmove(n->keys + i, n->keys + i + 1, node->num_children - i - 1);
+            memmove(n->children + i, n->children + i + 1, (node->num_children - i - 1) * sizeof(ArtNode*));
+            node->num_children--;
+            if (node->num_children == ART_SHRINK_16) {
+                ArtNode4* shrunk = (ArtNode4*)art_alloc_node(tree, ART_NODE4);
+                if (shrunk != NULL) {
+                    art_copy_header(&shrunk->n, node);
+                    memcpy(shrunk->keys, n->keys, ART_SHRINK_16);
+                    memcpy(shrunk->children, n->children, ART_SHRINK_16 * sizeof(ArtNode*));
+                    art_free_node(tree, node);
+                    *ref = &shrunk->n;
+                }
+            }
+            return;
+        }
+        case ART_NODE48: {
+            ArtNode48* n = (ArtNode48*)node;
+            n->children[n->child_index[c] - 1] = NULL;
+            n->child_index[c] = 0;
+            node->num_children--;
+            if (node->num_children == ART_SHRINK_48) {
+                ArtNode16* shrunk = (ArtNode16*)art_alloc_node(tree, ART_NODE16);
+                if (shrunk != NULL) {
+                    art_copy_header(&shrunk->n, node);
+                    int i = 0;
+                    for (int b = 0; b < 256; b++) {
+                        if (n->child_index[b]) {
+                            shrunk->keys[i] = (unsigned char)b;
+                            shrunk->children[i++] = n->children[n->child_index[b] - 1];
+                        }
+                    }
+                    art_free_node(tree, node);
+                    *ref = &shrunk->n;
+                }
+            }
+            return;
+        }
+        default: {
+            ArtNode256* n = (ArtNode256*)node;
+            n->children[c] = NULL;
+            node->num_children--;
+            if (node->num_children == ART_SHRINK_256) {
+                ArtNode48* shrunk = (ArtNode48*)art_alloc_node(tree, ART_NODE48);
+                if (shrunk != NULL) {
+                    art_copy_header(&shrunk->n, node);
+                    int slot = 0;
+                    for (int b = 0; b < 256; b++) {
+                        if (n->children[b] != NULL) {
+                            shrunk->children[slot] = n->children[b];
+                            shrunk->child_index[b] = (unsigned char)++slot;
+                        }
+                    }
+                    art_free_node(tree, node);
+                    *ref = &shrunk->n;
+                }
+            }
+            return;
+        }
+    }
+}
+
+// === WORD OPERATIONS ===
+
+int art_insert_at(ArtTree* tree, ArtNode** ref, const unsigned char* key, size_t len, size_t depth) {
+    ArtNode* node = *ref;
+    if (node == NULL) {
+        ArtLeaf* leaf = art_alloc_leaf(tree, key, len);
+        if (leaf == NULL) {
+            return -1;
+        }
+        *ref = ART_TAG_LEAF(leaf);
+        return 1;
+    }
+
+    if (ART_IS_LEAF(node)) {
+        // Lazy expansion ends here: split the two keys where they differ.
+        ArtLeaf* existing = ART_LEAF(node);
+        if (art_leaf_matches(existing, key, len)) {
+            return 0;
+        }
+        size_t common = 0;
+        while (existing->key[depth + common] == key[depth + common]) {
+            common++;
+        }
+        ArtLeaf* leaf = art_alloc_leaf(tree, key, len);
+        ArtNode4* split = leaf ? (ArtNode4*)art_alloc_node(tree, ART_NODE4) : NULL;
+        if (split == NULL) {
+            if (leaf != NULL) {
+                art_free_leaf(tree, leaf);
+            }
+            return -1;
+        }
+        split->n.prefix_len = (uint32_t)common;
+        memcpy(split->n.prefix, key + depth, common < ART_MAX_PREFIX ? common : ART_MAX_PREFIX);
+        ArtNode* as_node = &split->n;
+        art_add_child(tree, &as_node, existing->key[depth + common], node);
+        art_add_child(tree, &as_node, key[depth + common], ART_TAG_LEAF(leaf));
+        *ref = as_node;
+        return 1;
+    }
+
+    if (node->prefix_len > 0) {
+        size_t match = art_prefix_mismatch(node, key, len, depth);
+        if (match < node->prefix_len) {
+            // The key leaves the compressed path: a new Node4 takes the
+            // matching part, the old node keeps what follows its branch byte.
+            ArtLeaf* leaf = art_alloc_leaf(tree, key, len);
+            ArtNode4* split = leaf ? (ArtNode4*)art_alloc_node(tree, ART_NODE4) : NULL;
+            if (split == NULL) {
+                if (leaf != NULL) {
+                    art_free_leaf(tree, leaf);
+                }
+                return -1;
+            }
+            split->n.prefix_len = (uint32_t)match;
+            memcpy(split->n.prefix, node->prefix, match < ART_MAX_PREFIX ? match : ART_MAX_PREFIX);
+            unsigned char branch;
+            if (node->prefix_len <= ART_MAX_PREFIX) {
+                branch = node->prefix[match];
+                node->prefix_len -= (uint32_t)(match + 1);
+                memmove(node->prefix, node->prefix + match + 1, node->prefix_len);
+            } else {
+                ArtLeaf* min = art_minimum(node);
+                branch = min->key[depth + match];
+                node->prefix_len -= (uint32_t)(match + 1);
+                size_t stored = node->prefix_len < ART_MAX_PREFIX ? node->prefix_len : ART_MAX_PREFIX;
+                memcpy(node->prefix, min->key + depth + match + 1, stored);
+            }
+            ArtNode* as_node = &split->n;
+            art_add_child(tree, &as_node, branch, node);
+            art_add_child(tree, &as_node, key[depth + match], ART_TAG_LEAF(leaf));
+            *ref = as_node;
+            return 1;
+        }
+        depth += node->prefix_len;
+    }
+
+    ArtNode** child = art_find_child(node, key[depth]);
+    if (child != NULL) {
+        return art_insert_at(tree, child, key, len, depth + 1);
+    }
+    ArtLeaf* leaf = art_alloc_leaf(tree, key, len);
+    if (leaf == NULL) {
+        return -1;
+    }
+    if (art_add_child(tree, ref, key[depth], ART_TAG_LEAF(leaf)) < 0) {
+        art_free_leaf(tree, leaf);
+        return -1;
+    }
+    return 1;
+}
+
+int art_insert(char* word, ArtTree* tree) {
+    if (word == NULL || tree == NULL) {
+        fprintf(stderr, "ERROR - Must pass a valid word and ArtTree*.");
+        return -1;
+    }
+    int result = art_insert_at(tree, &tree->root, (const unsigned char*)word, strlen(word) + 1, 0);
+    if (result == 1) {
+        tree->size++;
+    }
+    return result;
+}
+
+int art_search(char* word, ArtTree* tree) {
+    if (word == NULL || tree == NULL) {
+        fprintf(stderr, "ERROR - Must pass a valid word and ArtTree*.");
+        return -1;
+    }
+    const unsigned char* key = (const unsigned char*)word;
+    size_t len = strlen(word) + 1;
+    size_t depth = 0;
+    ArtNode* node = tree->root;
+    while (node != NULL) {
+        if (ART_IS_LEAF(node)) {
+            return art_leaf_matches(ART_LEAF(node), key, len);
+        }
+        if (node->prefix_len > 0) {
+            // Optimistic: compare the stored bytes, skip the rest; the leaf
+            // comparison catches a mismatch there.
+            size_t stored = node->prefix_len < ART_MAX_PREFIX ? node->prefix_len : ART_MAX_PREFIX;
+            for (size_t i = 0; i < stored; i++) {
+                if (depth + i >= len || node->prefix[i] != key[depth + i]) {
+                    return 0;
+                }
+            }
+            depth += node->prefix_len;
+            if (depth >= len) {
+                return 0;
+            }
+        }
+        ArtNode** child = art_find_child(node, key[depth]);
+        if (child == NULL) {
+            return 0;
+        }
+        node = *child;
+        depth++;
+    }
+    return 0;
+}
+
+int art_delete_at(ArtTree* tree, ArtNode** ref, const unsigned char* key, size_t len, size_t depth) {
+    ArtNode* node = *ref;
+    if (node->prefix_len > 0) {
+        if (art_prefix_mismatch(node, key, len, depth) < node->prefix_len) {
+            return 0;
+        }
+        depth += node->prefix_len;
+    }
+    if (depth >= len) {
+        return 0;
+    }
+    ArtNode** child = art_find_child(node, key[depth]);
+    if (child == NULL) {
+        return 0;
+    }
+    if (ART_IS_LEAF(*child)) {
+        ArtLeaf* leaf = ART_LEAF(*child);
+        if (!art_leaf_matches(leaf, key, len)) {
+            return 0;
+        }
+        art_remove_child(tree, ref, key[depth]);
+        art_free_leaf(tree, leaf);
+        return 1;
+    }
+    return art_delete_at(tree, child, key, len, depth + 1);
+}
+
+int art_delete_word(char* word, ArtTree* tree) {
+    if (word == NULL || tree == NULL) {
+        fprintf(stderr, "ERROR - Must pass a valid word and ArtTree*.");
+        return -1;
+    }
+    const unsigned char* key = (const unsigned char*)word;
+    size_t len = strlen(word) + 1;
+    int removed = 0;
+    if (tree->root == NULL) {
+        return 0;
+    }
+    if (ART_IS_LEAF(tree->root)) {
+        ArtLeaf* leaf = ART_LEAF(tree->root);
+        if (art_leaf_matches(leaf, key, len)) {
+            art_free_leaf(tree, leaf);
+            tree->root = NULL;
+            removed = 1;
+        }
+    } else {
+        removed = art_delete_at(tree, &tree->root, key, len, 0);
+    }
+    tree->size -= removed;
+    return removed;
+}
@@ -0,0 +1,137 @@
+#ifndef ART_H
+#define ART_H
+
+/**
+ * Adaptive Radix Tree (ART)
+ * A radix tree over the bytes of each word, with the same insert / search /
+ * delete_word operations as the trie in trie.h, for large dictionaries.
+ *
+ * - Adaptive nodes: a node has 4, 16, 48 or 256 child slots and changes
+ *   size as children come and go, so a sparse node stays small and a dense
+ *   one is a direct array lookup. Node16 is searched with one SSE2 compare
+ *   (build with -DART_NO_SIMD for the scalar loop).
+ * - Path compression: a run of single-child nodes collapses into a prefix
+ *   stored in the next node that branches. The first ART_MAX_PREFIX bytes
+ *   are kept in the node; longer prefixes are skipped while searching and
+ *   checked against the leaf at the end. -DART_MAX_PREFIX=n changes how many
+ *   are kept; the default fills the header to 16 bytes.
+ * - Lazy expansion: a word's unique tail is not expanded into nodes. The
+ *   leaf keeps the whole word, and nodes are created only where two words
+ *   diverge.
+ *
+ * Words are stored with their terminating '\0', so no stored key is a
+ * prefix of another.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifndef ART_MAX_PREFIX
+#define ART_MAX_PREFIX 8
+#endif
+
+typedef enum ArtNodeType {
+    ART_NODE4 = 1,
+    ART_NODE16,
+    ART_NODE48,
+    ART_NODE256
+} ArtNodeType;
+
+/**
+ * Header shared by every inner node
+ */
+typedef struct ArtNode {
+    uint8_t type;                          // ArtNodeType
+    uint16_t num_children;
+    uint32_t prefix_len;                   // Compressed path length, may exceed ART_MAX_PREFIX
+    unsigned char prefix[ART_MAX_PREFIX];  // Its first bytes
+} ArtNode;
+
+/**
+ * Up to 4 children, keys sorted
+ */
+typedef struct ArtNode4 {
+    ArtNode n;
+    unsigned char keys[4];
+    ArtNode* children[4];
+} ArtNode4;
+
+/**
+ * Up to 16 children, keys sorted
+ */
+typedef struct ArtNode16 {
+    ArtNode n;
+    unsigned char keys[16];
+    ArtNode* children[16];
+} ArtNode16;
+
+/**
+ * Up to 48 children: child_index[byte] is the slot + 1, or 0 if absent
+ */
+typedef struct ArtNode48 {
+    ArtNode n;
+    unsigned char child_index[256];
+    ArtNode* children[48];
+} ArtNode48;
+
+/**
+ * One slot per byte value
+ */
+typedef struct ArtNode256 {
+    ArtNode n;
+    ArtNode* children[256];
+} ArtNode256;
+
+/**
+ * Leaf: the whole word including its '\0'
+ * Child pointers to leaves have the low bit set.
+ */
+typedef struct ArtLeaf {
+    uint32_t len;
+    unsigned char key[];
+} ArtLeaf;
+
+/**
+ * Tree handle
+ */
+typedef struct ArtTree {
+    ArtNode* root;  // Inner node, tagged leaf pointer, or NULL when empty
+    size_t size;    // Number of words
+    size_t bytes;   // Bytes allocated for nodes and leaves
+} ArtTree;
+
+// === MEMORY MANAGEMENT ===
+
+/**
+ * Creates an empty tree
+ * @return: Pointer to tree, or NULL if allocation fails
+ */
+ArtTree* create_art();
+
+/**
+ * Frees the tree, its nodes and leaves
+ */
+void delete_art(ArtTree* tree);
+
+// === WORD OPERATIONS ===
+
+/**
+ * Adds a word
+ * @return: 1 if added, 0 if already present, -1 on invalid arguments or
+ *          allocation failure (the tree is unchanged)
+ */
+int art_insert(char* word, ArtTree* tree);
+
+/**
+ * Looks up a word
+ * @return: 1 if present, 0 if not, -1 on invalid arguments
+ */
+int art_search(char* word, ArtTree* tree);
+
+/**
+ * Removes a word, shrinking and merging the nodes on its path as needed
+ * @return: 1 if removed, 0 if not present, -1 on invalid arguments
+ */
+int art_delete_word(char* word, ArtTree* tree);
+
+#endif
@@ -0,0 +1,151 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <malloc.h>
+#include "trie.h"
+#include "art.h"
+
+// The character trie against the adaptive radix tree on a URL-like
+// dictionary: heap bytes per word, insert cost, and lookup cost for present
+// and absent words.
+//
+// Words use only 'a'-'z' because the trie caps each node at 26 children;
+// the real URLs' '/', '.', digits and capitals would overflow it.
+
+#define NUM_HOSTS 20000
+
+double now_seconds() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+void shuffle(char** array, int count) {
+    for (int i = count - 1; i > 0; i--) {
+        int j = rand() % (i + 1);
+        char* tmp = array[i];
+        array[i] = array[j];
+        array[j] = tmp;
+    }
+}
+
+size_t heap_in_use() {
+    return mallinfo2().uordblks;
+}
+
+void random_letters(char* out, int min, int max) {
+    int len = min + rand() % (max - min + 1);
+    for (int i = 0; i < len; i++) {
+        out[i] = 'a' + rand() % 26;
+    }
+    out[len] = '\0';
+}
+
+// "httpswww" + host + tld + 1 to 3 path segments, separators dropped.
+char** make_urls(int count, size_t* total_bytes) {
+    static const char* tlds[] = {"com", "org", "net", "io"};
+    char (*hosts)[16] = malloc(NUM_HOSTS * sizeof(*hosts));
+    for (int i = 0; i < NUM_HOSTS; i++) {
+        random_letters(hosts[i], 4, 12);
+    }
+    char** urls = malloc(count * sizeof(char*));
+    *total_bytes = 0;
+    for (int i = 0; i < count; i++) {
+        char url[128];
+        int len = sprintf(url, "httpswww%s%s", hosts[rand() % NUM_HOSTS], tlds[rand() % 4]);
+        int segments = 1 + rand() % 3;
+        for (int s = 0; s < segments; s++) {
+            random_letters(url + len, 3, 10);
+            len += strlen(url + len);
+        }
+        urls[i] = malloc(len + 1);
+        memcpy(urls[i], url, len + 1);
+        *total_bytes += len + 1;
+    }
+    free(hosts);
+    return urls;
+}
+
+int main(int argc, char** argv) {
+    // Usage: ./bench_trie [count]
+    int count = (argc > 1) ? atoi(argv[1]) : 500000;
+    srand(1);
+    size_t key_bytes = 0;
+    char** urls = make_urls(count, &key_bytes);
+    char** lookups = malloc(count * sizeof(char*));
+    char** misses = malloc(count * sizeof(char*));
+    for (int i = 0; i < count; i++) {
+        lookups[i] = urls[i];
+        // Same host and path with one letter past the end: absent unless
+        // that exact longer URL was also generated.
+        size_t len = strlen(urls[i]);
+        misses[i] = malloc(len + 2);
+        memcpy(misses[i], urls[i], len);
+        misses[i][len] = 'q';
+        misses[i][len + 1] = '\0';
+    }
+    shuffle(lookups, count);
+    shuffle(misses, count);
+
+    printf("%d URL-like words, %.1f bytes each with the '\\0'\n", count, (double)key_bytes / count);
+    printf("%-8s%16s%14s%14s%14s%14s\n", "", "heap bytes/word", "node bytes", "insert ns", "hit ns", "miss ns");
+
+    // The ART first: built after the trie, its small allocations would land
+    // scattered across the trie's freed memory.
+    for (int v = 1; v >= 0; v--) {
+        size_t before = heap_in_use();
+        Node* root = NULL;
+        ArtTree* tree = NULL;
+        double start = now_seconds();
+        if (v == 0) {
+            root = create_node('\0');
+            for (int i = 0; i < count; i++) {
+                insert(urls[i], root);
+            }
+        } else {
+            tree = create_art();
+            for (int i = 0; i < count; i++) {
+                art_insert(urls[i], tree);
+            }
+        }
+        double insert_time = now_seconds() - start;
+        size_t heap = heap_in_use() - before;
+
+        long long hits = 0;
+        start = now_seconds();
+        for (int i = 0; i < count; i++) {
+            hits += (v == 0) ? search(lookups[i], root) : art_search(lookups[i], tree);
+        }
+        double hit_time = now_seconds() - start;
+
+        long long false_hits = 0;
+        start = now_seconds();
+        for (int i = 0; i < count; i++) {
+            false_hits += (v == 0) ? search(misses[i], root) : art_search(misses[i], tree);
+        }
+        double miss_time = now_seconds() - start;
+
+        char node_bytes[32] = "-";
+        if (v == 1) {
+            snprintf(node_bytes, sizeof(node_bytes), "%.1f", (double)tree->bytes / tree->size);
+        }
+        printf("%-8s%16.1f%14s%14.1f%14.1f%14.1f%s  (%lld misses found)\n", (v == 0) ? "trie" : "art",
+               (double)heap / count, node_bytes, insert_time / count * 1e9, hit_time / count * 1e9,
+               miss_time / count * 1e9, hits == count ? "" : "  WRONG", false_hits);
+        if (v == 0) {
+            delete_trie(root);
+        } else {
+            delete_art(tree);
+        }
+    }
+
+    for (int i = 0; i < count; i++) {
+        free(urls[i]);
+        free(misses[i]);
+    }
+    free(urls);
+    free(lookups);
+    free(misses);
+    return 0;
+}
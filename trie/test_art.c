@@ -0,0 +1,359 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <assert.h>
+#include <string.h>
+#include "art.h"
+
+// Fills children[256] by key byte and returns how many there are, or -1 if
+// the node's own layout is broken (unsorted keys, bad Node48 index).
+int node_children(ArtNode* node, ArtNode** children) {
+    memset(children, 0, 256 * sizeof(ArtNode*));
+    switch (node->type) {
+        case ART_NODE4:
+        case ART_NODE16: {
+            const unsigned char* keys = node->type == ART_NODE4 ? ((ArtNode4*)node)->keys : ((ArtNode16*)node)->keys;
+            ArtNode** slots = node->type == ART_NODE4 ? ((ArtNode4*)node)->children : ((ArtNode16*)node)->children;
+            for (int i = 0; i < node->num_children; i++) {
+                if ((i > 0 && keys[i - 1] >= keys[i]) || slots[i] == NULL) {
+                    return -1;
+                }
+                children[keys[i]] = slots[i];
+            }
+            break;
+        }
+        case ART_NODE48: {
+            ArtNode48* n = (ArtNode48*)node;
+            int used = 0;
+            for (int b = 0; b < 256; b++) {
+                if (n->child_index[b] != 0) {
+                    children[b] = n->children[n->child_index[b] - 1];
+                    used++;
+                }
+            }
+            for (int i = 0; i < 48; i++) {
+                used -= n->children[i] != NULL;
+            }
+            if (used != 0) {
+                return -1;
+            }
+            break;
+        }
+        case ART_NODE256:
+            memcpy(children, ((ArtNode256*)node)->children, 256 * sizeof(ArtNode*));
+            break;
+        default:
+            return -1;
+    }
+    int count = 0;
+    for (int b = 0; b < 256; b++) {
+        count += children[b] != NULL;
+    }
+    return count;
+}
+
+const ArtLeaf* first_leaf(ArtNode* node) {
+    ArtNode* children[256];
+    while (((uintptr_t)node & 1) == 0) {
+        node_children(node, children);
+        int b = 0;
+        while (children[b] == NULL) {
+            b++;
+        }
+        node = children[b];
+    }
+    return (const ArtLeaf*)((uintptr_t)node & ~(uintptr_t)1);
+}
+
+// Checks the subtree at node and returns its word count, or -1 if anything
+// is wrong. Every leaf below must agree with ref on its first upto bytes and
+// have expected at position depth - 1 (expected < 0 skips that). Adds the
+// bytes of every node and leaf to *bytes.
+long check_art(ArtNode* node, size_t depth, const ArtLeaf* ref, size_t upto, int expected, size_t* bytes) {
+    if (((uintptr_t)node & 1) != 0) {
+        const ArtLeaf* leaf = first_leaf(node);
+        *bytes += sizeof(ArtLeaf) + leaf->len;
+        if (leaf->len < depth || leaf->key[leaf->len - 1] != '\0' || memchr(leaf->key, '\0', leaf->len - 1) != NULL) {
+            return -1;
+        }
+        if (ref != NULL && memcmp(leaf->key, ref->key, upto) != 0) {
+            return -1;
+        }
+        if (expected >= 0 && leaf->key[depth - 1] != expected) {
+            return -1;
+        }
+        return 1;
+    }
+
+    // Fill bounds per type: shrinking happens below the next type's capacity.
+    int bounds[][2] = {{0, 0}, {2, 4}, {4, 16}, {13, 48}, {38, 256}};
+    size_t sizes[] = {0, sizeof(ArtNode4), sizeof(ArtNode16), sizeof(ArtNode48), sizeof(ArtNode256)};
+    ArtNode* children[256];
+    int count = node_children(node, children);
+    if (count < 0 || count != node->num_children || count < bounds[node->type][0] || count > bounds[node->type][1]) {
+        return -1;
+    }
+    *bytes += sizes[node->type];
+
+    // Every leaf below shares the node's prefix; the stored bytes are its start.
+    const ArtLeaf* min = first_leaf(node);
+    size_t stored = node->prefix_len < ART_MAX_PREFIX ? node->prefix_len : ART_MAX_PREFIX;
+    if (min->len < depth + node->prefix_len + 1 || memcmp(node->prefix, min->key + depth, stored) != 0) {
+        return -1;
+    }
+    if (ref != NULL && memcmp(min->key, ref->key, upto) != 0) {
+        return -1;
+    }
+    if (expected >= 0 && min->key[depth - 1] != expected) {
+        return -1;
+    }
+
+    long words = 0;
+    size_t next_depth = depth + node->prefix_len + 1;
+    for (int b = 0; b < 256; b++) {
+        if (children[b] != NULL) {
+            long below = check_art(children[b], next_depth, min, next_depth - 1, b, bytes);
+            if (below < 0) {
+                return -1;
+            }
+            words += below;
+        }
+    }
+    return words;
+}
+
+// Word count of a valid tree whose byte count is right, or -1.
+long validate(ArtTree* tree) {
+    size_t bytes = 0;
+    long words = tree->root ? check_art(tree->root, 0, NULL, 0, -1, &bytes) : 0;
+    if (words < 0 || (size_t)words != tree->size || bytes != tree->bytes) {
+        return -1;
+    }
+    return words;
+}
+
+void test_create_art() {
+    printf("Testing create_art...\n");
+    ArtTree* tree = create_art();
+
+    assert(tree != NULL);
+    assert(tree->root == NULL);
+    assert(tree->size == 0);
+    assert(tree->bytes == 0);
+    assert(ART_MAX_PREFIX != 8 || sizeof(ArtNode) == 16);
+    assert(art_search("cat", tree) == 0);
+    assert(art_delete_word("cat", tree) == 0);
+
+    assert(art_insert(NULL, tree) == -1);
+    assert(art_search("cat", NULL) == -1);
+    assert(art_delete_word(NULL, tree) == -1);
+
+    delete_art(tree);
+    printf("SUCCESS - create_art tests passed\n");
+}
+
+void test_art_insert_and_search() {
+    printf("Testing ART insert and search...\n");
+    ArtTree* tree = create_art();
+
+    assert(art_insert("cat", tree) == 1);
+    assert(tree->root != NULL && ((uintptr_t)tree->root & 1)); // A lone word is one leaf
+    assert(art_insert("cat", tree) == 0);
+    assert(art_insert("car", tree) == 1);
+    assert(art_insert("card", tree) == 1);
+    assert(art_insert("care", tree) == 1);
+    assert(art_insert("careful", tree) == 1);
+    assert(art_insert("", tree) == 1);
+
+    assert(art_search("cat", tree) == 1);
+    assert(art_search("car", tree) == 1);
+    assert(art_search("card", tree) == 1);
+    assert(art_search("care", tree) == 1);
+    assert(art_search("careful", tree) == 1);
+    assert(art_search("", tree) == 1);
+    assert(art_search("ca", tree) == 0);
+    assert(art_search("cars", tree) == 0);
+    assert(art_search("carefully", tree) == 0);
+    assert(art_search("dog", tree) == 0);
+    assert(tree->size == 6);
+    assert(validate(tree) == 6);
+
+    delete_art(tree);
+    printf("SUCCESS - ART insert/search tests passed\n");
+}
+
+void test_art_node_growth() {
+    printf("Testing ART node growth and shrinking...\n");
+    ArtTree* tree = create_art();
+
+    // Every non-zero byte after a shared prefix: the branching node grows
+    // through every type.
+    char word[4] = {'x', 'y', 0, 0};
+    int types_seen[5] = {0};
+    for (int b = 1; b < 256; b++) {
+        word[2] = (char)b;
+        assert(art_insert(word, tree) == 1);
+        if (b >= 2) {
+            types_seen[tree->root->type] = 1;
+            assert(tree->root->prefix_len == 2);
+        }
+    }
+    assert(types_seen[ART_NODE4] && types_seen[ART_NODE16] && types_seen[ART_NODE48] && types_seen[ART_NODE256]);
+    assert(validate(tree) == 255);
+    for (int b = 1; b < 256; b++) {
+        word[2] = (char)b;
+        assert(art_search(word, tree) == 1);
+    }
+    assert(art_search("xy", tree) == 0);
+
+    // And back down through every type to a single leaf.
+    int shrunk_to[5] = {0};
+    for (int b = 255; b >= 2; b--) {
+        word[2] = (char)b;
+        assert(art_delete_word(word, tree) == 1);
+        assert(art_search(word, tree) == 0);
+        if (!((uintptr_t)tree->root & 1)) {
+            shrunk_to[tree->root->type] = 1;
+        }
+        assert(validate(tree) == b - 1);
+    }
+    assert(shrunk_to[ART_NODE48] && shrunk_to[ART_NODE16] && shrunk_to[ART_NODE4]);
+    assert((uintptr_t)tree->root & 1);
+    word[2] = 1;
+    assert(art_delete_word(word, tree) == 1);
+    assert(tree->root == NULL && tree->bytes == 0);
+
+    delete_art(tree);
+    printf("SUCCESS - ART node growth tests passed\n");
+}
+
+void test_art_long_prefixes() {
+    printf("Testing ART prefixes longer than ART_MAX_PREFIX...\n");
+    ArtTree* tree = create_art();
+
+    // Words sharing 40 bytes, then splits at positions inside that run, so
+    // prefixes beyond the stored bytes are recovered from leaves.
+    char base[] = "httpwwwexamplecompathtoresourceindexpage";
+    char words[41][48];
+    for (int i = 0; i <= 40; i++) {
+        strcpy(words[i], base);
+        if (i < 40) {
+            words[i][i] = 'Z';
+            words[i][i + 1] = '\0';
+        }
+        assert(art_insert(words[i], tree) == 1);
+        assert(validate(tree) == i + 1);
+    }
+    for (int i = 0; i <= 40; i++) {
+        assert(art_search(words[i], tree) == 1);
+    }
+    // Differs only beyond the stored prefix bytes: caught at the leaf.
+    char near[48];
+    strcpy(near, base);
+    near[30] = 'Q';
+    assert(art_search(near, tree) == 0);
+    assert(art_delete_word(near, tree) == 0);
+
+    // Deleting merges nodes back and concatenates their prefixes.
+    for (int i = 0; i <= 40; i += 2) {
+        assert(art_delete_word(words[i], tree) == 1);
+        assert(validate(tree) >= 0);
+    }
+    for (int i = 0; i <= 40; i++) {
+        assert(art_search(words[i], tree) == (i % 2));
+    }
+    for (int i = 1; i <= 40; i += 2) {
+        assert(art_delete_word(words[i], tree) == 1);
+    }
+    assert(tree->root == NULL && tree->size == 0 && tree->bytes == 0);
+
+    delete_art(tree);
+    printf("SUCCESS - ART long prefix tests passed\n");
+}
+
+int compare_words(const void* a, const void* b) {
+    return strcmp(*(char* const*)a, *(char* const*)b);
+}
+
+void test_art_random() {
+    printf("Testing ART against a reference set...\n");
+    enum { POOL = 20000, OPS = 200000 };
+
+    // Distinct words over a small alphabet, so they share long prefixes,
+    // plus arbitrary bytes to exercise the wide node types.
+    srand(42);
+    char** pool = malloc(POOL * sizeof(char*));
+    for (int i = 0; i < POOL; i++) {
+        int len = 1 + rand() % 24;
+        pool[i] = malloc(len + 1);
+        for (int j = 0; j < len; j++) {
+            pool[i][j] = (i % 4 == 0) ? (char)(1 + rand() % 255) : (char)('a' + rand() % 3);
+        }
+        pool[i][len] = '\0';
+    }
+    qsort(pool, POOL, sizeof(char*), compare_words);
+    int distinct = 0;
+    for (int i = 0; i < POOL; i++) {
+        if (distinct == 0 || strcmp(pool[distinct - 1], pool[i]) != 0) {
+            pool[distinct++] = pool[i];
+        } else {
+            free(pool[i]);
+        }
+    }
+
+    ArtTree* tree = create_art();
+    char* present = calloc(distinct, 1);
+    int count = 0;
+    for (int op = 0; op < OPS; op++) {
+        int i = rand() % distinct;
+        switch (rand() % 3) {
+            case 0:
+                assert(art_insert(pool[i], tree) == !present[i]);
+                count += !present[i];
+                present[i] = 1;
+                break;
+            case 1:
+                assert(art_delete_word(pool[i], tree) == present[i]);
+                count -= present[i];
+                present[i] = 0;
+                break;
+            default:
+                assert(art_search(pool[i], tree) == present[i]);
+                break;
+        }
+        if (op % 20000 == 0) {
+            assert(validate(tree) == count);
+        }
+    }
+    assert(validate(tree) == count);
+    for (int i = 0; i < distinct; i++) {
+        assert(art_search(pool[i], tree) == present[i]);
+    }
+    for (int i = 0; i < distinct; i++) {
+        if (present[i]) {
+            assert(art_delete_word(pool[i], tree) == 1);
+        }
+    }
+    assert(tree->root == NULL && tree->bytes == 0);
+
+    for (int i = 0; i < distinct; i++) {
+        free(pool[i]);
+    }
+    free(pool);
+    free(present);
+    delete_art(tree);
+    printf("SUCCESS - ART reference set tests passed\n");
+}
+
+int main() {
+    printf("Running ART Tests\n");
+    printf("=================\n");
+
+    test_create_art();
+    test_art_insert_and_search();
+    test_art_node_growth();
+    test_art_long_prefixes();
+    test_art_random();
+
+    printf("\nSUCCESS - All tests passed!\n");
+    return 0;
+}